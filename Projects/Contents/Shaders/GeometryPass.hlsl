@@ -8,6 +8,7 @@ struct VSInput
 	float3 Normal			: NORMAL;
 	float4 Tangent			: TANGENT;
 	float4 BiTangent		: BITANGENT;
+	uint DrawID				: INSTANCE_DRAWID;
 };
 
 // postfix WS meaning world space
@@ -49,14 +50,17 @@ Texture2D aoMap						: register(t3);
 Texture2D normalMap					: register(t4);
 SamplerState Sampler					: register(s0);
 
-/* Constant Buffers (Vertex Shader) */
-cbuffer TransformBuffer
+/* Structured Buffers (Vertex Shader) */
+/* Same packing as constant buffer; Matrices are uploaded from row-major CPU matrices. */
+struct InstanceTransform
 {
-	matrix World;
-	matrix WorldView;
-	matrix WorldViewProj;
+	column_major matrix World;
+	column_major matrix WorldView;
+	column_major matrix WorldViewProj;
 };
 
+StructuredBuffer<InstanceTransform> InstanceTransforms : register(t0);
+
 /* Constant Buffers (Pixel Shader) */
 cbuffer MaterialBuffer
 {
@@ -72,6 +76,9 @@ cbuffer MaterialBuffer
 VSOutput MileVS(in VSInput input)
 {
 	VSOutput output;
+	InstanceTransform transform = InstanceTransforms[input.DrawID];
+	matrix World = transform.World;
+	matrix WorldViewProj = transform.WorldViewProj;
 
 	float3 normalWS = normalize(mul((float3x3) World, input.Normal));
 	float3 tangentWS = normalize(mul((float3x3) World, input.Tangent.xyz));
@@ -0,0 +1,192 @@
+#include "Benchmark.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      BenchmarkRunner::BenchmarkRunner(BenchmarkEnvironment& environment, const BenchmarkOptions& options) :
+         m_environment(environment),
+         m_options(options)
+      {
+      }
+
+      void BenchmarkRunner::Add(const std::string& name, const std::vector<size_t>& scales, const BenchmarkSetup& setup)
+      {
+         m_benchmarks.push_back({ name, scales, setup });
+      }
+
+      void BenchmarkRunner::AddCheck(const std::string& name, const CheckBody& check)
+      {
+         m_checks.push_back({ name, check });
+      }
+
+      int BenchmarkRunner::RunChecks()
+      {
+         int failures = 0;
+         for (const CheckDesc& check : m_checks)
+         {
+            if (!m_options.Filter.empty() && check.Name.find(m_options.Filter) == std::string::npos)
+            {
+               continue;
+            }
+
+            std::string failure;
+            bool bPassed = false;
+            try
+            {
+               bPassed = check.Body(m_environment, failure);
+            }
+            catch (const std::exception& exception)
+            {
+               failure = std::string("Exception : ") + exception.what();
+            }
+
+            if (bPassed)
+            {
+               std::printf("[PASS] %s\n", check.Name.c_str());
+            }
+            else
+            {
+               std::printf("[FAIL] %s : %s\n", check.Name.c_str(), failure.c_str());
+               ++failures;
+            }
+         }
+
+         return failures;
+      }
+
+      void BenchmarkRunner::Run()
+      {
+         m_results.clear();
+         std::printf("%-40s %10s %8s %12s %12s %12s\n", "Benchmark", "Scale", "Iters", "Median(ms)", "Min(ms)", "Max(ms)");
+         for (const BenchmarkDesc& benchmark : m_benchmarks)
+         {
+            if (!m_options.Filter.empty() && benchmark.Name.find(m_options.Filter) == std::string::npos)
+            {
+               continue;
+            }
+
+            for (size_t scale : benchmark.Scales)
+            {
+               if (scale > m_options.MaxScale)
+               {
+                  continue;
+               }
+
+               BenchmarkBody body = benchmark.Setup(m_environment, scale);
+               BenchmarkResult result = Measure(benchmark.Name, scale, body);
+               std::printf("%-40s %10zu %8zu %12.4f %12.4f %12.4f\n",
+                  result.Name.c_str(), result.Scale, result.Iterations, result.MedianMS, result.MinMS, result.MaxMS);
+               m_results.push_back(result);
+            }
+         }
+      }
+
+      BenchmarkResult BenchmarkRunner::Measure(const std::string& name, size_t scale, const BenchmarkBody& body) const
+      {
+         using Clock = std::chrono::steady_clock;
+
+         /** Warm up caches and pools before measuring. */
+         body();
+
+         std::vector<double> samples;
+         double totalMS = 0.0;
+         while (samples.size() < m_options.MaxIterations &&
+            (samples.size() < m_options.MinIterations || totalMS < m_options.MinTimeMS))
+         {
+            auto begin = Clock::now();
+            body();
+            double elapsedMS = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+            samples.push_back(elapsedMS);
+            totalMS += elapsedMS;
+         }
+
+         BenchmarkResult result;
+         result.Name = name;
+         result.Scale = scale;
+         result.Iterations = samples.size();
+         std::sort(samples.begin(), samples.end());
+         result.MinMS = samples.front();
+         result.MaxMS = samples.back();
+         result.MeanMS = totalMS / static_cast<double>(samples.size());
+         size_t mid = samples.size() / 2;
+         result.MedianMS = (samples.size() % 2 == 0) ? (samples[mid - 1] + samples[mid]) * 0.5 : samples[mid];
+         return result;
+      }
+
+      bool BenchmarkRunner::WriteResults(const String& filePath) const
+      {
+         json results = json::array();
+         for (const BenchmarkResult& result : m_results)
+         {
+            json serialized;
+            serialized["Name"] = result.Name;
+            serialized["Scale"] = result.Scale;
+            serialized["Iterations"] = result.Iterations;
+            serialized["MinMS"] = result.MinMS;
+            serialized["MedianMS"] = result.MedianMS;
+            serialized["MeanMS"] = result.MeanMS;
+            serialized["MaxMS"] = result.MaxMS;
+            results.push_back(serialized);
+         }
+
+         json serialized;
+         serialized["Threads"] = std::thread::hardware_concurrency();
+         serialized["Results"] = std::move(results);
+
+         std::ofstream stream(std::filesystem::path(filePath), std::ios::out | std::ios::trunc);
+         if (!stream.is_open())
+         {
+            return false;
+         }
+
+         stream << serialized.dump(2);
+         return stream.good();
+      }
+
+      int BenchmarkRunner::CompareWithBaseline(const String& filePath) const
+      {
+         std::ifstream stream{ std::filesystem::path(filePath) };
+         if (!stream.is_open())
+         {
+            return -1;
+         }
+
+         json baseline = json::parse(stream, nullptr, false);
+         if (baseline.is_discarded() || baseline.find("Results") == baseline.end())
+         {
+            return -1;
+         }
+
+         std::map<std::pair<std::string, size_t>, double> baselineMedians;
+         for (const auto& result : baseline["Results"])
+         {
+            std::string name = GetValueSafelyFromJson<std::string>(result, "Name");
+            size_t scale = GetValueSafelyFromJson<size_t>(result, "Scale");
+            baselineMedians[std::make_pair(name, scale)] = GetValueSafelyFromJson<double>(result, "MedianMS");
+         }
+
+         int regressions = 0;
+         std::printf("\n%-40s %10s %12s %12s %9s\n", "Benchmark", "Scale", "Base(ms)", "Current(ms)", "Delta");
+         for (const BenchmarkResult& result : m_results)
+         {
+            auto foundItr = baselineMedians.find(std::make_pair(result.Name, result.Scale));
+            if (foundItr == baselineMedians.end() || foundItr->second <= 0.0)
+            {
+               continue;
+            }
+
+            double deltaPercent = ((result.MedianMS - foundItr->second) / foundItr->second) * 100.0;
+            bool bRegressed = deltaPercent > m_options.RegressionThreshold;
+            std::printf("%-40s %10zu %12.4f %12.4f %+8.1f%%%s\n",
+               result.Name.c_str(), result.Scale, foundItr->second, result.MedianMS, deltaPercent, bRegressed ? " REGRESSED" : "");
+            if (bRegressed)
+            {
+               ++regressions;
+            }
+         }
+
+         return regressions;
+      }
+   }
+}
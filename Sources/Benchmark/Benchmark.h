@@ -0,0 +1,132 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+
+namespace Mile
+{
+   class Context;
+   class ThreadPool;
+   class World;
+   class ResourceManager;
+   class RendererPBR;
+
+   namespace Benchmark
+   {
+      constexpr unsigned int BENCHMARK_RENDER_WIDTH = 1280;
+      constexpr unsigned int BENCHMARK_RENDER_HEIGHT = 720;
+
+      /** Subsystems which benchmarks are able to drive without window or D3D device. */
+      struct BenchmarkEnvironment
+      {
+         Context* EngineContext = nullptr;
+         ThreadPool* Pool = nullptr;
+         World* TargetWorld = nullptr;
+         /** Not initialized; Only owner of resources for cache benchmarks. */
+         ResourceManager* ResMng = nullptr;
+         /** Initialized headless on null render device; nullptr if it has been failed. (ex. Shaders are not found) */
+         RendererPBR* Renderer = nullptr;
+         /** Checks record golden files from actual results instead of comparing against them. */
+         bool bRecordGolden = false;
+      };
+
+      /** Measured body of benchmark. Called repeatedly after setup. */
+      using BenchmarkBody = std::function<void()>;
+      /** Prepare state for given scale and return body to be measured. Called once per scale. */
+      using BenchmarkSetup = std::function<BenchmarkBody(BenchmarkEnvironment&, size_t)>;
+
+      struct BenchmarkDesc
+      {
+         std::string Name;
+         std::vector<size_t> Scales;
+         BenchmarkSetup Setup;
+      };
+
+      /** Correctness check; Returns false and describes failure when it fails. */
+      using CheckBody = std::function<bool(BenchmarkEnvironment&, std::string&)>;
+
+      struct CheckDesc
+      {
+         std::string Name;
+         CheckBody Body;
+      };
+
+      struct BenchmarkResult
+      {
+         std::string Name;
+         size_t Scale = 0;
+         size_t Iterations = 0;
+         double MinMS = 0.0;
+         double MedianMS = 0.0;
+         double MeanMS = 0.0;
+         double MaxMS = 0.0;
+      };
+
+      struct BenchmarkOptions
+      {
+         /** Only benchmarks which contain filter in their name are run. */
+         std::string Filter;
+         /** Scales larger than this are skipped. */
+         size_t MaxScale = 100000;
+         /** Each scale is measured at least MinIterations times and until MinTimeMS has been spent. */
+         size_t MinIterations = 5;
+         size_t MaxIterations = 1000;
+         double MinTimeMS = 250.0;
+         /** Median slower than baseline by more than this percent is reported as regression. */
+         double RegressionThreshold = 10.0;
+         /** Run only correctness checks. */
+         bool bChecksOnly = false;
+      };
+
+      /**
+       * @brief   Runs registered benchmarks headlessly and reports median, min, mean and max time of each scale.
+       *          Results are written as JSON and compared against baseline results which have been written before.
+       *          Correctness checks run before benchmarks, so speed is never reported for wrong results.
+       */
+      class BenchmarkRunner
+      {
+      public:
+         BenchmarkRunner(BenchmarkEnvironment& environment, const BenchmarkOptions& options);
+
+         void Add(const std::string& name, const std::vector<size_t>& scales, const BenchmarkSetup& setup);
+         void AddCheck(const std::string& name, const CheckBody& check);
+
+         /** @return   Number of failed checks. */
+         int RunChecks();
+         void Run();
+
+         const std::vector<BenchmarkResult>& GetResults() const { return m_results; }
+
+         bool WriteResults(const String& filePath) const;
+         /** @return   Number of regressed results, or -1 if failed to load baseline. */
+         int CompareWithBaseline(const String& filePath) const;
+
+      private:
+         BenchmarkResult Measure(const std::string& name, size_t scale, const BenchmarkBody& body) const;
+
+      private:
+         BenchmarkEnvironment& m_environment;
+         BenchmarkOptions m_options;
+         std::vector<BenchmarkDesc> m_benchmarks;
+         std::vector<CheckDesc> m_checks;
+         std::vector<BenchmarkResult> m_results;
+
+      };
+
+      /** Keep result of benchmark body from being optimized away. */
+      template <typename Ty>
+      inline void DoNotOptimize(Ty value)
+      {
+         static volatile Ty sink;
+         sink = value;
+      }
+
+      void RegisterWorldBenchmarks(BenchmarkRunner& runner);
+      void RegisterFrameGraphBenchmarks(BenchmarkRunner& runner);
+      void RegisterResourceBenchmarks(BenchmarkRunner& runner);
+      void RegisterMeshOptimizerBenchmarks(BenchmarkRunner& runner);
+      void RegisterLoggerBenchmarks(BenchmarkRunner& runner);
+      void RegisterMathBenchmarks(BenchmarkRunner& runner);
+      void RegisterThreadPoolBenchmarks(BenchmarkRunner& runner);
+      void RegisterGPUProfilerBenchmarks(BenchmarkRunner& runner);
+      void RegisterRendererBenchmarks(BenchmarkRunner& runner);
+   }
+}
@@ -0,0 +1,11 @@
+#include "BenchmarkComponent.h"
+#include "GameFramework/Entity.h"
+#include "GameFramework/Transform.h"
+
+DefineComponent(BenchmarkComponent);
+
+void BenchmarkComponent::Update()
+{
+   auto transform = m_entity->GetTransform();
+   transform->Rotate(Quaternion(0.1f, Vector3::Up()));
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+#include "Component/ComponentRegister.h"
+
+using namespace Mile;
+
+/** Rotates its entity every update, so every update dirties transform hierarchy. */
+class BenchmarkComponent : public Component
+{
+   DeclareComponent(BenchmarkComponent);
+
+public:
+   BenchmarkComponent(Entity* entity) :
+      Component(entity)
+   {
+   }
+
+   virtual void Update() override;
+   virtual bool IsParallelUpdatable() const override { return true; }
+
+};
@@ -0,0 +1,182 @@
+#include "Core/Context.h"
+#include "GameFramework/World.h"
+#include "Resource/ResourceManager.h"
+#include "MT/ThreadPool.h"
+#include "Rendering/RendererPBR.h"
+#include "Rendering/NullRenderDevice.h"
+#include "Benchmark.h"
+
+using namespace Mile;
+using namespace Mile::Benchmark;
+
+static void PrintUsage()
+{
+   std::printf(
+      "Usage: Benchmark [options]\n"
+      "  --filter <name>         Run only benchmarks which contain name\n"
+      "  --max-scale <n>         Skip scales larger than n (default 100000, up to 1000000)\n"
+      "  --min-time <ms>         Minimum measuring time per scale (default 250)\n"
+      "  --min-iterations <n>    Minimum iterations per scale (default 5)\n"
+      "  --threads <n>           Worker threads of thread pool (default hardware concurrency - 1)\n"
+      "  --out <path>            Write results as JSON\n"
+      "  --baseline <path>       Compare medians against results which have been written by --out\n"
+      "  --threshold <percent>   Slowdown reported as regression (default 10)\n"
+      "  --checks-only           Run only correctness checks\n"
+      "  --record-golden         Record golden files of checks instead of comparing against them\n"
+      "Exit code is 1 when a check failed or a benchmark regressed.\n");
+}
+
+int main(int argc, char* argv[])
+{
+   BenchmarkOptions options;
+   bool bRecordGolden = false;
+   String outPath;
+   String baselinePath;
+   size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1;
+   for (int idx = 1; idx < argc; ++idx)
+   {
+      std::string arg = argv[idx];
+      bool bHasValue = (idx + 1) < argc;
+      if (arg == "--help" || arg == "-h")
+      {
+         PrintUsage();
+         return 0;
+      }
+      else if (arg == "--filter" && bHasValue)
+      {
+         options.Filter = argv[++idx];
+      }
+      else if (arg == "--max-scale" && bHasValue)
+      {
+         options.MaxScale = std::stoull(argv[++idx]);
+      }
+      else if (arg == "--min-time" && bHasValue)
+      {
+         options.MinTimeMS = std::stod(argv[++idx]);
+      }
+      else if (arg == "--min-iterations" && bHasValue)
+      {
+         options.MinIterations = std::max<size_t>(std::stoull(argv[++idx]), 1);
+      }
+      else if (arg == "--threads" && bHasValue)
+      {
+         threads = std::max<size_t>(std::stoull(argv[++idx]), 1);
+      }
+      else if (arg == "--out" && bHasValue)
+      {
+         outPath = String2WString(argv[++idx]);
+      }
+      else if (arg == "--baseline" && bHasValue)
+      {
+         baselinePath = String2WString(argv[++idx]);
+      }
+      else if (arg == "--threshold" && bHasValue)
+      {
+         options.RegressionThreshold = std::stod(argv[++idx]);
+      }
+      else if (arg == "--checks-only")
+      {
+         options.bChecksOnly = true;
+      }
+      else if (arg == "--record-golden")
+      {
+         bRecordGolden = true;
+      }
+      else
+      {
+         std::printf("Unknown option : %s\n", arg.c_str());
+         PrintUsage();
+         return 2;
+      }
+   }
+
+   /** Headless; No engine or window. Renderer records commands on null render device instead of GPU. */
+   auto context = new Context();
+   auto threadPool = new ThreadPool(context, threads);
+   context->RegisterSubSystem(threadPool);
+   auto resMng = new ResourceManager(context);
+   context->RegisterSubSystem(resMng);
+   auto world = new World(context);
+   context->RegisterSubSystem(world);
+   auto renderer = new RendererPBR(context, threadPool->GetThreads());
+   context->RegisterSubSystem(renderer);
+
+   int execute = 0;
+   if (threadPool->Init() && world->Init())
+   {
+      BenchmarkEnvironment environment;
+      environment.EngineContext = context;
+      environment.Pool = threadPool;
+      environment.TargetWorld = world;
+      environment.ResMng = resMng;
+      environment.bRecordGolden = bRecordGolden;
+      if (renderer->InitHeadless(std::make_unique<NullRenderDevice>(), BENCHMARK_RENDER_WIDTH, BENCHMARK_RENDER_HEIGHT))
+      {
+         environment.Renderer = renderer;
+      }
+
+      BenchmarkRunner runner(environment, options);
+      RegisterWorldBenchmarks(runner);
+      RegisterFrameGraphBenchmarks(runner);
+      RegisterResourceBenchmarks(runner);
+      RegisterMeshOptimizerBenchmarks(runner);
+      RegisterLoggerBenchmarks(runner);
+      RegisterMathBenchmarks(runner);
+      RegisterThreadPoolBenchmarks(runner);
+      RegisterGPUProfilerBenchmarks(runner);
+      if (environment.Renderer != nullptr)
+      {
+         RegisterRendererBenchmarks(runner);
+      }
+      else
+      {
+         /** Broken headless backend must not be reported as green. */
+         runner.AddCheck("RendererPBR.InitHeadless",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               message = "Failed to initialize headless renderer; Renderer benchmarks are skipped";
+               return false;
+            });
+      }
+      int failedChecks = runner.RunChecks();
+      if (failedChecks > 0)
+      {
+         std::printf("%d check(s) failed.\n", failedChecks);
+         execute = 1;
+      }
+
+      if (!options.bChecksOnly)
+      {
+         runner.Run();
+      }
+      world->Clear();
+
+      if (!outPath.empty() && !runner.WriteResults(outPath))
+      {
+         std::wcout << TEXT("Failed to write results to ") << outPath << std::endl;
+         execute = 2;
+      }
+
+      if (!baselinePath.empty())
+      {
+         int regressions = runner.CompareWithBaseline(baselinePath);
+         if (regressions < 0)
+         {
+            std::wcout << TEXT("Failed to load baseline from ") << baselinePath << std::endl;
+            execute = 2;
+         }
+         else if (regressions > 0)
+         {
+            std::printf("%d benchmark(s) regressed.\n", regressions);
+            execute = 1;
+         }
+      }
+   }
+   else
+   {
+      execute = 2;
+   }
+
+   SafeDelete(context);
+   return execute;
+}
@@ -0,0 +1,335 @@
+#include "Benchmark.h"
+#include "MT/ThreadPool.h"
+#include "Elaina/FrameGraph.h"
+
+namespace Elaina
+{
+   /** CPU side stand-in of GPU buffer, so frame graph runs without device. */
+   struct BenchmarkBufferDescriptor
+   {
+      size_t Size = 0;
+      /** Stand-in of render target which wraps external render target view. */
+      bool bIsExternal = false;
+   };
+
+   struct BenchmarkBuffer
+   {
+      std::vector<unsigned char> Data;
+   };
+
+   template<>
+   BenchmarkBuffer* Realize(const BenchmarkBufferDescriptor& desc)
+   {
+      auto buffer = new BenchmarkBuffer();
+      buffer->Data.resize(desc.Size);
+      return buffer;
+   }
+
+   template<>
+   struct PoolingTraits<BenchmarkBufferDescriptor, BenchmarkBuffer>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const BenchmarkBufferDescriptor& desc) { return !desc.bIsExternal; }
+
+      static size_t Hash(const BenchmarkBufferDescriptor& desc) { return std::hash<size_t>()(desc.Size); }
+
+      static bool IsReusable(const BenchmarkBufferDescriptor& pooledDesc, const BenchmarkBuffer& pooled, const BenchmarkBufferDescriptor& desc)
+      {
+         return pooledDesc.Size == desc.Size;
+      }
+
+      static void Recycle(const BenchmarkBufferDescriptor& desc, BenchmarkBuffer& actual) { }
+
+      static size_t SizeOf(const BenchmarkBufferDescriptor& desc, const BenchmarkBuffer& actual) { return desc.Size; }
+   };
+}
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      using BenchmarkBufferResource = Elaina::FrameResource<Elaina::BenchmarkBufferDescriptor, Elaina::BenchmarkBuffer>;
+
+      static const std::vector<size_t> FRAME_GRAPH_SCALES = { 64, 256, 1024, 4096 };
+      /** Render passes are distributed into independent chains, so they can be executed in parallel. */
+      constexpr size_t FRAME_GRAPH_CHAINS = 8;
+      constexpr size_t BENCHMARK_BUFFER_SIZE = 4096;
+      /** Submitted before its commands have been recorded. */
+      constexpr size_t FRAME_GRAPH_NOT_RECORDED = std::numeric_limits<size_t>::max();
+
+      struct BenchmarkPassData
+      {
+         BenchmarkBufferResource* Output = nullptr;
+         std::vector<BenchmarkBufferResource*> Inputs;
+      };
+
+      /** Simulate command recording by touching every input and output. */
+      static void ExecuteBenchmarkPass(const BenchmarkPassData& data)
+      {
+         unsigned int checksum = 0;
+         for (auto input : data.Inputs)
+         {
+            const auto& inputData = input->GetActual()->Data;
+            for (size_t idx = 0; idx < inputData.size(); idx += 64)
+            {
+               checksum += inputData[idx];
+            }
+         }
+
+         if (data.Output != nullptr)
+         {
+            auto& outputData = data.Output->GetActual()->Data;
+            for (size_t idx = 0; idx < outputData.size(); idx += 64)
+            {
+               outputData[idx] = static_cast<unsigned char>(checksum + idx);
+            }
+         }
+
+         DoNotOptimize(checksum);
+      }
+
+      static void BuildFrameGraph(Elaina::FrameGraph& frameGraph, Elaina::BenchmarkBuffer* backBuffer, size_t passes, bool bParallelRecordable)
+      {
+         auto backBufferRes = frameGraph.AddExternalPermanentResource("BackBuffer", Elaina::BenchmarkBufferDescriptor{ BENCHMARK_BUFFER_SIZE }, backBuffer);
+         std::array<BenchmarkBufferResource*, FRAME_GRAPH_CHAINS> chainOutputs = { };
+         auto execute = [](const BenchmarkPassData& data) { ExecuteBenchmarkPass(data); };
+         auto submit = [](const BenchmarkPassData& data) { };
+
+         for (size_t passIdx = 0; passIdx < passes; ++passIdx)
+         {
+            size_t chain = passIdx % FRAME_GRAPH_CHAINS;
+            auto setup = [&chainOutputs, chain, passIdx](Elaina::RenderPassBuilder& builder, BenchmarkPassData& data)
+            {
+               if (chainOutputs[chain] != nullptr)
+               {
+                  data.Inputs.push_back(builder.Read(chainOutputs[chain]));
+               }
+
+               data.Output = builder.Create<BenchmarkBufferResource>("Buffer_" + std::to_string(passIdx), Elaina::BenchmarkBufferDescriptor{ BENCHMARK_BUFFER_SIZE });
+               chainOutputs[chain] = data.Output;
+            };
+
+            std::string passName = "Pass_" + std::to_string(passIdx);
+            if (bParallelRecordable)
+            {
+               frameGraph.AddCallbackPass<BenchmarkPassData>(passName, setup, execute, submit);
+            }
+            else
+            {
+               frameGraph.AddCallbackPass<BenchmarkPassData>(passName, setup, execute);
+            }
+         }
+
+         /** Resolve every chains into back buffer. */
+         frameGraph.AddCallbackPass<BenchmarkPassData>("Resolve",
+            [&chainOutputs, backBufferRes](Elaina::RenderPassBuilder& builder, BenchmarkPassData& data)
+            {
+               for (auto chainOutput : chainOutputs)
+               {
+                  if (chainOutput != nullptr)
+                  {
+                     data.Inputs.push_back(builder.Read(chainOutput));
+                  }
+               }
+
+               data.Output = builder.Write(backBufferRes);
+            }, execute);
+      }
+
+      /**
+       * @brief   Chains of passes where every third pass is not parallel recordable.
+       *          Parallel recordable passes mark themselves recorded, and every pass appends its index to submissions when submitted.
+       *          (Non recordable pass is executed at its submission slot.)
+       */
+      static void BuildOrderCheckFrameGraph(Elaina::FrameGraph& frameGraph, Elaina::BenchmarkBuffer* backBuffer, size_t passes,
+         std::vector<unsigned char>& recorded, std::vector<size_t>& submissions)
+      {
+         auto backBufferRes = frameGraph.AddExternalPermanentResource("BackBuffer", Elaina::BenchmarkBufferDescriptor{ BENCHMARK_BUFFER_SIZE }, backBuffer);
+         std::array<BenchmarkBufferResource*, FRAME_GRAPH_CHAINS> chainOutputs = { };
+         recorded.assign(passes, 0);
+         for (size_t passIdx = 0; passIdx < passes; ++passIdx)
+         {
+            size_t chain = passIdx % FRAME_GRAPH_CHAINS;
+            auto setup = [&chainOutputs, chain, passIdx](Elaina::RenderPassBuilder& builder, BenchmarkPassData& data)
+            {
+               if (chainOutputs[chain] != nullptr)
+               {
+                  data.Inputs.push_back(builder.Read(chainOutputs[chain]));
+               }
+
+               data.Output = builder.Create<BenchmarkBufferResource>("Buffer_" + std::to_string(passIdx), Elaina::BenchmarkBufferDescriptor{ BENCHMARK_BUFFER_SIZE });
+               chainOutputs[chain] = data.Output;
+            };
+
+            std::string passName = "Pass_" + std::to_string(passIdx);
+            if ((passIdx % 3) != 2)
+            {
+               /** Each pass marks only its own slot, so recording threads never share an element. */
+               frameGraph.AddCallbackPass<BenchmarkPassData>(passName, setup,
+                  [&recorded, passIdx](const BenchmarkPassData& data)
+                  {
+                     ExecuteBenchmarkPass(data);
+                     recorded[passIdx] = 1;
+                  },
+                  [&recorded, &submissions, passIdx](const BenchmarkPassData& data)
+                  {
+                     submissions.push_back(recorded[passIdx] ? passIdx : FRAME_GRAPH_NOT_RECORDED);
+                  });
+            }
+            else
+            {
+               frameGraph.AddCallbackPass<BenchmarkPassData>(passName, setup,
+                  [&submissions, passIdx](const BenchmarkPassData& data)
+                  {
+                     ExecuteBenchmarkPass(data);
+                     submissions.push_back(passIdx);
+                  });
+            }
+         }
+
+         frameGraph.AddCallbackPass<BenchmarkPassData>("Resolve",
+            [&chainOutputs, backBufferRes](Elaina::RenderPassBuilder& builder, BenchmarkPassData& data)
+            {
+               for (auto chainOutput : chainOutputs)
+               {
+                  if (chainOutput != nullptr)
+                  {
+                     data.Inputs.push_back(builder.Read(chainOutput));
+                  }
+               }
+
+               data.Output = builder.Write(backBufferRes);
+            },
+            [&submissions, passes](const BenchmarkPassData& data)
+            {
+               ExecuteBenchmarkPass(data);
+               submissions.push_back(passes);
+            });
+      }
+
+      struct FrameGraphState
+      {
+         Elaina::FrameGraph Graph;
+         Elaina::BenchmarkBuffer BackBuffer;
+      };
+
+      void RegisterFrameGraphBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.AddCheck("FrameGraph.ExecuteParallelSubmitOrder",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               /** Pass N depends on pass N - chains, so dependency levels follow declaration order;
+                   Submissions must be exactly in pass order, and every pass recorded before its submission. */
+               constexpr size_t passes = FRAME_GRAPH_CHAINS * 16;
+               FrameGraphState state;
+               state.BackBuffer.Data.resize(BENCHMARK_BUFFER_SIZE);
+               std::vector<unsigned char> recorded;
+               std::vector<size_t> submissions;
+               BuildOrderCheckFrameGraph(state.Graph, &state.BackBuffer, passes, recorded, submissions);
+
+               /** Second frame runs on compiled cache. */
+               for (size_t frame = 0; frame < 2; ++frame)
+               {
+                  std::fill(recorded.begin(), recorded.end(), 0);
+                  submissions.clear();
+                  state.Graph.Compile();
+                  state.Graph.ExecuteParallel(*env.Pool);
+
+                  if (submissions.size() != (passes + 1))
+                  {
+                     message = "Frame " + std::to_string(frame) + " : " + std::to_string(submissions.size()) +
+                        " passes submitted, expected " + std::to_string(passes + 1);
+                     return false;
+                  }
+
+                  for (size_t idx = 0; idx < submissions.size(); ++idx)
+                  {
+                     if (submissions[idx] != idx)
+                     {
+                        message = "Frame " + std::to_string(frame) + " : Submission " + std::to_string(idx) + " was " +
+                           ((submissions[idx] == FRAME_GRAPH_NOT_RECORDED) ? std::string("not recorded yet") : ("pass " + std::to_string(submissions[idx])));
+                        return false;
+                     }
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("ResourcePool.NotPoolable",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               Elaina::ResourcePool pool;
+               Elaina::BenchmarkBufferDescriptor desc;
+               desc.Size = BENCHMARK_BUFFER_SIZE;
+               desc.bIsExternal = true;
+
+               /** Longer than MaxIdleFrames; Not poolable actual must not linger in pool nor count as miss on every frame. */
+               for (size_t frame = 0; frame <= (pool.GetMaxIdleFrames() + 1); ++frame)
+               {
+                  pool.NextFrame();
+                  Elaina::BenchmarkBuffer* actual = pool.Acquire<Elaina::BenchmarkBufferDescriptor, Elaina::BenchmarkBuffer>(desc);
+                  if (actual == nullptr || actual->Data.size() != desc.Size)
+                  {
+                     message = "Frame " + std::to_string(frame) + " : Failed to realize not poolable actual";
+                     return false;
+                  }
+
+                  pool.Release<Elaina::BenchmarkBufferDescriptor, Elaina::BenchmarkBuffer>(desc, actual);
+                  const Elaina::ResourcePoolStats& stats = pool.GetStats();
+                  if (actual != nullptr || stats.Misses != 0 || stats.Hits != 0 || stats.LiveResources != 0 || stats.IdleResources != 0)
+                  {
+                     message = "Frame " + std::to_string(frame) + " : " + std::to_string(stats.Misses) + " misses, " +
+                        std::to_string(stats.LiveResources) + " live resources, " + std::to_string(stats.IdleResources) +
+                        " idle resources; Not poolable actual must be deleted right on release";
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.Add("FrameGraph.BuildAndCompile", FRAME_GRAPH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = std::make_shared<FrameGraphState>();
+               state->BackBuffer.Data.resize(BENCHMARK_BUFFER_SIZE);
+               return [state, scale]()
+               {
+                  state->Graph.Clear();
+                  BuildFrameGraph(state->Graph, &state->BackBuffer, scale, false);
+                  state->Graph.Compile();
+               };
+            });
+
+         runner.Add("FrameGraph.Execute", FRAME_GRAPH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = std::make_shared<FrameGraphState>();
+               state->BackBuffer.Data.resize(BENCHMARK_BUFFER_SIZE);
+               BuildFrameGraph(state->Graph, &state->BackBuffer, scale, false);
+               return [state]()
+               {
+                  /** Structure does not change, so compile hits cache. */
+                  state->Graph.Compile();
+                  state->Graph.Execute();
+               };
+            });
+
+         runner.Add("FrameGraph.ExecuteParallel", FRAME_GRAPH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = std::make_shared<FrameGraphState>();
+               state->BackBuffer.Data.resize(BENCHMARK_BUFFER_SIZE);
+               BuildFrameGraph(state->Graph, &state->BackBuffer, scale, true);
+               ThreadPool* threadPool = env.Pool;
+               return [state, threadPool]()
+               {
+                  state->Graph.Compile();
+                  state->Graph.ExecuteParallel(*threadPool);
+               };
+            });
+      }
+   }
+}
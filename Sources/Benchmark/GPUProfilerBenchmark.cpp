@@ -0,0 +1,170 @@
+#include "Benchmark.h"
+#include "Rendering/GPUProfiler.h"
+#include "Rendering/GPUTimestampSource.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      static const std::vector<size_t> GPU_PROFILER_SCOPE_SCALES = { 8, 64, 512 };
+      constexpr UINT64 GPU_PROFILER_FAKE_FREQUENCY = 1000000;
+      /** 1000 ticks of fake clock, 1ms. */
+      constexpr UINT64 GPU_PROFILER_SCOPE_TICKS = 1000;
+      constexpr double GPU_PROFILER_EPSILON = 1.0e-9;
+
+      /** Profiler and fake timestamp source which is still owned by profiler. */
+      struct FakeGPUProfiler
+      {
+         FakeGPUTimestampSource* Source = nullptr;
+         std::unique_ptr<GPUProfiler> Profiler;
+         GPUProfileScopeID Scope = INVALID_GPU_PROFILE_SCOPE;
+      };
+
+      static FakeGPUProfiler CreateFakeProfiler(UINT64 queryLatency, size_t readyLatency)
+      {
+         FakeGPUProfiler fake;
+         auto source = std::make_unique<FakeGPUTimestampSource>(GPU_PROFILER_FAKE_FREQUENCY);
+         fake.Source = source.get();
+         fake.Source->SetReadyLatency(readyLatency);
+         fake.Profiler = std::make_unique<GPUProfiler>(std::move(source), 0);
+         fake.Profiler->SetQueryLatency(queryLatency);
+         fake.Scope = fake.Profiler->RegisterScope("Scope");
+         return fake;
+      }
+
+      /** One frame which measures scope for GPU_PROFILER_SCOPE_TICKS. */
+      static void RunFakeFrame(FakeGPUProfiler& fake)
+      {
+         fake.Profiler->BeginFrame();
+         fake.Profiler->Begin(fake.Scope);
+         fake.Source->Advance(GPU_PROFILER_SCOPE_TICKS);
+         fake.Profiler->End(fake.Scope);
+         fake.Profiler->EndFrame();
+      }
+
+      static double GetSamples(const FakeGPUProfiler& fake)
+      {
+         return fake.Profiler->GetScopes()[fake.Scope].Times.Samples;
+      }
+
+      void RegisterGPUProfilerBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.AddCheck("GPUProfiler.ReadyLatency",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               /** Results which are ready within query latency are resolved readyLatency frames late, never dropped. */
+               constexpr UINT64 queryLatency = 5;
+               constexpr size_t readyLatency = 3;
+               constexpr size_t frames = 20;
+               FakeGPUProfiler fake = CreateFakeProfiler(queryLatency, readyLatency);
+               for (size_t frame = 1; frame <= frames; ++frame)
+               {
+                  RunFakeFrame(fake);
+                  double expectedSamples = static_cast<double>((frame > readyLatency) ? (frame - readyLatency) : 0);
+                  if (GetSamples(fake) != expectedSamples)
+                  {
+                     message = "Frame " + std::to_string(frame) + " : " + std::to_string(GetSamples(fake)) +
+                        " samples, expected " + std::to_string(expectedSamples);
+                     return false;
+                  }
+               }
+
+               if (fake.Profiler->GetDroppedFrames() != 0)
+               {
+                  message = std::to_string(fake.Profiler->GetDroppedFrames()) + " frames dropped, expected 0";
+                  return false;
+               }
+
+               const auto& times = fake.Profiler->GetScopes()[fake.Scope].Times;
+               double expectedMS = (static_cast<double>(GPU_PROFILER_SCOPE_TICKS) / GPU_PROFILER_FAKE_FREQUENCY) * 1000.0;
+               if (std::abs(times.AvgTime - expectedMS) > GPU_PROFILER_EPSILON || std::abs(times.RecentElapsed - expectedMS) > GPU_PROFILER_EPSILON)
+               {
+                  message = "Average " + std::to_string(times.AvgTime) + "ms, expected " + std::to_string(expectedMS) + "ms";
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("GPUProfiler.DroppedFrames",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               /** Ring has (queryLatency + 1) slots; Every frame which is not ready until its slot is reused is dropped. */
+               constexpr UINT64 queryLatency = 2;
+               constexpr size_t readyLatency = 4;
+               constexpr size_t frames = 20;
+               FakeGPUProfiler fake = CreateFakeProfiler(queryLatency, readyLatency);
+               for (size_t frame = 0; frame < frames; ++frame)
+               {
+                  RunFakeFrame(fake);
+               }
+
+               UINT64 expectedDropped = frames - (queryLatency + 1);
+               if (fake.Profiler->GetDroppedFrames() != expectedDropped || GetSamples(fake) != 0.0)
+               {
+                  message = std::to_string(fake.Profiler->GetDroppedFrames()) + " frames dropped and " +
+                     std::to_string(GetSamples(fake)) + " samples, expected " + std::to_string(expectedDropped) + " and 0";
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("GPUProfiler.DisjointDiscard",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               /** Disjoint frames are resolved(not dropped) but their timestamps are discarded. */
+               constexpr size_t disjointFrames = 4;
+               constexpr size_t validFrames = 6;
+               FakeGPUProfiler fake = CreateFakeProfiler(DEFAULT_GPU_PROFILE_QUERY_LATENCY, 1);
+               fake.Source->SetDisjoint(true);
+               for (size_t frame = 0; frame < disjointFrames; ++frame)
+               {
+                  RunFakeFrame(fake);
+               }
+
+               fake.Source->SetDisjoint(false);
+               for (size_t frame = 0; frame < validFrames; ++frame)
+               {
+                  RunFakeFrame(fake);
+               }
+
+               /** Last valid frame is not ready yet due to ready latency. */
+               double expectedSamples = static_cast<double>(validFrames - 1);
+               if (GetSamples(fake) != expectedSamples || fake.Profiler->GetDroppedFrames() != 0)
+               {
+                  message = std::to_string(GetSamples(fake)) + " samples and " + std::to_string(fake.Profiler->GetDroppedFrames()) +
+                     " frames dropped, expected " + std::to_string(expectedSamples) + " and 0";
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.Add("GPUProfiler.BeginEnd", GPU_PROFILER_SCOPE_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto fake = std::make_shared<FakeGPUProfiler>(CreateFakeProfiler(DEFAULT_GPU_PROFILE_QUERY_LATENCY, 2));
+               auto scopes = std::make_shared<std::vector<GPUProfileScopeID>>();
+               for (size_t idx = 0; idx < scale; ++idx)
+               {
+                  scopes->push_back(fake->Profiler->RegisterScope("Scope" + std::to_string(idx)));
+               }
+
+               return [fake, scopes]()
+               {
+                  fake->Profiler->BeginFrame();
+                  for (GPUProfileScopeID scope : (*scopes))
+                  {
+                     fake->Profiler->Begin(scope);
+                     fake->Source->Advance(GPU_PROFILER_SCOPE_TICKS);
+                     fake->Profiler->End(scope);
+                  }
+                  fake->Profiler->EndFrame();
+
+                  DoNotOptimize(fake->Profiler->GetProfileOverallTime());
+               };
+            });
+      }
+   }
+}
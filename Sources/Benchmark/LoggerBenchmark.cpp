@@ -0,0 +1,194 @@
+/** Same in every configuration; Logs more verbose than Display are compiled out in this file. */
+#define ME_LOG_COMPILE_TIME_VERBOSITY ELogVerbosity::Display
+#include "Benchmark.h"
+#include "Core/Logger.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      DECLARE_LOG_CATEGORY_STATIC(MileBenchmark, Log);
+
+      static const std::vector<size_t> LOGGER_SCALES = { 1000, 10000, 100000 };
+      constexpr size_t LOGGER_PRODUCER_THREADS = 16;
+
+      /** Each benchmark streams into its own log file under BenchmarkLogs folder. */
+      static std::shared_ptr<Logger> CreateBenchmarkLogger(Context* context)
+      {
+         auto logger = std::make_shared<Logger>(context);
+         logger->SetLogFolderPath(TEXT("BenchmarkLogs/"));
+         logger->Init();
+         return logger;
+      }
+
+      /**
+       * @brief   Fixed set of threads which run same job together on each run.
+       *          Threads live as long as the set, so every producer keeps its own ring buffer of logger across runs.
+       */
+      class ProducerThreads
+      {
+      public:
+         using Job = std::function<void(size_t threadIdx)>;
+
+         ProducerThreads(size_t threadsNum, Job job) :
+            m_job(std::move(job)),
+            m_generation(0),
+            m_runningThreads(0),
+            m_bStop(false)
+         {
+            for (size_t idx = 0; idx < threadsNum; ++idx)
+            {
+               m_threads.emplace_back([this, idx]() { ThreadLoop(idx); });
+            }
+         }
+
+         ~ProducerThreads()
+         {
+            {
+               std::lock_guard<std::mutex> lock(m_mutex);
+               m_bStop = true;
+            }
+
+            m_startCondition.notify_all();
+            for (std::thread& thread : m_threads)
+            {
+               thread.join();
+            }
+         }
+
+         /** Run job on every thread and wait until all of them have been done. */
+         void Run()
+         {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_runningThreads = m_threads.size();
+            ++m_generation;
+            m_startCondition.notify_all();
+            m_doneCondition.wait(lock, [this]() { return m_runningThreads == 0; });
+         }
+
+      private:
+         void ThreadLoop(size_t threadIdx)
+         {
+            size_t generation = 0;
+            while (true)
+            {
+               {
+                  std::unique_lock<std::mutex> lock(m_mutex);
+                  m_startCondition.wait(lock, [this, generation]() { return m_bStop || m_generation != generation; });
+                  if (m_bStop)
+                  {
+                     return;
+                  }
+
+                  generation = m_generation;
+               }
+
+               m_job(threadIdx);
+
+               std::lock_guard<std::mutex> lock(m_mutex);
+               if (--m_runningThreads == 0)
+               {
+                  m_doneCondition.notify_one();
+               }
+            }
+         }
+
+      private:
+         Job m_job;
+         std::vector<std::thread> m_threads;
+         std::mutex m_mutex;
+         std::condition_variable m_startCondition;
+         std::condition_variable m_doneCondition;
+         size_t m_generation;
+         size_t m_runningThreads;
+         bool m_bStop;
+
+      };
+
+      void RegisterLoggerBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.Add("Logger.Logging", LOGGER_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto logger = CreateBenchmarkLogger(env.EngineContext);
+               return [logger, scale]()
+               {
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     logger->Logging(MileBenchmark, ELogVerbosity::Log, TEXT("Benchmark log %zu : %f"), idx, static_cast<double>(idx) * 0.5);
+                  }
+
+                  logger->Flush();
+               };
+            });
+
+         /** Exactly LOGGER_PRODUCER_THREADS threads log at once, independent from size of engine thread pool. */
+         runner.Add("Logger.LoggingParallel", LOGGER_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto logger = CreateBenchmarkLogger(env.EngineContext);
+               auto producers = std::make_shared<ProducerThreads>(LOGGER_PRODUCER_THREADS,
+                  [logger, scale](size_t threadIdx)
+                  {
+                     size_t begin = (scale * threadIdx) / LOGGER_PRODUCER_THREADS;
+                     size_t end = (scale * (threadIdx + 1)) / LOGGER_PRODUCER_THREADS;
+                     for (size_t idx = begin; idx < end; ++idx)
+                     {
+                        logger->Logging(MileBenchmark, ELogVerbosity::Log, TEXT("Benchmark log %zu : %f"), idx, static_cast<double>(idx) * 0.5);
+                     }
+                  });
+
+               return [logger, producers]()
+               {
+                  producers->Run();
+                  logger->Flush();
+               };
+            });
+
+         /** Baseline of suppressed logging benchmarks; Same loop without log call site. */
+         runner.Add("Logger.EmptyLoop", LOGGER_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               return [scale]()
+               {
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     DoNotOptimize(idx);
+                  }
+               };
+            });
+
+         /** Log call site which is compiled in, but suppressed by runtime verbosity of category before formatting. */
+         runner.Add("Logger.SuppressedAtRuntime", LOGGER_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               return [scale]()
+               {
+                  MileBenchmark.SetRuntimeVerbosity(ELogVerbosity::Warning);
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     DoNotOptimize(idx);
+                     ME_LOG(MileBenchmark, Display, TEXT("Benchmark log %zu : %f"), idx, static_cast<double>(idx) * 0.5);
+                  }
+
+                  MileBenchmark.SetRuntimeVerbosity(ELogVerbosity::Log);
+               };
+            });
+
+         /** Log call site which is more verbose than ME_LOG_COMPILE_TIME_VERBOSITY; Expected to be same as empty loop. */
+         runner.Add("Logger.SuppressedAtCompileTime", LOGGER_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               static_assert(ELogVerbosity::Log > ME_LOG_COMPILE_TIME_VERBOSITY, "Log must be compiled out.");
+               return [scale]()
+               {
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     DoNotOptimize(idx);
+                     ME_LOG(MileBenchmark, Log, TEXT("Benchmark log %zu : %f"), idx, static_cast<double>(idx) * 0.5);
+                  }
+               };
+            });
+      }
+   }
+}
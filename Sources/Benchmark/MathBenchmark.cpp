@@ -0,0 +1,379 @@
+#include "Benchmark.h"
+#include "Math/MathMinimal.h"
+#include "Math/Matrix.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      static const std::vector<size_t> MATH_SCALES = { 1000, 10000, 100000, 1000000 };
+      constexpr size_t MATH_CHECK_SAMPLES = 1000;
+      /** Relative to magnitude of result(at least 1). Multiply and transform are same order of operations as scalar. */
+      constexpr float MATH_CHECK_EPSILON = 1.0e-5f;
+      /** Vector inverse accumulates cofactors in different order from scalar. */
+      constexpr float MATH_CHECK_INVERSE_EPSILON = 1.0e-4f;
+
+      struct MathState
+      {
+         std::vector<Vector3> Positions;
+         std::vector<Vector3> Scales;
+         std::vector<Quaternion> Rotations;
+         std::vector<Quaternion> Interpolated;
+         std::vector<Matrix> Matrices;
+         std::vector<Matrix> Results;
+      };
+
+      static std::shared_ptr<MathState> CreateMathState(size_t num)
+      {
+         auto state = std::make_shared<MathState>();
+         state->Positions.reserve(num);
+         state->Scales.reserve(num);
+         state->Rotations.reserve(num);
+         state->Matrices.reserve(num);
+         state->Results.resize(num);
+         state->Interpolated.resize(num);
+
+         std::mt19937 generator(static_cast<unsigned int>(num));
+         std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+         for (size_t idx = 0; idx < num; ++idx)
+         {
+            Vector3 position(distribution(generator), distribution(generator), distribution(generator));
+            Vector3 scale(1.0f + std::abs(distribution(generator)) * 0.01f, 1.0f, 1.0f);
+            Quaternion rotation(distribution(generator), Vector3(distribution(generator), 1.0f, distribution(generator)));
+            state->Positions.push_back(position);
+            state->Scales.push_back(scale);
+            state->Rotations.push_back(rotation);
+            state->Matrices.push_back(Matrix::CreateTransformMatrix(position, scale, rotation));
+         }
+
+         return state;
+      }
+
+      static bool CompareKernelResults(const char* kernel, size_t sample, const float* vectorResult, const float* scalarResult, size_t num, float epsilon, std::string& message)
+      {
+         for (size_t idx = 0; idx < num; ++idx)
+         {
+            float tolerance = epsilon * std::max({ 1.0f, std::abs(vectorResult[idx]), std::abs(scalarResult[idx]) });
+            if (!(std::abs(vectorResult[idx] - scalarResult[idx]) <= tolerance))
+            {
+               message = std::string(kernel) + " sample " + std::to_string(sample) + " element " + std::to_string(idx) + " : " +
+                  std::to_string(vectorResult[idx]) + " (vector) != " + std::to_string(scalarResult[idx]) + " (scalar)";
+               return false;
+            }
+         }
+
+         return true;
+      }
+
+      /** Interpolation target of sample; Every fourth target is nearly parallel, where Slerp falls back to linear interpolation. */
+      static Quaternion GetSlerpTarget(const MathState& state, size_t idx)
+      {
+         if ((idx % 4) == 0)
+         {
+            Quaternion target = state.Rotations[idx];
+            return target.Rotate(Quaternion(0.5f, Vector3::Up()));
+         }
+
+         return state.Rotations[(idx + 1) % state.Rotations.size()];
+      }
+
+      /** Samples cover both ends of interpolation. */
+      static float GetSlerpFactor(size_t idx)
+      {
+         return static_cast<float>(idx % 9) / 8.0f;
+      }
+
+      /** Same steps as Quaternion::Slerp with scalar kernel. */
+      static void ScalarSlerp(const Quaternion& from, const Quaternion& to, float t, float* out)
+      {
+         float cosTheta = from.Dot(to);
+         float toFactor = 1.0f;
+         if (cosTheta < 0.0f)
+         {
+            cosTheta = -cosTheta;
+            toFactor = -1.0f;
+         }
+
+         float fromWeight = 1.0f - t;
+         float toWeight = t;
+         if (cosTheta < 0.9995f)
+         {
+            float theta = std::acos(cosTheta);
+            float sinThetaInv = 1.0f / std::sin(theta);
+            fromWeight = std::sin(fromWeight * theta) * sinThetaInv;
+            toWeight = std::sin(toWeight * theta) * sinThetaInv;
+         }
+
+         SIMD::Scalar::Blend4(from.elements, fromWeight, to.elements, toWeight * toFactor, out);
+         float normInv = 1.0f / std::sqrt((out[0] * out[0]) + (out[1] * out[1]) + (out[2] * out[2]) + (out[3] * out[3]));
+         for (size_t idx = 0; idx < 4; ++idx)
+         {
+            out[idx] *= normInv;
+         }
+      }
+
+      void RegisterMathBenchmarks(BenchmarkRunner& runner)
+      {
+         /** Vector kernels against scalar kernels. Same result on build without vector instruction set. */
+         runner.AddCheck("Math.SIMDMatrixMultiply",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               auto state = CreateMathState(MATH_CHECK_SAMPLES);
+               for (size_t idx = 0; idx < state->Matrices.size(); ++idx)
+               {
+                  const float* lhs = state->Matrices[idx].Data();
+                  const float* rhs = state->Matrices[(idx + 1) % state->Matrices.size()].Data();
+                  float vectorResult[16];
+                  float scalarResult[16];
+                  SIMD::MatrixMultiply(lhs, rhs, vectorResult);
+                  SIMD::Scalar::MatrixMultiply(lhs, rhs, scalarResult);
+                  if (!CompareKernelResults("MatrixMultiply", idx, vectorResult, scalarResult, 16, MATH_CHECK_EPSILON, message))
+                  {
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("Math.SIMDMatrixInverse",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               auto state = CreateMathState(MATH_CHECK_SAMPLES);
+               for (size_t idx = 0; idx < state->Matrices.size(); ++idx)
+               {
+                  const float* mat = state->Matrices[idx].Data();
+                  float vectorResult[16];
+                  float scalarResult[16];
+                  bool bVectorInversed = SIMD::MatrixInverse(mat, vectorResult);
+                  bool bScalarInversed = SIMD::Scalar::MatrixInverse(mat, scalarResult);
+                  if (bVectorInversed != bScalarInversed)
+                  {
+                     message = "MatrixInverse sample " + std::to_string(idx) + " : Singularity mismatch";
+                     return false;
+                  }
+
+                  if (bVectorInversed && !CompareKernelResults("MatrixInverse", idx, vectorResult, scalarResult, 16, MATH_CHECK_INVERSE_EPSILON, message))
+                  {
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("Math.SIMDVectorTransform",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               auto state = CreateMathState(MATH_CHECK_SAMPLES);
+               for (size_t idx = 0; idx < state->Matrices.size(); ++idx)
+               {
+                  const float* mat = state->Matrices[idx].Data();
+                  const Vector3& position = state->Positions[idx];
+                  const float vec[4] = { position.x, position.y, position.z, 1.0f };
+                  float vectorResult[4];
+                  float scalarResult[4];
+                  SIMD::VectorTransform(vec, mat, vectorResult);
+                  SIMD::Scalar::VectorTransform(vec, mat, scalarResult);
+                  if (!CompareKernelResults("VectorTransform", idx, vectorResult, scalarResult, 4, MATH_CHECK_EPSILON, message))
+                  {
+                     return false;
+                  }
+
+                  float vectorPoint[3];
+                  float scalarPoint[3];
+                  SIMD::TransformPoints(vec, 1, mat, vectorPoint);
+                  SIMD::Scalar::TransformPoints(vec, 1, mat, scalarPoint);
+                  if (!CompareKernelResults("TransformPoints", idx, vectorPoint, scalarPoint, 3, MATH_CHECK_EPSILON, message))
+                  {
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("Math.SIMDQuaternionMultiply",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               auto state = CreateMathState(MATH_CHECK_SAMPLES);
+               for (size_t idx = 0; idx < state->Rotations.size(); ++idx)
+               {
+                  const float* lhs = state->Rotations[idx].elements;
+                  const float* rhs = state->Rotations[(idx + 1) % state->Rotations.size()].elements;
+                  float vectorResult[4];
+                  float scalarResult[4];
+                  SIMD::QuaternionMultiply(lhs, rhs, vectorResult);
+                  SIMD::Scalar::QuaternionMultiply(lhs, rhs, scalarResult);
+                  if (!CompareKernelResults("QuaternionMultiply", idx, vectorResult, scalarResult, 4, MATH_CHECK_EPSILON, message))
+                  {
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("Math.SIMDBlend4",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               auto state = CreateMathState(MATH_CHECK_SAMPLES);
+               for (size_t idx = 0; idx < state->Rotations.size(); ++idx)
+               {
+                  const float* lhs = state->Rotations[idx].elements;
+                  const float* rhs = state->Rotations[(idx + 1) % state->Rotations.size()].elements;
+                  float lhsFactor = state->Positions[idx].x;
+                  float rhsFactor = state->Positions[idx].y;
+                  float vectorResult[4];
+                  float scalarResult[4];
+                  SIMD::Blend4(lhs, lhsFactor, rhs, rhsFactor, vectorResult);
+                  SIMD::Scalar::Blend4(lhs, lhsFactor, rhs, rhsFactor, scalarResult);
+                  if (!CompareKernelResults("Blend4", idx, vectorResult, scalarResult, 4, MATH_CHECK_EPSILON, message))
+                  {
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("Math.SIMDQuaternionSlerp",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               auto state = CreateMathState(MATH_CHECK_SAMPLES);
+               for (size_t idx = 0; idx < state->Rotations.size(); ++idx)
+               {
+                  const Quaternion& from = state->Rotations[idx];
+                  Quaternion to = GetSlerpTarget(*state, idx);
+                  float t = GetSlerpFactor(idx);
+                  Quaternion vectorResult = Quaternion::Slerp(from, to, t);
+                  float scalarResult[4];
+                  ScalarSlerp(from, to, t, scalarResult);
+                  if (!CompareKernelResults("QuaternionSlerp", idx, vectorResult.elements, scalarResult, 4, MATH_CHECK_EPSILON, message))
+                  {
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.Add("Math.MatrixMultiply", MATH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = CreateMathState(scale);
+               return [state]()
+               {
+                  const Matrix& view = state->Matrices.front();
+                  for (size_t idx = 0; idx < state->Matrices.size(); ++idx)
+                  {
+                     state->Results[idx] = state->Matrices[idx] * view;
+                  }
+
+                  DoNotOptimize(state->Results.back().Data()[0]);
+               };
+            });
+
+         runner.Add("Math.MatrixInverse", MATH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = CreateMathState(scale);
+               return [state]()
+               {
+                  for (size_t idx = 0; idx < state->Matrices.size(); ++idx)
+                  {
+                     state->Results[idx] = state->Matrices[idx].Inversed();
+                  }
+
+                  DoNotOptimize(state->Results.back().Data()[0]);
+               };
+            });
+
+         runner.Add("Math.VectorTransform", MATH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = CreateMathState(scale);
+               return [state]()
+               {
+                  float sum = 0.0f;
+                  for (size_t idx = 0; idx < state->Positions.size(); ++idx)
+                  {
+                     Vector3 transformed = state->Positions[idx] * state->Matrices[idx];
+                     sum += transformed.x;
+                  }
+
+                  DoNotOptimize(sum);
+               };
+            });
+
+         runner.Add("Math.CreateTransformMatrix", MATH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = CreateMathState(scale);
+               return [state]()
+               {
+                  for (size_t idx = 0; idx < state->Positions.size(); ++idx)
+                  {
+                     state->Results[idx] = Matrix::CreateTransformMatrix(state->Positions[idx], state->Scales[idx], state->Rotations[idx]);
+                  }
+
+                  DoNotOptimize(state->Results.back().Data()[0]);
+               };
+            });
+
+         runner.Add("Math.QuaternionRotate", MATH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = CreateMathState(scale);
+               return [state]()
+               {
+                  const Quaternion step(0.1f, Vector3::Up());
+                  for (Quaternion& rotation : state->Rotations)
+                  {
+                     rotation.Rotate(step);
+                  }
+
+                  DoNotOptimize(state->Rotations.back().w);
+               };
+            });
+
+         runner.Add("Math.Blend4", MATH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = CreateMathState(scale);
+               return [state]()
+               {
+                  const Quaternion& target = state->Rotations.front();
+                  for (size_t idx = 0; idx < state->Rotations.size(); ++idx)
+                  {
+                     SIMD::Blend4(state->Rotations[idx].elements, 0.75f, target.elements, 0.25f, state->Interpolated[idx].elements);
+                  }
+
+                  DoNotOptimize(state->Interpolated.back().w);
+               };
+            });
+
+         runner.Add("Math.QuaternionSlerp", MATH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = CreateMathState(scale);
+               auto targets = std::make_shared<std::vector<Quaternion>>();
+               targets->reserve(scale);
+               for (size_t idx = 0; idx < scale; ++idx)
+               {
+                  targets->push_back(GetSlerpTarget(*state, idx));
+               }
+
+               return [state, targets]()
+               {
+                  for (size_t idx = 0; idx < state->Rotations.size(); ++idx)
+                  {
+                     state->Interpolated[idx] = Quaternion::Slerp(state->Rotations[idx], (*targets)[idx], GetSlerpFactor(idx));
+                  }
+
+                  DoNotOptimize(state->Interpolated.back().w);
+               };
+            });
+      }
+   }
+}
@@ -0,0 +1,214 @@
+#include "Benchmark.h"
+#include "Resource/MeshOptimizer.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      /** Number of triangles of mesh. */
+      static const std::vector<size_t> MESH_OPTIMIZER_SCALES = { 1000, 10000, 100000 };
+      /** Quads per side of check meshes; Welded vertices of large grid do not fit in 16 bit indices. */
+      constexpr size_t MESH_OPTIMIZER_SMALL_GRID = 64;
+      constexpr size_t MESH_OPTIMIZER_LARGE_GRID = 256;
+
+      /** Position must be at beginning of vertex. */
+      struct MeshOptimizerVertex
+      {
+         float Position[3];
+         float TexCoord[2];
+      };
+
+      using CanonicalTriangle = std::array<float, 15>;
+
+      struct MeshOptimizerMesh
+      {
+         std::vector<MeshOptimizerVertex> Vertices;
+         std::vector<unsigned int> Indices;
+      };
+
+      /**
+      * Grid of quads where every quad has its own 4 vertices, same as importer output before welding.
+      * Triangles are shuffled, so input order has poor vertex cache locality.
+      */
+      static MeshOptimizerMesh CreateGridMesh(size_t gridSize)
+      {
+         MeshOptimizerMesh mesh;
+         mesh.Vertices.reserve(gridSize * gridSize * 4);
+         std::vector<std::array<unsigned int, 3>> triangles;
+         triangles.reserve(gridSize * gridSize * 2);
+         for (size_t y = 0; y < gridSize; ++y)
+         {
+            for (size_t x = 0; x < gridSize; ++x)
+            {
+               unsigned int first = static_cast<unsigned int>(mesh.Vertices.size());
+               for (size_t corner = 0; corner < 4; ++corner)
+               {
+                  float cornerX = static_cast<float>(x + (corner & 1));
+                  float cornerY = static_cast<float>(y + (corner >> 1));
+                  float height = std::sin(cornerX * 0.1f) * std::cos(cornerY * 0.1f);
+                  mesh.Vertices.push_back({ { cornerX, height, cornerY }, { cornerX / gridSize, cornerY / gridSize } });
+               }
+
+               triangles.push_back({ first, first + 2, first + 1 });
+               triangles.push_back({ first + 1, first + 2, first + 3 });
+            }
+         }
+
+         std::mt19937 generator(static_cast<unsigned int>(gridSize));
+         std::shuffle(triangles.begin(), triangles.end(), generator);
+         mesh.Indices.reserve(triangles.size() * 3);
+         for (const auto& triangle : triangles)
+         {
+            mesh.Indices.insert(mesh.Indices.end(), triangle.begin(), triangle.end());
+         }
+
+         return mesh;
+      }
+
+      static size_t GetGridSize(size_t triangleNum)
+      {
+         return std::max<size_t>(static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(triangleNum) * 0.5))), 1);
+      }
+
+      /** Triangles by value of their vertices, rotated to start from smallest corner so winding is kept. */
+      static std::vector<CanonicalTriangle> GetCanonicalTriangles(const MeshOptimizerMesh& mesh)
+      {
+         constexpr size_t floatsPerVertex = sizeof(MeshOptimizerVertex) / sizeof(float);
+         std::vector<CanonicalTriangle> triangles(mesh.Indices.size() / 3);
+         for (size_t triangle = 0; triangle < triangles.size(); ++triangle)
+         {
+            std::array<std::array<float, floatsPerVertex>, 3> corners;
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+               std::memcpy(corners[corner].data(), &mesh.Vertices[mesh.Indices[triangle * 3 + corner]], sizeof(MeshOptimizerVertex));
+            }
+
+            size_t first = std::distance(corners.begin(), std::min_element(corners.begin(), corners.end()));
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+               const auto& source = corners[(first + corner) % 3];
+               std::copy(source.begin(), source.end(), triangles[triangle].begin() + corner * floatsPerVertex);
+            }
+         }
+
+         std::sort(triangles.begin(), triangles.end());
+         return triangles;
+      }
+
+      void RegisterMeshOptimizerBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.AddCheck("MeshOptimizer.SameTriangles",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               MeshOptimizerMesh mesh = CreateGridMesh(MESH_OPTIMIZER_SMALL_GRID);
+               std::vector<CanonicalTriangle> expected = GetCanonicalTriangles(mesh);
+               MeshOptimizer::Optimize(mesh.Vertices, mesh.Indices);
+               if (GetCanonicalTriangles(mesh) != expected)
+               {
+                  message = "Optimized mesh has different set of triangles";
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("MeshOptimizer.VertexCacheNotWorse",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               for (size_t gridSize : { MESH_OPTIMIZER_SMALL_GRID, MESH_OPTIMIZER_LARGE_GRID })
+               {
+                  MeshOptimizerMesh mesh = CreateGridMesh(gridSize);
+                  VertexCacheStatistics before = MeshOptimizer::AnalyzeVertexCache(mesh.Indices, mesh.Vertices.size());
+                  MeshOptimizer::Optimize(mesh.Vertices, mesh.Indices);
+                  VertexCacheStatistics after = MeshOptimizer::AnalyzeVertexCache(mesh.Indices, mesh.Vertices.size());
+                  if (after.ACMR > before.ACMR)
+                  {
+                     message = "ACMR " + std::to_string(before.ACMR) + " -> " + std::to_string(after.ACMR) +
+                        " on " + std::to_string(gridSize) + "x" + std::to_string(gridSize) + " grid";
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("MeshOptimizer.IndicesInRange",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               for (size_t gridSize : { MESH_OPTIMIZER_SMALL_GRID, MESH_OPTIMIZER_LARGE_GRID })
+               {
+                  MeshOptimizerMesh mesh = CreateGridMesh(gridSize);
+                  size_t indexNum = mesh.Indices.size();
+                  MeshOptimizer::Optimize(mesh.Vertices, mesh.Indices);
+
+                  /** Vertex fetch remap drops unreferenced vertices, so every vertex must be referenced. */
+                  std::vector<bool> referenced(mesh.Vertices.size(), false);
+                  for (unsigned int index : mesh.Indices)
+                  {
+                     if (index >= mesh.Vertices.size())
+                     {
+                        message = "Index " + std::to_string(index) + " is out of " + std::to_string(mesh.Vertices.size()) + " vertices";
+                        return false;
+                     }
+
+                     referenced[index] = true;
+                  }
+
+                  if (mesh.Indices.size() != indexNum || std::find(referenced.begin(), referenced.end(), false) != referenced.end())
+                  {
+                     message = std::to_string(mesh.Indices.size()) + " indices, expected " + std::to_string(indexNum) + " indices referencing every vertex";
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("MeshOptimizer.16BitIndices",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               if (!MeshOptimizer::CanUse16BitIndices(0xffff) || MeshOptimizer::CanUse16BitIndices(0x10000))
+               {
+                  message = "16 bit indices must be used only for 65535 or less vertices";
+                  return false;
+               }
+
+               for (size_t gridSize : { MESH_OPTIMIZER_SMALL_GRID, MESH_OPTIMIZER_LARGE_GRID })
+               {
+                  MeshOptimizerMesh mesh = CreateGridMesh(gridSize);
+                  MeshOptimizer::Optimize(mesh.Vertices, mesh.Indices);
+                  bool bExpected16Bit = (gridSize + 1) * (gridSize + 1) <= 0xffff;
+                  if (MeshOptimizer::CanUse16BitIndices(mesh.Vertices.size()) != bExpected16Bit)
+                  {
+                     message = std::to_string(mesh.Vertices.size()) + " vertices of " + std::to_string(gridSize) + "x" + std::to_string(gridSize) +
+                        " grid " + (bExpected16Bit ? "must" : "must not") + " use 16 bit indices";
+                     return false;
+                  }
+
+                  /** Strip cut value must not appear in 16 bit index buffer. */
+                  unsigned int maxIndex = *std::max_element(mesh.Indices.begin(), mesh.Indices.end());
+                  if (bExpected16Bit && maxIndex >= 0xffff)
+                  {
+                     message = "Index " + std::to_string(maxIndex) + " does not fit in 16 bit index buffer";
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         /** Import time cost; Includes copy of source mesh. */
+         runner.Add("MeshOptimizer.Optimize", MESH_OPTIMIZER_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto source = std::make_shared<MeshOptimizerMesh>(CreateGridMesh(GetGridSize(scale)));
+               return [source]()
+               {
+                  MeshOptimizerMesh mesh = *source;
+                  MeshOptimizer::Optimize(mesh.Vertices, mesh.Indices);
+                  DoNotOptimize(mesh.Indices.size());
+               };
+            });
+      }
+   }
+}
@@ -0,0 +1,469 @@
+#include "Benchmark.h"
+#include "GameFramework/World.h"
+#include "GameFramework/Entity.h"
+#include "GameFramework/Transform.h"
+#include "Component/CameraComponent.h"
+#include "Component/LightComponent.h"
+#include "Component/MeshRenderComponent.h"
+#include "Rendering/RendererPBR.h"
+#include "Rendering/NullRenderDevice.h"
+#include "Rendering/Cube.h"
+#include "Rendering/Quad.h"
+#include "Resource/Material.h"
+#include "MT/ThreadPool.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      /** Number of mesh render components in scene. */
+      static const std::vector<size_t> RENDERER_SCALES = { 100, 1000, 10000 };
+      /** Number of draws of geometry pass. */
+      static const std::vector<size_t> INSTANCE_BATCH_SCALES = { 1000, 10000, 100000 };
+      /** Same as geometry pass; Each thread allocates contiguous draw ids. */
+      constexpr size_t INSTANCE_BATCH_ALLOCATIONS = 8;
+      constexpr size_t RENDERER_MATERIALS = 4;
+      constexpr size_t RENDERER_GOLDEN_MESHES = 16;
+      constexpr size_t RENDERER_INSTANCES_PER_PAIR = 8;
+      /** With multiple threads, meshes of each material are split across threads of geometry pass. */
+      static const std::vector<size_t> RENDERER_INSTANCING_THREADS = { 1, 4 };
+      /** Smaller than initial instance transform buffer of renderer, larger than any other buffer. */
+      constexpr size_t RENDERER_FALLBACK_MAXIMUM_BUFFER_SIZE = 64 * 1024;
+      /** Frames until every transient resource of frame graph has been realized once. */
+      constexpr size_t RENDERER_POOL_WARMUP_FRAMES = 2;
+      constexpr size_t RENDERER_POOL_STEADY_FRAMES = 8;
+      /** Relative to working directory, same as shaders. Run with --record-golden to record golden file again. */
+      constexpr wchar_t RENDERER_GOLDEN_FILE[] = TEXT("Contents/Benchmark/RendererPBR.Golden.txt");
+      constexpr wchar_t RENDERER_ACTUAL_FILE[] = TEXT("Contents/Benchmark/RendererPBR.Actual.txt");
+
+      /** Renderer which is not registered to context; Single thread keeps recorded command stream independent from machine. */
+      static std::unique_ptr<RendererPBR> CreateHeadlessRenderer(Context* context, size_t threads)
+      {
+         auto renderer = std::make_unique<RendererPBR>(context, threads);
+         if (!renderer->InitHeadless(std::make_unique<NullRenderDevice>(), BENCHMARK_RENDER_WIDTH, BENCHMARK_RENDER_HEIGHT))
+         {
+            return nullptr;
+         }
+
+         return renderer;
+      }
+
+      static NullRenderContext& GetNullImmediateContext(RendererPBR& renderer)
+      {
+         return static_cast<NullRenderDevice&>(renderer.GetDevice()).GetNullImmediateContext();
+      }
+
+      static void SetRecordingEnabled(RendererPBR& renderer, bool bEnabled)
+      {
+         GetNullImmediateContext(renderer).SetRecordingEnabled(bEnabled);
+         for (size_t idx = 0; idx < renderer.GetMaximumThreads(); ++idx)
+         {
+            static_cast<NullRenderContext&>(renderer.GetDeferredContext(idx)).SetRecordingEnabled(bEnabled);
+         }
+      }
+
+      /** @return   Commands which have been recorded into immediate context during the frame. */
+      static const RenderCommandBuffer& RenderFrame(RendererPBR& renderer, const World& world)
+      {
+         RenderCommandBuffer& commands = GetNullImmediateContext(renderer).GetCommandBuffer();
+         commands.Clear();
+         renderer.Render(world);
+         return commands;
+      }
+
+      /** Camera, directional light and meshes in front of camera. Adjacent meshes have different (mesh, material) pairs. */
+      static void PopulateScene(World& world, const std::vector<Mesh*>& meshes, const std::vector<Material*>& materials, size_t meshesNum)
+      {
+         world.Clear();
+         world.ReserveEntities(meshesNum + 2);
+         world.CreateEntity(TEXT("Camera"))->AddComponent<CameraComponent>();
+         world.CreateEntity(TEXT("Light"))->AddComponent<LightComponent>();
+         for (size_t idx = 0; idx < meshesNum; ++idx)
+         {
+            Entity* entity = world.CreateEntity(TEXT("Mesh"));
+            entity->GetTransform()->SetPosition(Vector3(
+               static_cast<float>(idx % 16) - 8.0f,
+               static_cast<float>((idx / 16) % 16) - 8.0f,
+               20.0f + static_cast<float>(idx / 256)));
+
+            auto meshRenderer = entity->AddComponent<MeshRenderComponent>();
+            meshRenderer->SetMesh(meshes[idx % meshes.size()]);
+            meshRenderer->SetMaterial(materials[(idx / meshes.size()) % materials.size()]);
+         }
+      }
+
+      /** Mesh render components without mesh; Only transforms are packed. */
+      static std::vector<MeshRenderComponent*> PopulateInstances(World& world, size_t instancesNum)
+      {
+         world.Clear();
+         world.ReserveEntities(instancesNum);
+         for (size_t idx = 0; idx < instancesNum; ++idx)
+         {
+            Entity* entity = world.CreateEntity(TEXT("Instance"));
+            entity->GetTransform()->SetPosition(Vector3(static_cast<float>(idx % 256), static_cast<float>(idx / 256), 20.0f));
+            entity->AddComponent<MeshRenderComponent>();
+         }
+
+         return world.GetComponentsFromEntities<MeshRenderComponent>();
+      }
+
+      /** Same view and projection as geometry pass; Allocations are packed in order. */
+      static void PackInstances(InstanceTransformBatch& batch, const std::vector<MeshRenderComponent*>& instances, ThreadPool* threadPool)
+      {
+         batch.Reset(
+            Matrix::CreateView(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 1.0f, 0.0f)),
+            Matrix::CreatePerspectiveProj(45.0f, BENCHMARK_RENDER_WIDTH / static_cast<float>(BENCHMARK_RENDER_HEIGHT), 0.1f, 1000.0f));
+
+         size_t firstDrawIDs[INSTANCE_BATCH_ALLOCATIONS] = { 0, };
+         size_t firstInstances[INSTANCE_BATCH_ALLOCATIONS + 1] = { 0, };
+         for (size_t idx = 0; idx < INSTANCE_BATCH_ALLOCATIONS; ++idx)
+         {
+            firstInstances[idx + 1] = (instances.size() * (idx + 1)) / INSTANCE_BATCH_ALLOCATIONS;
+            firstDrawIDs[idx] = batch.Allocate(firstInstances[idx + 1] - firstInstances[idx]);
+         }
+
+         auto pack = [&](size_t begin, size_t end)
+         {
+            for (size_t idx = begin; idx < end; ++idx)
+            {
+               batch.Pack(firstDrawIDs[idx], instances.data() + firstInstances[idx], firstInstances[idx + 1] - firstInstances[idx]);
+            }
+         };
+
+         if (threadPool != nullptr)
+         {
+            threadPool->ParallelFor(0, INSTANCE_BATCH_ALLOCATIONS, pack, 1);
+         }
+         else
+         {
+            pack(0, INSTANCE_BATCH_ALLOCATIONS);
+         }
+      }
+
+      /** Sum of instance counts of every instanced draw. */
+      static size_t CountInstances(const RenderCommandBuffer& commands)
+      {
+         size_t instances = 0;
+         for (const RenderCommand& command : commands.GetCommands())
+         {
+            if (command.Type == ERenderCommand::DrawIndexedInstanced)
+            {
+               instances += static_cast<size_t>(command.Args[1]);
+            }
+         }
+
+         return instances;
+      }
+
+      static bool ReadTextFile(const String& filePath, std::string& text)
+      {
+         std::ifstream stream{ std::filesystem::path(filePath) };
+         if (!stream.is_open())
+         {
+            return false;
+         }
+
+         text.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+         return true;
+      }
+
+      static size_t FindFirstDifferentLine(const std::string& lhs, const std::string& rhs)
+      {
+         size_t line = 1;
+         size_t length = std::min(lhs.size(), rhs.size());
+         for (size_t idx = 0; idx < length && lhs[idx] == rhs[idx]; ++idx)
+         {
+            if (lhs[idx] == '\n')
+            {
+               ++line;
+            }
+         }
+
+         return line;
+      }
+
+      /** Every (mesh, material) pair is drawn by exactly one instanced draw, even if meshes are split across threads. */
+      static bool CheckInstancing(BenchmarkEnvironment& env, size_t threads, std::string& message)
+      {
+         std::unique_ptr<RendererPBR> renderer = CreateHeadlessRenderer(env.EngineContext, threads);
+         if (renderer == nullptr)
+         {
+            message = "Failed to initialize headless renderer";
+            return false;
+         }
+
+         std::vector<std::unique_ptr<Material>> materials;
+         std::vector<Material*> sceneMaterials;
+         for (size_t idx = 0; idx < RENDERER_MATERIALS; ++idx)
+         {
+            materials.push_back(std::make_unique<Material>(env.ResMng));
+            sceneMaterials.push_back(materials.back().get());
+         }
+
+         World* world = env.TargetWorld;
+         std::vector<Mesh*> meshes = { renderer->GetPrimitiveCube(), renderer->GetPrimitiveQuad() };
+         size_t pairs = meshes.size() * sceneMaterials.size();
+         size_t meshesNum = pairs * RENDERER_INSTANCES_PER_PAIR;
+         PopulateScene(*world, meshes, sceneMaterials, meshesNum);
+         renderer->FrustumCullingEnabled() = false;
+         RenderFrame(*renderer, *world);
+
+         renderer->InstancingEnabled() = false;
+         const RenderCommandBuffer& notInstanced = RenderFrame(*renderer, *world);
+         size_t notInstancedDraws = notInstanced.CountCommands(ERenderCommand::DrawIndexedInstanced);
+         size_t notInstancedInstances = CountInstances(notInstanced);
+         size_t notInstancedDrawIndexed = notInstanced.CountCommands(ERenderCommand::DrawIndexed);
+
+         renderer->InstancingEnabled() = true;
+         const RenderCommandBuffer& instanced = RenderFrame(*renderer, *world);
+         size_t instancedDraws = instanced.CountCommands(ERenderCommand::DrawIndexedInstanced);
+         size_t instancedInstances = CountInstances(instanced);
+         size_t instancedDrawIndexed = instanced.CountCommands(ERenderCommand::DrawIndexed);
+         world->Clear();
+
+         if (notInstancedDraws != meshesNum || notInstancedInstances != meshesNum)
+         {
+            message = "Without instancing : " + std::to_string(notInstancedDraws) + " draws of " + std::to_string(notInstancedInstances) +
+               " instances, expected " + std::to_string(meshesNum) + " draws of " + std::to_string(meshesNum) + " instances";
+            return false;
+         }
+
+         if (instancedDraws != pairs || instancedInstances != meshesNum)
+         {
+            message = "With instancing : " + std::to_string(instancedDraws) + " draws of " + std::to_string(instancedInstances) +
+               " instances, expected " + std::to_string(pairs) + " draws of " + std::to_string(meshesNum) + " instances";
+            return false;
+         }
+
+         /** Only geometry pass is instanced; Full screen passes are not affected. */
+         if (instancedDrawIndexed != notInstancedDrawIndexed || instancedDrawIndexed == 0)
+         {
+            message = "DrawIndexed " + std::to_string(instancedDrawIndexed) + " with instancing, " +
+               std::to_string(notInstancedDrawIndexed) + " without instancing";
+            return false;
+         }
+
+         return true;
+      }
+
+      void RegisterRendererBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.AddCheck("RendererPBR.GoldenCommandStream",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               std::unique_ptr<RendererPBR> renderer = CreateHeadlessRenderer(env.EngineContext, 1);
+               if (renderer == nullptr)
+               {
+                  message = "Failed to initialize headless renderer";
+                  return false;
+               }
+
+               /** Single (mesh, material) pair; Draw order does not depend on addresses of mesh and material. */
+               World* world = env.TargetWorld;
+               Material material{ env.ResMng };
+               PopulateScene(*world, { renderer->GetPrimitiveCube() }, { &material }, RENDERER_GOLDEN_MESHES);
+               /** Frame resources are realized on first frame; Compare steady state frame. */
+               RenderFrame(*renderer, *world);
+               const RenderCommandBuffer& commands = RenderFrame(*renderer, *world);
+               std::string actual = commands.Serialize();
+
+               if (env.bRecordGolden)
+               {
+                  std::filesystem::create_directories(std::filesystem::path(RENDERER_GOLDEN_FILE).parent_path());
+                  bool bIsRecorded = commands.WriteToFile(RENDERER_GOLDEN_FILE);
+                  world->Clear();
+                  if (!bIsRecorded)
+                  {
+                     message = "Failed to record golden file " + WString2String(RENDERER_GOLDEN_FILE);
+                     return false;
+                  }
+
+                  std::wcout << TEXT("Golden command stream has been recorded to ") << RENDERER_GOLDEN_FILE << std::endl;
+                  return true;
+               }
+
+               std::string golden;
+               if (!ReadTextFile(RENDERER_GOLDEN_FILE, golden))
+               {
+                  world->Clear();
+                  message = "Golden file " + WString2String(RENDERER_GOLDEN_FILE) + " is not found; Run with --record-golden to record it";
+                  return false;
+               }
+
+               if (actual != golden)
+               {
+                  commands.WriteToFile(RENDERER_ACTUAL_FILE);
+                  world->Clear();
+                  message = "Command stream differs from golden at line " + std::to_string(FindFirstDifferentLine(actual, golden)) +
+                     "; Written to " + WString2String(RENDERER_ACTUAL_FILE);
+                  return false;
+               }
+
+               world->Clear();
+               return true;
+            });
+
+         runner.AddCheck("RendererPBR.Instancing",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               for (size_t threads : RENDERER_INSTANCING_THREADS)
+               {
+                  if (!CheckInstancing(env, threads, message))
+                  {
+                     message = std::to_string(threads) + " threads; " + message;
+                     return false;
+                  }
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("RendererPBR.InstancingFallback",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               std::unique_ptr<RendererPBR> renderer = CreateHeadlessRenderer(env.EngineContext, 1);
+               if (renderer == nullptr)
+               {
+                  message = "Failed to initialize headless renderer";
+                  return false;
+               }
+
+               std::vector<std::unique_ptr<Material>> materials;
+               std::vector<Material*> sceneMaterials;
+               for (size_t idx = 0; idx < RENDERER_MATERIALS; ++idx)
+               {
+                  materials.push_back(std::make_unique<Material>(env.ResMng));
+                  sceneMaterials.push_back(materials.back().get());
+               }
+
+               World* world = env.TargetWorld;
+               size_t meshesNum = 2 * RENDERER_MATERIALS * RENDERER_INSTANCES_PER_PAIR;
+               PopulateScene(*world, { renderer->GetPrimitiveCube(), renderer->GetPrimitiveQuad() }, sceneMaterials, meshesNum);
+               renderer->FrustumCullingEnabled() = false;
+
+               /** Instance transform buffer can't be created; Geometry pass must still clear GBuffer and draw every mesh one by one. */
+               auto& device = static_cast<NullRenderDevice&>(renderer->GetDevice());
+               device.SetMaximumBufferSize(RENDERER_FALLBACK_MAXIMUM_BUFFER_SIZE);
+               RenderFrame(*renderer, *world);
+               const RenderCommandBuffer& fallback = RenderFrame(*renderer, *world);
+               size_t fallbackDraws = fallback.CountCommands(ERenderCommand::DrawIndexedInstanced);
+               size_t fallbackInstances = CountInstances(fallback);
+               size_t fallbackClears = fallback.CountCommands(ERenderCommand::ClearRenderTarget);
+
+               device.SetMaximumBufferSize(0);
+               const RenderCommandBuffer& instanced = RenderFrame(*renderer, *world);
+               size_t instancedDraws = instanced.CountCommands(ERenderCommand::DrawIndexedInstanced);
+               size_t instancedClears = instanced.CountCommands(ERenderCommand::ClearRenderTarget);
+               world->Clear();
+
+               if (fallbackDraws != meshesNum || fallbackInstances != meshesNum)
+               {
+                  message = "Fallback : " + std::to_string(fallbackDraws) + " draws of " + std::to_string(fallbackInstances) +
+                     " instances, expected " + std::to_string(meshesNum) + " draws of " + std::to_string(meshesNum) + " instances";
+                  return false;
+               }
+
+               if (fallbackClears != instancedClears)
+               {
+                  message = "ClearRenderTarget " + std::to_string(fallbackClears) + " with fallback, " +
+                     std::to_string(instancedClears) + " with instancing";
+                  return false;
+               }
+
+               if (instancedDraws == fallbackDraws)
+               {
+                  message = "Instancing has not been recovered after buffer could be created";
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("RendererPBR.SteadyStatePoolMisses",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               std::unique_ptr<RendererPBR> renderer = CreateHeadlessRenderer(env.EngineContext, 1);
+               if (renderer == nullptr)
+               {
+                  message = "Failed to initialize headless renderer";
+                  return false;
+               }
+
+               World* world = env.TargetWorld;
+               Material material{ env.ResMng };
+               PopulateScene(*world, { renderer->GetPrimitiveCube() }, { &material }, RENDERER_GOLDEN_MESHES);
+               for (size_t frame = 0; frame < RENDERER_POOL_WARMUP_FRAMES; ++frame)
+               {
+                  RenderFrame(*renderer, *world);
+               }
+
+               /** Steady state frames must reuse pooled actuals only, without growing pool. */
+               size_t liveResources = renderer->GetFrameGraphPoolStats().LiveResources;
+               for (size_t frame = 0; frame < RENDERER_POOL_STEADY_FRAMES; ++frame)
+               {
+                  RenderFrame(*renderer, *world);
+                  const Elaina::ResourcePoolStats& stats = renderer->GetFrameGraphPoolStats();
+                  if (stats.Misses != 0 || stats.Hits == 0 || stats.LiveResources != liveResources)
+                  {
+                     world->Clear();
+                     message = "Steady state frame " + std::to_string(frame) + " : " + std::to_string(stats.Misses) + " misses, " +
+                        std::to_string(stats.Hits) + " hits, " + std::to_string(stats.LiveResources) + " live resources, expected " +
+                        std::to_string(liveResources);
+                     return false;
+                  }
+               }
+
+               world->Clear();
+               return true;
+            });
+
+         /** Reset, Allocate and Pack of geometry pass transforms without upload. */
+         runner.Add("InstanceTransformBatch.Pack", INSTANCE_BATCH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto instances = std::make_shared<std::vector<MeshRenderComponent*>>(PopulateInstances(*env.TargetWorld, scale));
+               auto batch = std::make_shared<InstanceTransformBatch>();
+               return [instances, batch]()
+               {
+                  PackInstances(*batch, *instances, nullptr);
+                  DoNotOptimize(batch->GetData());
+               };
+            });
+
+         runner.Add("InstanceTransformBatch.PackParallel", INSTANCE_BATCH_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto instances = std::make_shared<std::vector<MeshRenderComponent*>>(PopulateInstances(*env.TargetWorld, scale));
+               auto batch = std::make_shared<InstanceTransformBatch>();
+               ThreadPool* threadPool = env.Pool;
+               return [instances, batch, threadPool]()
+               {
+                  PackInstances(*batch, *instances, threadPool);
+                  DoNotOptimize(batch->GetData());
+               };
+            });
+
+         /** CPU cost of renderer; Commands are validated but not recorded. */
+         runner.Add("RendererPBR.Render", RENDERER_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               RendererPBR* renderer = env.Renderer;
+               World* world = env.TargetWorld;
+               auto materials = std::make_shared<std::vector<std::unique_ptr<Material>>>();
+               std::vector<Material*> sceneMaterials;
+               for (size_t idx = 0; idx < RENDERER_MATERIALS; ++idx)
+               {
+                  materials->push_back(std::make_unique<Material>(env.ResMng));
+                  sceneMaterials.push_back(materials->back().get());
+               }
+
+               PopulateScene(*world, { renderer->GetPrimitiveCube(), renderer->GetPrimitiveQuad() }, sceneMaterials, scale);
+               SetRecordingEnabled(*renderer, false);
+               return [renderer, world, materials]()
+               {
+                  renderer->Render(*world);
+               };
+            });
+      }
+   }
+}
@@ -0,0 +1,123 @@
+#include "Benchmark.h"
+#include "Resource/Resource.h"
+#include "Resource/ResourceCache.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      static const std::vector<size_t> RESOURCE_SCALES = { 1000, 10000, 100000 };
+
+      /** Resource which does not touch file system. */
+      class BenchmarkResource : public Resource
+      {
+      public:
+         BenchmarkResource(ResourceManager* resMng) :
+            Resource(resMng, ResourceType::PlainText)
+         {
+         }
+
+         virtual bool Init(const String& path) override
+         {
+            if (Resource::Init(path))
+            {
+               SucceedInit();
+               return true;
+            }
+
+            return false;
+         }
+      };
+
+      static std::vector<String> MakeResourcePaths(size_t num)
+      {
+         std::vector<String> paths;
+         paths.reserve(num);
+         for (size_t idx = 0; idx < num; ++idx)
+         {
+            paths.push_back(TEXT("Contents/Benchmark/Folder_") + std::to_wstring(idx % 64) + TEXT("/Resource_") + std::to_wstring(idx) + TEXT(".txt"));
+         }
+
+         return paths;
+      }
+
+      static void PopulateCache(ResourceCache& cache, ResourceManager* resMng, const std::vector<String>& paths)
+      {
+         for (const String& path : paths)
+         {
+            auto resource = new BenchmarkResource(resMng);
+            resource->Init(path);
+            cache.Add(resource);
+         }
+      }
+
+      struct ResourceCacheState
+      {
+         ResourceCacheState(Context* context) :
+            Cache(context)
+         {
+         }
+
+         ResourceCache Cache;
+         std::vector<String> Paths;
+         std::vector<String> Names;
+      };
+
+      void RegisterResourceBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.Add("ResourceCache.AddAndClear", RESOURCE_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = std::make_shared<ResourceCacheState>(env.EngineContext);
+               state->Paths = MakeResourcePaths(scale);
+               ResourceManager* resMng = env.ResMng;
+               return [state, resMng]()
+               {
+                  PopulateCache(state->Cache, resMng, state->Paths);
+                  state->Cache.Clear();
+               };
+            });
+
+         runner.Add("ResourceCache.GetByPath", RESOURCE_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = std::make_shared<ResourceCacheState>(env.EngineContext);
+               state->Paths = MakeResourcePaths(scale);
+               PopulateCache(state->Cache, env.ResMng, state->Paths);
+               return [state]()
+               {
+                  size_t found = 0;
+                  for (const String& path : state->Paths)
+                  {
+                     found += (state->Cache.GetByPath(path) != nullptr) ? 1 : 0;
+                  }
+
+                  DoNotOptimize(found);
+               };
+            });
+
+         runner.Add("ResourceCache.GetByName", RESOURCE_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto state = std::make_shared<ResourceCacheState>(env.EngineContext);
+               state->Paths = MakeResourcePaths(scale);
+               PopulateCache(state->Cache, env.ResMng, state->Paths);
+               for (const String& path : state->Paths)
+               {
+                  state->Names.push_back(Resource::GetFileNameFromPath(path));
+               }
+
+               return [state]()
+               {
+                  size_t found = 0;
+                  for (const String& name : state->Names)
+                  {
+                     found += (state->Cache.GetByName(name) != nullptr) ? 1 : 0;
+                  }
+
+                  DoNotOptimize(found);
+               };
+            });
+      }
+   }
+}
@@ -0,0 +1,200 @@
+#include "Benchmark.h"
+#include "MT/ThreadPool.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      static const std::vector<size_t> THREAD_POOL_TASK_SCALES = { 64, 1024, 16384, 65536 };
+      /** ParallelFor splits same amount of elements into scale chunks. */
+      constexpr size_t THREAD_POOL_ELEMENTS = 1 << 20;
+
+      /**
+       * @brief   Single mutex protected queue of std::function with packaged_task per task.
+       *          Same scheduling as ThreadPool before work stealing, kept only as reference of comparison.
+       */
+      class LegacyThreadPool
+      {
+      public:
+         LegacyThreadPool(size_t numberOfThreads) :
+            m_bStop(false)
+         {
+            for (size_t idx = 0; idx < numberOfThreads; ++idx)
+            {
+               m_workers.emplace_back([this]()
+                  {
+                     while (true)
+                     {
+                        std::function<void()> task;
+                        {
+                           std::unique_lock<std::mutex> lock(m_mutex);
+                           m_condition.wait(lock, [this]() { return m_bStop || !m_tasks.empty(); });
+                           if (m_bStop && m_tasks.empty())
+                           {
+                              return;
+                           }
+
+                           task = std::move(m_tasks.front());
+                           m_tasks.pop();
+                        }
+
+                        task();
+                     }
+                  });
+            }
+         }
+
+         ~LegacyThreadPool()
+         {
+            {
+               std::unique_lock<std::mutex> lock(m_mutex);
+               m_bStop = true;
+            }
+
+            m_condition.notify_all();
+            for (std::thread& worker : m_workers)
+            {
+               worker.join();
+            }
+         }
+
+         template <typename FUNC>
+         std::future<void> AddTask(FUNC&& func)
+         {
+            auto task = std::make_shared<std::packaged_task<void()>>(std::forward<FUNC>(func));
+            std::future<void> result = task->get_future();
+            {
+               std::unique_lock<std::mutex> lock(m_mutex);
+               m_tasks.emplace([task]() { (*task)(); });
+            }
+
+            m_condition.notify_one();
+            return result;
+         }
+
+      private:
+         bool m_bStop;
+         std::mutex m_mutex;
+         std::condition_variable m_condition;
+         std::vector<std::thread> m_workers;
+         std::queue<std::function<void()>> m_tasks;
+
+      };
+
+      static UINT64 SumRange(size_t begin, size_t end)
+      {
+         UINT64 sum = 0;
+         for (size_t idx = begin; idx < end; ++idx)
+         {
+            sum += (idx * 2654435761u) >> 7;
+         }
+
+         return sum;
+      }
+
+      void RegisterThreadPoolBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.Add("ThreadPool.AddTask", THREAD_POOL_TASK_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               ThreadPool* threadPool = env.Pool;
+               return [threadPool, scale]()
+               {
+                  std::vector<std::future<void>> futures;
+                  futures.reserve(scale);
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     futures.push_back(threadPool->AddTask([idx]() { DoNotOptimize(SumRange(idx, idx + 16)); }));
+                  }
+
+                  for (auto& future : futures)
+                  {
+                     future.get();
+                  }
+               };
+            });
+
+         runner.Add("ThreadPool.LegacyAddTask", THREAD_POOL_TASK_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto legacyPool = std::make_shared<LegacyThreadPool>(env.Pool->GetThreads());
+               return [legacyPool, scale]()
+               {
+                  std::vector<std::future<void>> futures;
+                  futures.reserve(scale);
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     futures.push_back(legacyPool->AddTask([idx]() { DoNotOptimize(SumRange(idx, idx + 16)); }));
+                  }
+
+                  for (auto& future : futures)
+                  {
+                     future.get();
+                  }
+               };
+            });
+
+         runner.Add("ThreadPool.TaskGroup", THREAD_POOL_TASK_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               ThreadPool* threadPool = env.Pool;
+               return [threadPool, scale]()
+               {
+                  TaskGroup group(*threadPool);
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     group.Run([idx]() { DoNotOptimize(SumRange(idx, idx + 16)); });
+                  }
+
+                  group.Wait();
+               };
+            });
+
+         runner.Add("ThreadPool.ParallelFor", THREAD_POOL_TASK_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               ThreadPool* threadPool = env.Pool;
+               return [threadPool, scale]()
+               {
+                  std::atomic<UINT64> total{ 0 };
+                  threadPool->ParallelFor(0, THREAD_POOL_ELEMENTS,
+                     [&total](size_t begin, size_t end)
+                     {
+                        total.fetch_add(SumRange(begin, end), std::memory_order_relaxed);
+                     },
+                     std::max<size_t>(THREAD_POOL_ELEMENTS / scale, 1));
+
+                  DoNotOptimize(total.load());
+               };
+            });
+
+         runner.Add("ThreadPool.LegacyParallelFor", THREAD_POOL_TASK_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               auto legacyPool = std::make_shared<LegacyThreadPool>(env.Pool->GetThreads());
+               return [legacyPool, scale]()
+               {
+                  std::atomic<UINT64> total{ 0 };
+                  size_t grainSize = std::max<size_t>(THREAD_POOL_ELEMENTS / scale, 1);
+                  std::vector<std::future<void>> futures;
+                  futures.reserve(scale);
+                  for (size_t begin = 0; begin < THREAD_POOL_ELEMENTS; begin += grainSize)
+                  {
+                     size_t end = std::min(begin + grainSize, THREAD_POOL_ELEMENTS);
+                     futures.push_back(legacyPool->AddTask([&total, begin, end]()
+                        {
+                           total.fetch_add(SumRange(begin, end), std::memory_order_relaxed);
+                        }));
+                  }
+
+                  for (auto& future : futures)
+                  {
+                     future.get();
+                  }
+
+                  DoNotOptimize(total.load());
+               };
+            });
+      }
+   }
+}
@@ -0,0 +1,457 @@
+#include "Benchmark.h"
+#include "BenchmarkComponent.h"
+#include "GameFramework/World.h"
+#include "GameFramework/Entity.h"
+#include "GameFramework/Transform.h"
+#include "GameFramework/Prefab.h"
+#include "GameFramework/WorldArchive.h"
+
+namespace Mile
+{
+   namespace Benchmark
+   {
+      static const std::vector<size_t> WORLD_SCALES = { 1000, 10000, 100000, 1000000 };
+      /** Each root hierarchy has root and its children. */
+      constexpr size_t ENTITIES_PER_HIERARCHY = 8;
+      /** Number of instances of one hierarchy. */
+      static const std::vector<size_t> PREFAB_SCALES = { 100, 1000, 10000 };
+
+      static std::vector<String> MakeEntityNames(size_t num)
+      {
+         std::vector<String> names;
+         names.reserve(num);
+         for (size_t idx = 0; idx < num; ++idx)
+         {
+            names.push_back(TEXT("Entity_") + std::to_wstring(idx));
+         }
+
+         return names;
+      }
+
+      /** @return   Root entities of populated hierarchies. */
+      static std::vector<Entity*> PopulateWorld(World& world, const std::vector<String>& names, bool bAddComponents)
+      {
+         world.Clear();
+         world.ReserveEntities(names.size());
+
+         std::vector<Entity*> roots;
+         Entity* root = nullptr;
+         for (size_t idx = 0; idx < names.size(); ++idx)
+         {
+            Entity* entity = world.CreateEntity(names[idx]);
+            entity->GetTransform()->SetPosition(Vector3(static_cast<float>(idx % 100), 0.0f, static_cast<float>(idx / 100)));
+            if (bAddComponents)
+            {
+               entity->AddComponent<BenchmarkComponent>();
+            }
+
+            if ((idx % ENTITIES_PER_HIERARCHY) == 0)
+            {
+               root = entity;
+               roots.push_back(root);
+            }
+            else
+            {
+               root->AttachChild(entity);
+            }
+         }
+
+         world.UpdateTransforms();
+         return roots;
+      }
+
+      /** One hierarchy with components, compiled as prefab and serialized as JSON. (as Model::Instantiate did before prefab) */
+      struct PrefabState
+      {
+         Prefab Template;
+         std::string SerializedTemplate;
+      };
+
+      static std::shared_ptr<PrefabState> CreatePrefabState(World& world)
+      {
+         auto state = std::make_shared<PrefabState>();
+         std::vector<Entity*> roots = PopulateWorld(world, MakeEntityNames(ENTITIES_PER_HIERARCHY), true);
+         state->Template.Compile(roots.front());
+         state->SerializedTemplate = roots.front()->Serialize().dump();
+         world.Clear();
+         return state;
+      }
+
+      /** Archive is written into temp directory once per scale and overwritten by later runs. */
+      static String SaveWorldArchive(World& world, size_t scale)
+      {
+         std::filesystem::path archivePath = std::filesystem::temp_directory_path() /
+            (TEXT("MileBenchmark_") + std::to_wstring(scale) + WORLD_ARCHIVE_EXTENSION);
+         String filePath = archivePath.wstring();
+         return world.SaveTo(filePath) ? filePath : String();
+      }
+
+      static Entity* InstantiateFromJson(World& world, const std::string& serialized, const String& entityName)
+      {
+         Entity* entity = world.CreateEntity(TEXT(""));
+         entity->DeSerialize(json::parse(serialized));
+         entity->SetName(entityName);
+         return entity;
+      }
+
+      /** Reference result of component query; Walks every entity. */
+      static std::vector<BenchmarkComponent*> GetComponentsByWalking(const World& world, bool onlyActivated)
+      {
+         std::vector<BenchmarkComponent*> components;
+         for (Entity* entity : world.GetEntities())
+         {
+            BenchmarkComponent* component = entity->GetComponent<BenchmarkComponent>();
+            if (component != nullptr && (component->IsActivated() || !onlyActivated))
+            {
+               components.push_back(component);
+            }
+         }
+
+         return components;
+      }
+
+      static bool CompareComponentQuery(const World& world, const std::string& when, std::string& message)
+      {
+         for (bool onlyActivated : { true, false })
+         {
+            std::vector<BenchmarkComponent*> expected = GetComponentsByWalking(world, onlyActivated);
+            std::vector<BenchmarkComponent*> queried = world.GetComponentsFromEntities<BenchmarkComponent>(onlyActivated);
+            if (queried != expected)
+            {
+               message = "GetComponentsFromEntities differs from walking entities " + when + " : " +
+                  std::to_string(queried.size()) + " components, expected " + std::to_string(expected.size());
+               return false;
+            }
+         }
+
+         return true;
+      }
+
+      void RegisterWorldBenchmarks(BenchmarkRunner& runner)
+      {
+         runner.AddCheck("World.ArchiveRoundTrip",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               World* world = env.TargetWorld;
+               PopulateWorld(*world, MakeEntityNames(1000), true);
+               json expected = world->Serialize();
+               String filePath = SaveWorldArchive(*world, 1000);
+               if (filePath.empty() || !world->LoadFrom(filePath))
+               {
+                  world->Clear();
+                  message = "Failed to save or load world archive";
+                  return false;
+               }
+
+               json loaded = world->Serialize();
+               world->Clear();
+               if (loaded != expected)
+               {
+                  message = "World loaded from archive differs from saved world";
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("Prefab.InstantiateMatchesJson",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               World* world = env.TargetWorld;
+               auto state = CreatePrefabState(*world);
+               json fromPrefab = state->Template.Instantiate(world, TEXT("Instance"))->Serialize();
+               json fromJson = InstantiateFromJson(*world, state->SerializedTemplate, TEXT("Instance"))->Serialize();
+               size_t entitiesNum = world->GetEntitiesNum();
+               world->Clear();
+
+               if (fromPrefab != fromJson)
+               {
+                  message = "Prefab instance differs from JSON instance : " + fromPrefab.dump() + " != " + fromJson.dump();
+                  return false;
+               }
+
+               if (entitiesNum != (ENTITIES_PER_HIERARCHY * 2))
+               {
+                  message = std::to_string(entitiesNum) + " entities instantiated, expected " + std::to_string(ENTITIES_PER_HIERARCHY * 2);
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("Prefab.InstantiateEmpty",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               World* world = env.TargetWorld;
+               world->Clear();
+               Prefab empty;
+               Entity* instance = empty.Instantiate(world, TEXT("Instance"));
+               bool bIsValid = (instance != nullptr) && (instance->GetName() == TEXT("Instance")) && (world->GetEntitiesNum() == 1);
+               world->Clear();
+               if (!bIsValid)
+               {
+                  message = "Empty prefab must instantiate an entity";
+                  return false;
+               }
+
+               return true;
+            });
+
+         runner.AddCheck("World.GetComponentsFromEntities",
+            [](BenchmarkEnvironment& env, std::string& message) -> bool
+            {
+               World* world = env.TargetWorld;
+               std::vector<Entity*> roots = PopulateWorld(*world, MakeEntityNames(1000), true);
+               std::vector<Entity*> entities = world->GetEntities();
+               /** Second component of same type is inserted into middle of registry. */
+               for (size_t idx = 0; idx < entities.size(); idx += 3)
+               {
+                  entities[idx]->AddComponent<BenchmarkComponent>();
+               }
+
+               for (size_t idx = 1; idx < entities.size(); idx += 5)
+               {
+                  entities[idx]->GetComponent<BenchmarkComponent>()->SetActive(false);
+               }
+
+               for (size_t idx = 2; idx < entities.size(); idx += 7)
+               {
+                  entities[idx]->RemoveComponent(entities[idx]->GetComponent<BenchmarkComponent>());
+               }
+
+               for (size_t idx = 0; idx < roots.size(); idx += 4)
+               {
+                  world->DestroyEntity(roots[idx]->GetHandle());
+               }
+
+               bool bIsSame = CompareComponentQuery(*world, "before flush", message);
+               world->FlushDestroyedEntities();
+               bIsSame = bIsSame && CompareComponentQuery(*world, "after flush", message);
+               for (size_t idx = 0; idx < ENTITIES_PER_HIERARCHY; ++idx)
+               {
+                  world->CreateEntity(TEXT("Spawned"))->AddComponent<BenchmarkComponent>();
+               }
+
+               bIsSame = bIsSame && CompareComponentQuery(*world, "after spawn", message);
+               world->Clear();
+               return bIsSame;
+            });
+
+         runner.Add("World.CreateAndClear", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               auto names = std::make_shared<std::vector<String>>(MakeEntityNames(scale));
+               world->Clear();
+               return [world, names]()
+               {
+                  world->ReserveEntities(names->size());
+                  for (const String& name : *names)
+                  {
+                     world->CreateEntity(name);
+                  }
+
+                  world->Clear();
+               };
+            });
+
+         runner.Add("World.Update", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               PopulateWorld(*world, MakeEntityNames(scale), true);
+               return [world]()
+               {
+                  world->Update();
+               };
+            });
+
+         runner.Add("World.UpdateTransforms", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               auto roots = std::make_shared<std::vector<Entity*>>(PopulateWorld(*world, MakeEntityNames(scale), false));
+               return [world, roots]()
+               {
+                  /** Dirty every hierarchy from its root. */
+                  for (Entity* root : *roots)
+                  {
+                     root->GetTransform()->Translate(Vector3(0.0f, 0.01f, 0.0f));
+                  }
+
+                  world->UpdateTransforms();
+               };
+            });
+
+         runner.Add("World.GetEntityByName", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               auto names = std::make_shared<std::vector<String>>(MakeEntityNames(scale));
+               PopulateWorld(*world, *names, false);
+               return [world, names]()
+               {
+                  size_t found = 0;
+                  for (const String& name : *names)
+                  {
+                     found += (world->GetEntityByName(name) != nullptr) ? 1 : 0;
+                  }
+
+                  DoNotOptimize(found);
+               };
+            });
+
+         /** Every entity has component; Registry is iterated directly. */
+         runner.Add("World.GetComponents", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               PopulateWorld(*world, MakeEntityNames(scale), true);
+               return [world]()
+               {
+                  size_t activated = 0;
+                  for (BenchmarkComponent* component : world->GetComponents<BenchmarkComponent>())
+                  {
+                     activated += component->IsActivated() ? 1 : 0;
+                  }
+
+                  DoNotOptimize(activated);
+               };
+            });
+
+         /** Same query as renderer does every frame. */
+         runner.Add("World.GetComponentsFromEntities", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               PopulateWorld(*world, MakeEntityNames(scale), true);
+               auto components = std::make_shared<std::vector<BenchmarkComponent*>>();
+               return [world, components]()
+               {
+                  components->clear();
+                  world->GetComponentsFromEntities<BenchmarkComponent>(*components);
+                  DoNotOptimize(components->size());
+               };
+            });
+
+         runner.Add("World.DestroyAndRecreate", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               auto names = std::make_shared<std::vector<String>>(MakeEntityNames(scale));
+               auto roots = std::make_shared<std::vector<Entity*>>(PopulateWorld(*world, *names, true));
+               return [world, names, roots]()
+               {
+                  /** Destroy every other hierarchy and spawn them again. */
+                  for (size_t idx = 0; idx < roots->size(); idx += 2)
+                  {
+                     world->DestroyEntity((*roots)[idx]->GetHandle());
+                  }
+
+                  world->FlushDestroyedEntities();
+                  for (size_t idx = 0; idx < roots->size(); idx += 2)
+                  {
+                     size_t first = idx * ENTITIES_PER_HIERARCHY;
+                     size_t last = std::min(first + ENTITIES_PER_HIERARCHY, names->size());
+                     Entity* root = world->CreateEntity((*names)[first]);
+                     root->AddComponent<BenchmarkComponent>();
+                     for (size_t child = first + 1; child < last; ++child)
+                     {
+                        Entity* entity = world->CreateEntity((*names)[child]);
+                        entity->AddComponent<BenchmarkComponent>();
+                        root->AttachChild(entity);
+                     }
+
+                     (*roots)[idx] = root;
+                  }
+               };
+            });
+
+         runner.Add("World.SerializeToArchive", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               PopulateWorld(*world, MakeEntityNames(scale), false);
+               return [world]()
+               {
+                  std::vector<UINT8> archive = world->SerializeToArchive();
+                  DoNotOptimize(archive.size());
+               };
+            });
+
+         /** Clear world, map archive file and load it. */
+         runner.Add("World.LoadArchive", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               PopulateWorld(*world, MakeEntityNames(scale), true);
+               String filePath = SaveWorldArchive(*world, scale);
+               return [world, filePath]()
+               {
+                  world->LoadFrom(filePath);
+                  DoNotOptimize(world->GetEntitiesNum());
+               };
+            });
+
+         /** Baseline; Clear world, parse same world from JSON text and deserialize it. */
+         runner.Add("World.DeSerializeJson", WORLD_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               PopulateWorld(*world, MakeEntityNames(scale), true);
+               auto serialized = std::make_shared<std::string>(world->Serialize().dump());
+               return [world, serialized]()
+               {
+                  world->Clear();
+                  world->DeSerialize(json::parse(*serialized));
+                  DoNotOptimize(world->GetEntitiesNum());
+               };
+            });
+
+         runner.Add("Prefab.Instantiate", PREFAB_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               auto state = CreatePrefabState(*world);
+               return [world, state, scale]()
+               {
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     state->Template.Instantiate(world, TEXT("Instance"));
+                  }
+
+                  world->Clear();
+               };
+            });
+
+         runner.Add("Prefab.InstantiateMany", PREFAB_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               auto state = CreatePrefabState(*world);
+               return [world, state, scale]()
+               {
+                  DoNotOptimize(state->Template.InstantiateMany(world, scale, TEXT("Instance")).size());
+                  world->Clear();
+               };
+            });
+
+         /** Baseline; Parse serialized hierarchy and deserialize it per instance. */
+         runner.Add("Prefab.DeserializeJson", PREFAB_SCALES,
+            [](BenchmarkEnvironment& env, size_t scale) -> BenchmarkBody
+            {
+               World* world = env.TargetWorld;
+               auto state = CreatePrefabState(*world);
+               return [world, state, scale]()
+               {
+                  for (size_t idx = 0; idx < scale; ++idx)
+                  {
+                     InstantiateFromJson(*world, state->SerializedTemplate, TEXT("Instance"));
+                  }
+
+                  world->Clear();
+               };
+            });
+      }
+   }
+}
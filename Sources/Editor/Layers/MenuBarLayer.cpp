@@ -3,10 +3,12 @@
 #include "Core/Logger.h"
 #include "Core/Engine.h"
 #include "Core/Timer.h"
+#include "Core/FrameTimeline.h"
 #include "Core/ImGuiHelper.h"
 #include "Resource/ResourceManager.h"
 #include "Resource/Texture2D.h"
 #include "GameFramework/World.h"
+#include "GameFramework/WorldArchive.h"
 #include "Rendering/RendererDX11.h"
 #include "Rendering/RendererPBR.h"
 #include "Rendering/Texture2dDX11.h"
@@ -127,7 +129,7 @@ namespace Mile
                openFileName.lpstrTitle = TEXT("Select world file to open.");
                openFileName.lpstrFile = szFile;
                openFileName.nMaxFile = sizeof(szFile);
-               openFileName.lpstrFilter = TEXT("World\0*.world\0All\0*.*\0");
+               openFileName.lpstrFilter = TEXT("World\0*.world\0World Archive\0*.mworld\0All\0*.*\0");
                openFileName.nFilterIndex = 1;
                openFileName.nMaxFileTitle = 0;
                openFileName.lpstrInitialDir = NULL;
@@ -164,7 +166,7 @@ namespace Mile
                openFileName.lpstrTitle = TEXT("Save As..");
                openFileName.lpstrFile = szFile;
                openFileName.nMaxFile = sizeof(szFile);
-               openFileName.lpstrFilter = TEXT("World\0*.world\0All\0*.*\0");
+               openFileName.lpstrFilter = TEXT("World\0*.world\0World Archive\0*.mworld\0All\0*.*\0");
                openFileName.nFilterIndex = 0;
                openFileName.nMaxFileTitle = 0;
                openFileName.lpstrInitialDir = NULL;
@@ -172,7 +174,18 @@ namespace Mile
 
                if (GetSaveFileName(&openFileName) == TRUE)
                {
-                  String filePath = String(openFileName.lpstrFile) + String(TEXT(".")) + String(openFileName.lpstrFilter);
+                  String filePath = String(openFileName.lpstrFile);
+                  if (openFileName.nFilterIndex == 2)
+                  {
+                     if (std::filesystem::path(filePath).extension() != WORLD_ARCHIVE_EXTENSION)
+                     {
+                        filePath += WORLD_ARCHIVE_EXTENSION;
+                     }
+                  }
+                  else
+                  {
+                     filePath += String(TEXT(".")) + String(openFileName.lpstrFilter);
+                  }
                   ME_LOG(MileMenuBarLayer, Log, String(TEXT("Save world as ")) + filePath);
                   if (m_world != nullptr)
                   {
@@ -200,6 +213,57 @@ namespace Mile
             ImGui::Text((std::string("Current FPS : ") + std::to_string(engine->GetCurrentFPS())).c_str());
             ImGui::Text((std::string("Current Deltatime : ") + std::to_string(engine->GetTimer()->GetDeltaTime())).c_str());
 
+            FramePacingStats pacingStats = engine->GetTimer()->GetPacingStats();
+            ImGui::Text("Frame time (avg/min/max) : %.3f / %.3f / %.3f ms", pacingStats.AvgFrameTimeNS * 0.000001, pacingStats.MinFrameTimeNS * 0.000001, pacingStats.MaxFrameTimeNS * 0.000001);
+            ImGui::Text("Frame jitter : %.3f ms", pacingStats.JitterNS * 0.000001);
+            ImGui::Text("Frame pacing error : %.3f ms", pacingStats.AvgErrorNS * 0.000001);
+            ImGui::Text("Missed frames : %zu / %zu", pacingStats.MissedFrames, pacingStats.Samples);
+
+            RendererDX11* renderer = engine->GetRenderer();
+            if (renderer != nullptr)
+            {
+               bool bAsyncPresentEnabled = renderer->IsAsyncPresentEnabled();
+               if (ImGui::Checkbox("Async Present", &bAsyncPresentEnabled))
+               {
+                  renderer->SetAsyncPresent(bAsyncPresentEnabled);
+               }
+            }
+
+            FrameTimeline* timeline = engine->GetFrameTimeline();
+            if (timeline != nullptr)
+            {
+               ImGui::Spacing();
+               ImGui::Separator();
+               ImGui::Text("Frame Timeline");
+               bool bTimelineEnabled = timeline->IsEnabled();
+               if (ImGui::Checkbox("Record Timeline", &bTimelineEnabled))
+               {
+                  timeline->SetEnabled(bTimelineEnabled);
+               }
+
+               int captureFrames = static_cast<int>(timeline->GetCaptureFrames());
+               if (ImGui::InputInt("Capture Frames", &captureFrames))
+               {
+                  timeline->SetCaptureFrames(static_cast<size_t>(std::max(captureFrames, 1)));
+               }
+
+               float hitchThreshold = static_cast<float>(timeline->GetHitchThreshold());
+               if (ImGui::InputFloat("Hitch Threshold (ms)", &hitchThreshold))
+               {
+                  timeline->SetHitchThreshold(std::max(hitchThreshold, 0.0f));
+               }
+
+               ImGui::Text("Hitch captures : %zu", timeline->GetHitchCaptures());
+               if (ImGui::Button("Capture Timeline"))
+               {
+                  String filePath = timeline->ExportCapture(TEXT("Capture"));
+                  if (!filePath.empty())
+                  {
+                     ME_LOG(MileMenuBarLayer, Log, TEXT("Timeline captured : ") + filePath);
+                  }
+               }
+            }
+
             ImGui::Spacing();
             ImGui::Separator();
             ImGui::Spacing();
@@ -279,6 +343,13 @@ namespace Mile
                      ImGui::TreePop();
                   }
 
+                  if (ImGui::TreeNode("Geometry Pass"))
+                  {
+                     bool& bInstancingEnabled = pbrRenderer->InstancingEnabled();
+                     ImGui::Checkbox("Enable Instancing", &bInstancingEnabled);
+                     ImGui::TreePop();
+                  }
+
                   if (ImGui::TreeNode("Screen Space Ambient Occlusion(SSAO)"))
                   {
                      bool& bSSAOEnabled = pbrRenderer->SSAOEnabled();
@@ -357,10 +428,28 @@ namespace Mile
          ImGui::SameLine();
          ImGui::Text(trianglesStr.c_str());
 
+         std::string instancesStr = std::string("Instances : ") + std::to_string(profiler.GetLatestInstances());
+         ImGui::SameLine();
+         ImGui::Spacing();
+         ImGui::SameLine();
+         ImGui::Text(instancesStr.c_str());
+
+         std::string cullingStr = std::string("Visible/Culled Meshes : ") + std::to_string(profiler.GetLatestVisibleMeshes()) + std::string(" / ") + std::to_string(profiler.GetLatestCulledMeshes());
+         ImGui::Text(cullingStr.c_str());
+
          std::string deltaTimeStr = (std::string("Deltatime : ") + std::to_string(engine->GetTimer()->GetDeltaTimeMS())) + std::string(" ms");
          ImGui::Text(deltaTimeStr.c_str());
          ImGui::Spacing();
 
+         auto pbrRenderer = dynamic_cast<RendererPBR*>(m_renderer);
+         if (pbrRenderer != nullptr)
+         {
+            const auto& poolStats = pbrRenderer->GetFrameGraphPoolStats();
+            ImGui::Text(Mile::Formatting("Transient Pool Hit/Miss : %llu / %llu", (UINT64)poolStats.Hits, (UINT64)poolStats.Misses).c_str());
+            ImGui::Text(Mile::Formatting("Transient Pool Live : %llu (%.02f MB)", (UINT64)poolStats.LiveResources, poolStats.LiveBytes / (1024.0 * 1024.0)).c_str());
+            ImGui::Spacing();
+         }
+
          if (ImGui::CollapsingHeader("Profiles", ImGuiTreeNodeFlags_DefaultOpen))
          {
             ImGui::Spacing();
@@ -369,10 +458,11 @@ namespace Mile
             {
                profiler.SetQueryLatency(latency);
             }
+            ImGui::Text(Mile::Formatting("Dropped Frames : %llu", profiler.GetDroppedFrames()).c_str());
             ImGui::Spacing();
             ImGui::PushStyleColor(ImGuiCol_Border, ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
 
-            const auto& profileDatas = profiler.GetProfileTimes();
+            const auto& profileScopes = profiler.GetScopes();
             if (ImGui::BeginTable("ProfileData", 6, 
                ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersOuter | 
                ImGuiTableFlags_BordersInner | ImGuiTableFlags_SizingFixedSame | 
@@ -392,13 +482,13 @@ namespace Mile
                ImGui::TableNextColumn();
                ImGui::Text(Mile::Formatting("%.03f ms", profiler.GetProfileOverallTime()).c_str());
 
-               for (const auto& data : profileDatas)
+               for (const auto& scope : profileScopes)
                {
-                  const auto& accData = data.second;
+                  const auto& accData = scope.Times;
                   ImGui::TableNextRow();
                   ImGui::TableSetColumnIndex(0);
 
-                  ImGui::Text(data.first.c_str());
+                  ImGui::Text(scope.Name.c_str());
 
                   ImGui::TableNextColumn();
 
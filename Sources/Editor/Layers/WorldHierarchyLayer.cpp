@@ -39,6 +39,7 @@ namespace Mile
             if (ImGui::IsItemClicked())
             {
                m_selectedEntity = targetRoot;
+               m_selectedHandle = targetRoot->GetHandle();
                m_tempPosition = m_selectedEntity->GetTransform()->GetPosition(m_transformSpace);
                m_tempEulerRotation = Math::QuaternionToEulerAngles(m_selectedEntity->GetTransform()->GetRotation(m_transformSpace));
                ME_LOG(MileWorldHierarchyLayer, Log, TEXT("Entity has been selected at hierarchy : ") + m_selectedEntity->GetName());
@@ -101,7 +102,7 @@ namespace Mile
          if (m_selectedEntity != nullptr)
          {
             ImGui::Spacing();
-            if (m_target->CheckEntityValidation(m_selectedEntity))
+            if (m_target->GetEntity(m_selectedHandle) == m_selectedEntity)
             {
                bool bIsEntityActivated = m_selectedEntity->IsActivated();
                if (ImGui::Checkbox("##entityActivationCheckbox0", &bIsEntityActivated))
@@ -186,6 +187,7 @@ namespace Mile
             else
             {
                m_selectedEntity = nullptr;
+               m_selectedHandle = EntityHandle();
             }
          }
          ImGui::End();
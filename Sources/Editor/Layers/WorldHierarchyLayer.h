@@ -2,6 +2,7 @@
 #include "Core/Layer.h"
 #include "Core/Logger.h"
 #include "Math/MathMinimal.h"
+#include "GameFramework/EntityHandle.h"
 
 namespace Mile
 {
@@ -28,6 +29,8 @@ namespace Mile
       private:
          World* m_target;
          Entity* m_selectedEntity;
+         /** Selected entity may be destroyed or world may be cleared, so validate with handle. */
+         EntityHandle m_selectedHandle;
          ETransformSpace m_transformSpace;
          Vector3 m_tempPosition;
          Vector3 m_tempEulerRotation;
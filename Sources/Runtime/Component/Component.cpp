@@ -1,12 +1,42 @@
 #include "Component/Component.h"
 #include "GameFramework/Entity.h"
+#include "GameFramework/World.h"
 
 namespace Mile
 {
+   void* Component::AllocateMemory(Entity* entity, const std::type_info& type, size_t size, size_t alignment)
+   {
+      World* world = (entity != nullptr) ? entity->GetWorld() : nullptr;
+      if (world != nullptr)
+      {
+         return world->GetAllocator().Allocate(type, size, alignment);
+      }
+
+      return ::operator new(size);
+   }
+
+   void Component::Destroy(Component* component)
+   {
+      if (component != nullptr)
+      {
+         Entity* entity = component->m_entity;
+         World* world = (entity != nullptr) ? entity->GetWorld() : nullptr;
+         if (world != nullptr)
+         {
+            world->GetAllocator().Delete(component);
+         }
+         else
+         {
+            delete component;
+         }
+      }
+   }
+
    Component::Component(Entity* entity) :
       m_entity(entity),
       m_bIsActivated(true),
-      m_bCanEverUpdate(true)
+      m_bCanEverUpdate(true),
+      m_bIsRegistered(false)
    {
    }
 
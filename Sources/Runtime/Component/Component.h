@@ -6,8 +6,22 @@ namespace Mile
    class Entity;
    class Context;
    class Transform;
+   class ComponentRegistry;
+
+   /** Phases are updated in declared order every frame. */
+   enum class EComponentUpdatePhase : UINT8
+   {
+      PreUpdate,
+      Update,
+      PostUpdate
+   };
+
+   constexpr size_t COMPONENT_UPDATE_PHASE_NUM = 3;
+
    class MEAPI Component
    {
+      friend ComponentRegistry;
+
    public:
       Component(Entity* entity);
       virtual ~Component() { }
@@ -16,11 +30,24 @@ namespace Mile
          std::enable_if_t<std::is_base_of_v<Component, Ty>, bool> = true>
       static Ty* Create(Entity* entity)
       {
-         Ty* newComp = new Ty(entity);
+         Ty* newComp = Allocate<Ty>(entity);
          newComp->OnCreate();
          return newComp;
       }
 
+      /**
+       * @brief   Construct component from component pool of entity's world. (Or heap if entity does not belong to any world)
+       */
+      template <typename Ty,
+         std::enable_if_t<std::is_base_of_v<Component, Ty>, bool> = true>
+      static Ty* Allocate(Entity* entity)
+      {
+         return new (AllocateMemory(entity, typeid(Ty), sizeof(Ty), alignof(Ty))) Ty(entity);
+      }
+
+      /** Destruct component and return its memory to where it has been allocated from. */
+      static void Destroy(Component* component);
+
       //virtual std::string Serialize( ) const { return ( "\"IsActivated\": " + Mile::BoolSerialize( m_bIsActive )); }
       virtual json Serialize() const { json obj; obj["IsActivated"] = m_bIsActivated; obj["Type"] = WString2String(GetType()); return obj; }
       virtual void DeSerialize(const json& jsonData)
@@ -55,15 +82,33 @@ namespace Mile
 
       bool IsUpdateEnabled() const { return m_bCanEverUpdate; }
 
+      virtual EComponentUpdatePhase GetUpdatePhase() const { return EComponentUpdatePhase::Update; }
+
+      /**
+       * @brief   Update can run concurrently with components of other root hierarchies.
+       *          Component may only modify itself and entities of its own hierarchy,
+       *          and must not create or destroy any entity or component.
+       *          (World, its registry and allocator are not thread-safe. Allocator asserts it on debug build.)
+       *          Parallel components are updated after every serial component of same phase.
+       */
+      virtual bool IsParallelUpdatable() const { return false; }
+
    protected:
       Component() : Component(nullptr)
       {
       }
 
+   private:
+      static void* AllocateMemory(Entity* entity, const std::type_info& type, size_t size, size_t alignment);
+
    protected:
       Entity* m_entity;
       bool    m_bIsActivated;
       bool    m_bCanEverUpdate;
 
+   private:
+      /** Whether component has been registered to world component registry. */
+      bool    m_bIsRegistered;
+
    };
 }
\ No newline at end of file
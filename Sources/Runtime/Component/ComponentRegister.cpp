@@ -11,13 +11,24 @@ namespace Mile
          return nullptr;
       }
 
+      const ConstructorType* constructor = FindConstructor(key);
+      if (constructor == nullptr)
+      {
+         return nullptr;
+      }
+
+      return (*constructor)(entity);
+   }
+
+   const ComponentRegister::ConstructorType* ComponentRegister::FindConstructor(const std::string& key) const
+   {
       auto itr = m_constructorMap.find(key);
       if (itr == m_constructorMap.end())
       {
          return nullptr;
       }
 
-      return (*itr).second(entity);
+      return &(*itr).second;
    }
 
    ComponentRegister& ComponentRegister::GetInstance()
@@ -6,6 +6,8 @@ namespace Mile
    class MEAPI ComponentRegister
    {
    public:
+      using ConstructorType = std::function<Component* (Entity*)>;
+
       template < typename Ty >
       void Register(const std::string& key)
       {
@@ -13,6 +15,10 @@ namespace Mile
       }
 
       Component* Acquire(const std::string& key, Entity* entity);
+
+      /** Resolve constructor once and reuse it without key lookup. Returned pointer remains valid until destroyed. */
+      const ConstructorType* FindConstructor(const std::string& key) const;
+
       static ComponentRegister& GetInstance();
       static void Destroy();
 
@@ -21,7 +27,7 @@ namespace Mile
 
    private:
       static ComponentRegister* m_instance;
-      std::map<std::string, std::function<Component* (Entity*)>> m_constructorMap;
+      std::map<std::string, ConstructorType> m_constructorMap;
 
    };
 }
@@ -3,6 +3,7 @@
 #include "Core/Engine.h"
 #include "Rendering/RendererDX11.h"
 #include "GameFramework/Entity.h"
+#include "GameFramework/Transform.h"
 #include "Resource/ResourceManager.h"
 #include "Resource/Model.h"
 #include "Resource/Material.h"
@@ -59,4 +60,37 @@ namespace Mile
 
       m_material = resMng->Load<Material>(String2WString(GetValueSafelyFromJson(jsonData, "Material", std::string())));
    }
+
+   const AABB& MeshRenderComponent::GetWorldBounds()
+   {
+      UpdateWorldBounds();
+      return m_worldBounds;
+   }
+
+   const BoundingSphere& MeshRenderComponent::GetWorldBoundingSphere()
+   {
+      UpdateWorldBounds();
+      return m_worldBoundingSphere;
+   }
+
+   void MeshRenderComponent::UpdateWorldBounds()
+   {
+      if (m_mesh == nullptr)
+      {
+         m_boundsMesh = nullptr;
+         m_worldBounds = AABB();
+         m_worldBoundingSphere = BoundingSphere();
+         return;
+      }
+
+      Transform* transform = GetTransform();
+      if (m_boundsMesh != m_mesh || m_boundsTransformVersion != transform->GetVersion())
+      {
+         const Matrix& worldMatrix = transform->GetWorldMatrix();
+         m_boundsMesh = m_mesh;
+         m_boundsTransformVersion = transform->GetVersion();
+         m_worldBounds = m_mesh->GetBounds().Transformed(worldMatrix);
+         m_worldBoundingSphere = m_mesh->GetBoundingSphere().Transformed(worldMatrix);
+      }
+   }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Component/ComponentRegister.h"
+#include "Math/BoundingVolume.h"
 
 namespace Mile
 {
@@ -13,6 +14,8 @@ namespace Mile
       MeshRenderComponent(Entity* entity) :
          m_mesh(nullptr),
          m_material(nullptr),
+         m_boundsMesh(nullptr),
+         m_boundsTransformVersion(0),
          Component(entity)
       {
          m_bCanEverUpdate = false;
@@ -28,9 +31,22 @@ namespace Mile
       void SetMaterial(Material* material) { m_material = material; }
       Material* GetMaterial() const { return m_material; }
 
+      /** World space bounds of mesh. Recomputed only when transform or mesh has been changed. */
+      const AABB& GetWorldBounds();
+      const BoundingSphere& GetWorldBoundingSphere();
+
+   private:
+      void UpdateWorldBounds();
+
    private:
       Mesh* m_mesh;
       Material* m_material;
 
+      /** World bounds cache */
+      AABB m_worldBounds;
+      BoundingSphere m_worldBoundingSphere;
+      UINT64 m_boundsTransformVersion;
+      Mesh* m_boundsMesh;
+
    };
 }
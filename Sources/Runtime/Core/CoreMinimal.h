@@ -10,6 +10,9 @@
 #include <set>
 #include <forward_list>
 #include <queue>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
 #include <tuple>
 #include <stack>
 #include <memory>
@@ -24,6 +27,7 @@
 #include <future>
 #include <condition_variable>
 #include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <chrono>
 #include <random>
@@ -2,6 +2,7 @@
 #include "Core/Context.h"
 #include "Core/Logger.h"
 #include "Core/Timer.h"
+#include "Core/FrameTimeline.h"
 #include "Core/Config.h"
 #include "Core/InputManager.h"
 #include "Core/Window.h"
@@ -28,6 +29,9 @@ namespace Mile
       m_timer = new Timer(context);
       context->RegisterSubSystem(m_timer);
 
+      m_timeline = new FrameTimeline(context);
+      context->RegisterSubSystem(m_timeline);
+
       m_threadPool = new ThreadPool(context);
       context->RegisterSubSystem(m_threadPool);
 
@@ -85,6 +89,14 @@ namespace Mile
             return false;
          }
 
+         // Initialize Frame Timeline
+         if (!context->GetSubSystem<FrameTimeline>()->Init())
+         {
+            ME_LOG(MileEngine, Fatal, TEXT("Failed to initialize FrameTimeline!"));
+            m_instance = nullptr;
+            return false;
+         }
+
          // Initialize Thread Pool
          if (!context->GetSubSystem<ThreadPool>()->Init())
          {
@@ -166,6 +178,7 @@ namespace Mile
          m_bIsRunning = false;
          m_logger = nullptr;
          m_timer = nullptr;
+         m_timeline = nullptr;
          m_threadPool = nullptr;
          m_resourceManager = nullptr;
          m_configSys = nullptr;
@@ -192,41 +205,51 @@ namespace Mile
          else
          {
             m_timer->BeginFrame();
+            m_timeline->BeginFrame();
 
             this->Update();
-            m_app->Update();
+            {
+               ME_TIMELINE_SCOPE("Application::Update");
+               m_app->Update();
+            }
 
-            this->m_renderer->Render(*this->m_world);
+            {
+               ME_TIMELINE_SCOPE("Renderer::Render");
+               this->m_renderer->Render(*this->m_world);
+            }
 
-            m_app->RenderIMGUI();
+            {
+               ME_TIMELINE_SCOPE("Application::RenderIMGUI");
+               m_app->RenderIMGUI();
+            }
             m_renderer->Present();
 
             m_timer->PreEndFrame();
-
-            auto deltaTimeNS = m_timer->GetDeltaTimeNS();
-            if (deltaTimeNS < m_targetTimePerFrame)
+            if (m_targetTimePerFrame > 0)
             {
-               auto yieldTime = std::chrono::nanoseconds(m_targetTimePerFrame - deltaTimeNS);
-               auto end = std::chrono::high_resolution_clock::now() + yieldTime;
-               while (std::chrono::high_resolution_clock::now() < end)
-               {
-                  std::this_thread::yield();
-               }
+               ME_TIMELINE_SCOPE("FramePacing");
+               m_timer->WaitForTargetFrameTime(m_targetTimePerFrame);
             }
-
             m_timer->PostEndFrame();
+            m_timeline->EndFrame();
          }
       }
 
+      m_renderer->WaitForPresent();
       return 0;
    }
 
    void Engine::Update()
    {
       OPTICK_EVENT();
+      ME_TIMELINE_SCOPE("Engine::Update");
       // Update subsystems
       m_window->Update();
+
+      /** Components and finalizing resources may use immediate context, so they have to wait for asynchronous present of previous frame. */
+      m_renderer->WaitForPresent();
       m_world->Update();
+      m_resourceManager->FinalizeAsyncLoads();
    }
 
    void Engine::ShutDown()
@@ -250,6 +273,11 @@ namespace Mile
       return (m_instance != nullptr) ? m_instance->m_timer : nullptr;
    }
 
+   FrameTimeline* Engine::GetFrameTimeline()
+   {
+      return (m_instance != nullptr) ? m_instance->m_timeline : nullptr;
+   }
+
    ThreadPool* Engine::GetThreadPool()
    {
       return (m_instance != nullptr) ? m_instance->m_threadPool : nullptr;
@@ -294,6 +322,12 @@ namespace Mile
             auto& engineConfig = m_configSys->GetConfig(ENGINE_CONFIG);
             unsigned int maxFPS = GetValueSafelyFromJson(engineConfig.second, ENGINE_CONFIG_MAX_FPS, UPPER_BOUND_OF_ENGINE_FPS);
             SetMaxFPS(maxFPS);
+            bool bAsyncPresent = GetValueSafelyFromJson(engineConfig.second, ENGINE_CONFIG_ASYNC_PRESENT, false);
+            m_renderer->SetAsyncPresent(bAsyncPresent);
+            double hitchThreshold = GetValueSafelyFromJson(engineConfig.second, ENGINE_CONFIG_HITCH_THRESHOLD, 0.0);
+            m_timeline->SetHitchThreshold(hitchThreshold);
+            size_t captureFrames = GetValueSafelyFromJson(engineConfig.second, ENGINE_CONFIG_TIMELINE_CAPTURE_FRAMES, DEFAULT_TIMELINE_CAPTURE_FRAMES);
+            m_timeline->SetCaptureFrames(captureFrames);
             ME_LOG(MileEngine, ELogVerbosity::Log, TEXT("Engine configurations loaded."));
             return;
          }
@@ -310,6 +344,9 @@ namespace Mile
          {
             auto& engineConfig = m_configSys->GetConfig(ENGINE_CONFIG);
             engineConfig.second[ENGINE_CONFIG_MAX_FPS] = m_maxFPS;
+            engineConfig.second[ENGINE_CONFIG_ASYNC_PRESENT] = m_renderer->IsAsyncPresentEnabled();
+            engineConfig.second[ENGINE_CONFIG_HITCH_THRESHOLD] = m_timeline->GetHitchThreshold();
+            engineConfig.second[ENGINE_CONFIG_TIMELINE_CAPTURE_FRAMES] = m_timeline->GetCaptureFrames();
             if (m_configSys->SaveConfig(ENGINE_CONFIG))
             {
                ME_LOG(MileEngine, ELogVerbosity::Log, TEXT("Engine configurations saved."));
@@ -3,6 +3,9 @@
 
 #define ENGINE_CONFIG TEXT("Engine")
 #define ENGINE_CONFIG_MAX_FPS "MaxFPS"
+#define ENGINE_CONFIG_ASYNC_PRESENT "AsyncPresent"
+#define ENGINE_CONFIG_HITCH_THRESHOLD "HitchThresholdMS"
+#define ENGINE_CONFIG_TIMELINE_CAPTURE_FRAMES "TimelineCaptureFrames"
 
 namespace Mile
 {
@@ -12,6 +15,7 @@ namespace Mile
    constexpr unsigned int UPPER_BOUND_OF_ENGINE_FPS = 300;
 
    class Timer;
+   class FrameTimeline;
    class ThreadPool;
    class ConfigSystem;
    class InputManager;
@@ -54,6 +58,7 @@ namespace Mile
       static Engine* GetInstance();
       static Logger* GetLogger();
       static Timer* GetTimer();
+      static FrameTimeline* GetFrameTimeline();
       static ThreadPool* GetThreadPool();
       static ResourceManager* GetResourceManager();
       static ConfigSystem* GetConfigSystem();
@@ -78,6 +83,7 @@ namespace Mile
       long long         m_targetTimePerFrame;
       Logger*           m_logger;
       Timer*            m_timer;
+      FrameTimeline*    m_timeline;
       ThreadPool*       m_threadPool;
       ResourceManager*  m_resourceManager;
       ConfigSystem*     m_configSys;
@@ -0,0 +1,404 @@
+#include "Core/FrameTimeline.h"
+#include "Core/Context.h"
+#include "Core/Engine.h"
+#include "MT/ThreadPool.h"
+
+namespace Mile
+{
+   DEFINE_LOG_CATEGORY(MileFrameTimeline);
+
+   struct TimelineThreadBuffer
+   {
+      size_t Index = 0;
+      std::string Name;
+      std::mutex Mutex;
+      /** Ring buffer, oldest events are overwritten. */
+      std::vector<TimelineEvent> Events;
+      size_t Head = 0;
+      size_t Num = 0;
+
+      void Push(const TimelineEvent& event)
+      {
+         std::lock_guard<std::mutex> lock(Mutex);
+         Events[Head] = event;
+         Head = (Head + 1) % Events.size();
+         Num = std::min(Num + 1, Events.size());
+      }
+
+      void CopyTo(std::vector<TimelineEvent>& out, UINT64 firstFrame)
+      {
+         std::lock_guard<std::mutex> lock(Mutex);
+         size_t begin = (Head + Events.size() - Num) % Events.size();
+         for (size_t idx = 0; idx < Num; ++idx)
+         {
+            const TimelineEvent& event = Events[(begin + idx) % Events.size()];
+            if (event.Frame >= firstFrame)
+            {
+               out.push_back(event);
+            }
+         }
+      }
+   };
+
+   struct TimelineTrack
+   {
+      size_t Index = 0;
+      std::string Name;
+      std::vector<TimelineEvent> Events;
+   };
+
+   /** Event names are interned or literal, so they stay valid while timeline exists. */
+   struct TimelineSnapshot
+   {
+      std::vector<TimelineFrame> Frames;
+      std::vector<TimelineTrack> Threads;
+      TimelineTrack GPU;
+   };
+
+   namespace
+   {
+      std::atomic<UINT64> s_timelineInstances{ 0 };
+      thread_local UINT64 t_bufferOwner = 0;
+      thread_local TimelineThreadBuffer* t_buffer = nullptr;
+
+      void WriteJsonString(std::ofstream& stream, const char* str)
+      {
+         stream << '"';
+         for (const char* itr = str; *itr != '\0'; ++itr)
+         {
+            switch (*itr)
+            {
+            case '"':
+               stream << "\\\"";
+               break;
+            case '\\':
+               stream << "\\\\";
+               break;
+            default:
+               if (static_cast<unsigned char>(*itr) >= 0x20)
+               {
+                  stream << *itr;
+               }
+               break;
+            }
+         }
+         stream << '"';
+      }
+
+      void WriteCompleteEvent(std::ofstream& stream, const char* name, const char* category, int pid, size_t tid, long long beginNS, long long endNS, UINT64 frame)
+      {
+         stream << ",\n{\"name\":";
+         WriteJsonString(stream, name);
+         stream << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << tid
+            << ",\"ts\":" << Formatting("%.3f", beginNS * 0.001)
+            << ",\"dur\":" << Formatting("%.3f", std::max<long long>(endNS - beginNS, 0) * 0.001)
+            << ",\"args\":{\"frame\":" << frame << "}}";
+      }
+
+      void WriteMetadata(std::ofstream& stream, const char* type, int pid, size_t tid, const std::string& name)
+      {
+         stream << ",\n{\"name\":\"" << type << "\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << tid << ",\"args\":{\"name\":";
+         WriteJsonString(stream, name.c_str());
+         stream << "}}";
+      }
+
+      bool WriteChromeTrace(const TimelineSnapshot& snapshot, const String& filePath)
+      {
+         OPTICK_EVENT();
+         std::ofstream stream(std::filesystem::path(filePath), std::ios::out | std::ios::trunc);
+         if (!stream.is_open())
+         {
+            ME_LOG(MileFrameTimeline, Warning, TEXT("Failed to open timeline capture file : ") + filePath);
+            return false;
+         }
+
+         constexpr int CPU_PROCESS = 1;
+         constexpr int GPU_PROCESS = 2;
+         constexpr size_t FRAME_TRACK = 0;
+
+         stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+         stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << CPU_PROCESS << ",\"args\":{\"name\":\"CPU\"}}";
+         WriteMetadata(stream, "process_name", GPU_PROCESS, 0, "GPU");
+         WriteMetadata(stream, "thread_name", CPU_PROCESS, FRAME_TRACK, "Frames");
+         WriteMetadata(stream, "thread_name", GPU_PROCESS, 0, snapshot.GPU.Name);
+
+         for (const TimelineFrame& frame : snapshot.Frames)
+         {
+            if (frame.EndNS != 0)
+            {
+               std::string frameName = "Frame " + std::to_string(frame.Index);
+               WriteCompleteEvent(stream, frameName.c_str(), "frame", CPU_PROCESS, FRAME_TRACK, frame.BeginNS, frame.EndNS, frame.Index);
+            }
+         }
+
+         for (const TimelineTrack& thread : snapshot.Threads)
+         {
+            WriteMetadata(stream, "thread_name", CPU_PROCESS, thread.Index, thread.Name);
+            for (const TimelineEvent& event : thread.Events)
+            {
+               WriteCompleteEvent(stream, event.Name, "cpu", CPU_PROCESS, thread.Index, event.BeginNS, event.EndNS, event.Frame);
+            }
+         }
+
+         for (const TimelineEvent& event : snapshot.GPU.Events)
+         {
+            WriteCompleteEvent(stream, event.Name, "gpu", GPU_PROCESS, 0, event.BeginNS, event.EndNS, event.Frame);
+         }
+
+         stream << "\n]}";
+         return stream.good();
+      }
+   }
+
+   FrameTimeline::FrameTimeline(Context* context) :
+      SubSystem(context),
+      m_instanceID(++s_timelineInstances),
+      m_epoch(std::chrono::steady_clock::now()),
+      m_bIsEnabled(true),
+      m_currentFrame(0),
+      m_gpuBuffer(std::make_unique<TimelineThreadBuffer>()),
+      m_captureFrames(DEFAULT_TIMELINE_CAPTURE_FRAMES),
+      m_hitchThresholdMS(0.0),
+      m_pendingHitchExportFrame(0),
+      m_hitchCaptures(0),
+      m_captureDirectory(TEXT("Traces"))
+   {
+      m_gpuBuffer->Name = "GPU";
+      m_gpuBuffer->Events.resize(TIMELINE_EVENTS_PER_THREAD);
+   }
+
+   FrameTimeline::~FrameTimeline()
+   {
+      DeInit();
+   }
+
+   bool FrameTimeline::Init()
+   {
+      if (SubSystem::Init())
+      {
+         m_epoch = std::chrono::steady_clock::now();
+         ME_LOG(MileFrameTimeline, Log, TEXT("Frame timeline initialized."));
+         SubSystem::InitSucceed();
+         return true;
+      }
+
+      ME_LOG(MileFrameTimeline, Fatal, TEXT("Failed to initialize frame timeline."));
+      return false;
+   }
+
+   void FrameTimeline::DeInit()
+   {
+      if (IsInitialized())
+      {
+         WaitForHitchExport();
+         ME_LOG(MileFrameTimeline, Log, TEXT("Frame timeline deinitialized."));
+         SubSystem::DeInit();
+      }
+   }
+
+   long long FrameTimeline::Now() const
+   {
+      return (std::chrono::steady_clock::now() - m_epoch).count();
+   }
+
+   void FrameTimeline::BeginFrame()
+   {
+      TimelineThreadBuffer* mainThreadBuffer = GetThreadBuffer();
+      if (mainThreadBuffer->Name != "Main Thread")
+      {
+         std::lock_guard<std::mutex> lock(m_threadsMutex);
+         mainThreadBuffer->Name = "Main Thread";
+      }
+
+      TimelineFrame frame;
+      frame.Index = m_currentFrame.fetch_add(1, std::memory_order_relaxed) + 1;
+      frame.BeginNS = Now();
+      m_frames.push_back(frame);
+      while (m_frames.size() > m_captureFrames)
+      {
+         m_frames.pop_front();
+      }
+   }
+
+   void FrameTimeline::EndFrame()
+   {
+      if (m_frames.empty())
+      {
+         return;
+      }
+
+      TimelineFrame& frame = m_frames.back();
+      frame.EndNS = Now();
+
+      double frameTimeMS = (frame.EndNS - frame.BeginNS) * 0.000001;
+      if (m_hitchThresholdMS > 0.0 && frameTimeMS > m_hitchThresholdMS && m_pendingHitchExportFrame == 0)
+      {
+         ME_LOG(MileFrameTimeline, Warning, Formatting(TEXT("Frame %llu took %.03f ms, timeline will be captured."), frame.Index, frameTimeMS));
+         m_pendingHitchExportFrame = frame.Index + TIMELINE_HITCH_EXPORT_DELAY_FRAMES;
+      }
+
+      if (m_pendingHitchExportFrame != 0 && frame.Index >= m_pendingHitchExportFrame)
+      {
+         m_pendingHitchExportFrame = 0;
+         ExportHitch();
+      }
+   }
+
+   void FrameTimeline::ExportHitch()
+   {
+      /** Only snapshot is taken on main thread; Writing capture takes longer than a frame. */
+      auto snapshot = TakeSnapshot();
+      if (snapshot->Frames.empty())
+      {
+         return;
+      }
+
+      String filePath = MakeCapturePath(TEXT("Hitch"));
+      auto writeCapture = [this, snapshot, filePath]()
+      {
+         if (WriteChromeTrace(*snapshot, filePath))
+         {
+            m_hitchCaptures.fetch_add(1, std::memory_order_relaxed);
+            ME_LOG(MileFrameTimeline, Log, TEXT("Hitch captured : ") + filePath);
+         }
+      };
+
+      WaitForHitchExport();
+      ThreadPool* threadPool = GetContext()->GetSubSystem<ThreadPool>();
+      if (threadPool != nullptr && threadPool->IsInitialized())
+      {
+         m_hitchExport = threadPool->AddTask(writeCapture);
+      }
+      else
+      {
+         writeCapture();
+      }
+   }
+
+   void FrameTimeline::WaitForHitchExport()
+   {
+      if (m_hitchExport.valid())
+      {
+         m_hitchExport.wait();
+         m_hitchExport = std::future<void>();
+      }
+   }
+
+   const char* FrameTimeline::InternName(const std::string& name)
+   {
+      std::lock_guard<std::mutex> lock(m_namesMutex);
+      return m_names.insert(name).first->c_str();
+   }
+
+   void FrameTimeline::RecordEvent(const char* name, UINT64 frame, long long beginNS, long long endNS)
+   {
+      if (IsEnabled())
+      {
+         GetThreadBuffer()->Push({ name, frame, beginNS, endNS });
+      }
+   }
+
+   void FrameTimeline::RecordGPUEvent(const char* name, UINT64 frame, long long beginNS, long long endNS)
+   {
+      if (IsEnabled())
+      {
+         m_gpuBuffer->Push({ name, frame, beginNS, endNS });
+      }
+   }
+
+   TimelineThreadBuffer* FrameTimeline::GetThreadBuffer()
+   {
+      if (t_bufferOwner != m_instanceID)
+      {
+         auto buffer = std::make_unique<TimelineThreadBuffer>();
+         buffer->Events.resize(TIMELINE_EVENTS_PER_THREAD);
+
+         std::lock_guard<std::mutex> lock(m_threadsMutex);
+         buffer->Index = m_threads.size() + 1;
+         buffer->Name = "Thread " + std::to_string(buffer->Index);
+         t_buffer = buffer.get();
+         t_bufferOwner = m_instanceID;
+         m_threads.push_back(std::move(buffer));
+      }
+
+      return t_buffer;
+   }
+
+   std::shared_ptr<TimelineSnapshot> FrameTimeline::TakeSnapshot()
+   {
+      OPTICK_EVENT();
+      auto snapshot = std::make_shared<TimelineSnapshot>();
+      if (m_frames.empty())
+      {
+         return snapshot;
+      }
+
+      UINT64 firstFrame = m_frames.front().Index;
+      snapshot->Frames.assign(m_frames.begin(), m_frames.end());
+      {
+         std::lock_guard<std::mutex> lock(m_threadsMutex);
+         snapshot->Threads.resize(m_threads.size());
+         for (size_t idx = 0; idx < m_threads.size(); ++idx)
+         {
+            TimelineTrack& track = snapshot->Threads[idx];
+            track.Index = m_threads[idx]->Index;
+            track.Name = m_threads[idx]->Name;
+            m_threads[idx]->CopyTo(track.Events, firstFrame);
+         }
+      }
+
+      snapshot->GPU.Name = m_gpuBuffer->Name;
+      m_gpuBuffer->CopyTo(snapshot->GPU.Events, firstFrame);
+      return snapshot;
+   }
+
+   bool FrameTimeline::ExportChromeTrace(const String& filePath)
+   {
+      auto snapshot = TakeSnapshot();
+      if (snapshot->Frames.empty())
+      {
+         return false;
+      }
+
+      return WriteChromeTrace(*snapshot, filePath);
+   }
+
+   String FrameTimeline::MakeCapturePath(const String& prefix)
+   {
+      std::error_code error;
+      std::filesystem::create_directories(std::filesystem::path(m_captureDirectory), error);
+
+      return m_captureDirectory + TEXT("/") + prefix + TEXT("_") + std::to_wstring(GetCurrentFrame()) + TEXT(".json");
+   }
+
+   String FrameTimeline::ExportCapture(const String& prefix)
+   {
+      String filePath = MakeCapturePath(prefix);
+      return ExportChromeTrace(filePath) ? filePath : String();
+   }
+
+   ScopedTimelineEvent::ScopedTimelineEvent(const char* name) :
+      m_timeline(Engine::GetFrameTimeline()),
+      m_name(name),
+      m_frame(0),
+      m_beginNS(0)
+   {
+      if (m_timeline != nullptr && m_timeline->IsEnabled())
+      {
+         m_frame = m_timeline->GetCurrentFrame();
+         m_beginNS = m_timeline->Now();
+      }
+      else
+      {
+         m_timeline = nullptr;
+      }
+   }
+
+   ScopedTimelineEvent::~ScopedTimelineEvent()
+   {
+      if (m_timeline != nullptr)
+      {
+         m_timeline->RecordEvent(m_name, m_frame, m_beginNS, m_timeline->Now());
+      }
+   }
+}
\ No newline at end of file
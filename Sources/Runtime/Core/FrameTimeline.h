@@ -0,0 +1,139 @@
+#pragma once
+#include "Core/Logger.h"
+
+#define ME_TIMELINE_CONCAT_IMPL(A, B) A##B
+#define ME_TIMELINE_CONCAT(A, B) ME_TIMELINE_CONCAT_IMPL(A, B)
+/** Record scope into frame timeline of engine. Name must outlive capture(ex. string literal or FrameTimeline::InternName). */
+#define ME_TIMELINE_SCOPE(NAME) Mile::ScopedTimelineEvent ME_TIMELINE_CONCAT(timelineEvent_, __LINE__)(NAME)
+
+namespace Mile
+{
+   DECLARE_LOG_CATEGORY_EXTERN(MileFrameTimeline, Log);
+
+   constexpr size_t DEFAULT_TIMELINE_CAPTURE_FRAMES = 120;
+   constexpr size_t TIMELINE_EVENTS_PER_THREAD = 16384;
+   /** Hitch capture is exported after a few frames, so GPU results of hitched frame are resolved before export. */
+   constexpr UINT64 TIMELINE_HITCH_EXPORT_DELAY_FRAMES = 8;
+
+   struct TimelineEvent
+   {
+      const char* Name = nullptr;
+      UINT64 Frame = 0;
+      /** Nanoseconds since timeline has been initialized */
+      long long BeginNS = 0;
+      long long EndNS = 0;
+   };
+
+   struct TimelineFrame
+   {
+      UINT64 Index = 0;
+      long long BeginNS = 0;
+      long long EndNS = 0;
+   };
+
+   struct TimelineThreadBuffer;
+   struct TimelineSnapshot;
+
+   /**
+    * @brief   Records CPU scopes of every thread and GPU scopes resolved by GPUProfiler with frame index,
+    *          and exports recent frames as Chrome trace event JSON(chrome://tracing, Perfetto).
+    *          Each thread records into its own buffer, so recording threads never contend with each other.
+    */
+   class MEAPI FrameTimeline : public SubSystem
+   {
+   public:
+      FrameTimeline(Context* context);
+      virtual ~FrameTimeline();
+
+      virtual bool Init() override;
+      virtual void DeInit() override;
+
+      /** Main thread only */
+      void BeginFrame();
+      /** Main thread only. Exports hitch capture on thread pool if it is due. */
+      void EndFrame();
+
+      UINT64 GetCurrentFrame() const { return m_currentFrame.load(std::memory_order_relaxed); }
+      long long Now() const;
+
+      void SetEnabled(bool bIsEnabled) { m_bIsEnabled.store(bIsEnabled, std::memory_order_relaxed); }
+      bool IsEnabled() const { return m_bIsEnabled.load(std::memory_order_relaxed); }
+
+      /** Number of recent frames to export. */
+      void SetCaptureFrames(size_t frames) { m_captureFrames = std::max<size_t>(frames, 1); }
+      size_t GetCaptureFrames() const { return m_captureFrames; }
+
+      /** Frames longer than threshold are captured automatically. 0 disables hitch capture. */
+      void SetHitchThreshold(double thresholdMS) { m_hitchThresholdMS = thresholdMS; }
+      double GetHitchThreshold() const { return m_hitchThresholdMS; }
+      size_t GetHitchCaptures() const { return m_hitchCaptures.load(std::memory_order_relaxed); }
+      /** Block until hitch capture which is being exported on thread pool has been written. */
+      void WaitForHitchExport();
+
+      void SetCaptureDirectory(const String& directory) { m_captureDirectory = directory; }
+      const String& GetCaptureDirectory() const { return m_captureDirectory; }
+
+      /** @return   Pointer to name which is valid until timeline is destroyed. Same pointer for same name. */
+      const char* InternName(const std::string& name);
+
+      void RecordEvent(const char* name, UINT64 frame, long long beginNS, long long endNS);
+      /** GPU scopes are recorded on separate track. Thread-safe. */
+      void RecordGPUEvent(const char* name, UINT64 frame, long long beginNS, long long endNS);
+
+      /** Main thread only. Written on calling thread. */
+      bool ExportChromeTrace(const String& filePath);
+      /** Export into capture directory as '{prefix}_{frame}.json'. @return Path of exported file, empty if failed. */
+      String ExportCapture(const String& prefix);
+
+   private:
+      TimelineThreadBuffer* GetThreadBuffer();
+      /** Copy recent frames and events, so they can be written without blocking recording threads. Main thread only. */
+      std::shared_ptr<TimelineSnapshot> TakeSnapshot();
+      /** Path in capture directory; Directory is created if it does not exist. */
+      String MakeCapturePath(const String& prefix);
+      void ExportHitch();
+
+   private:
+      /** Identifies timeline for cached thread buffer of each thread. */
+      UINT64 m_instanceID;
+      std::chrono::steady_clock::time_point m_epoch;
+      std::atomic<bool> m_bIsEnabled;
+      std::atomic<UINT64> m_currentFrame;
+
+      std::mutex m_threadsMutex;
+      std::vector<std::unique_ptr<TimelineThreadBuffer>> m_threads;
+      std::unique_ptr<TimelineThreadBuffer> m_gpuBuffer;
+
+      std::mutex m_namesMutex;
+      std::unordered_set<std::string> m_names;
+
+      /** Main thread only */
+      std::deque<TimelineFrame> m_frames;
+      size_t m_captureFrames;
+
+      double m_hitchThresholdMS;
+      UINT64 m_pendingHitchExportFrame;
+      std::atomic<size_t> m_hitchCaptures;
+      std::future<void> m_hitchExport;
+      String m_captureDirectory;
+
+   };
+
+   class MEAPI ScopedTimelineEvent
+   {
+   public:
+      ScopedTimelineEvent(const char* name);
+      ~ScopedTimelineEvent();
+
+      ScopedTimelineEvent() = delete;
+      ScopedTimelineEvent(const ScopedTimelineEvent&) = delete;
+      ScopedTimelineEvent(ScopedTimelineEvent&&) = delete;
+
+   private:
+      FrameTimeline* m_timeline;
+      const char* m_name;
+      UINT64 m_frame;
+      long long m_beginNS;
+
+   };
+}
\ No newline at end of file
@@ -50,10 +50,15 @@ namespace Mile
             ME_LOG(MileIMGUILayer, Fatal, TEXT("Renderer Subsystem does not exist!"));
             return;
          }
+         else if (renderer->GetDevice().GetNative() == nullptr)
+         {
+            ME_LOG(MileIMGUILayer, Fatal, TEXT("Renderer does not have D3D11 device!"));
+            return;
+         }
          else
          {
             ImGui_ImplWin32_Init(window->GetHandle());
-            ImGui_ImplDX11_Init(&renderer->GetDevice(), &renderer->GetImmediateContext());
+            ImGui_ImplDX11_Init(renderer->GetDevice().GetNative(), renderer->GetImmediateContext().GetNative());
          }
       }
    }
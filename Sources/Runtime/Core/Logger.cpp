@@ -5,8 +5,28 @@ namespace Mile
 {
    DEFINE_LOG_CATEGORY(MileLogger);
 
+   constexpr auto LOG_WRITER_INTERVAL = std::chrono::milliseconds(10);
+
+   struct LogRingBuffer
+   {
+      std::array<LogRecord, LOG_RING_BUFFER_CAPACITY> Records;
+      /** Consumer(writer) position */
+      alignas(64) std::atomic<size_t> Head{ 0 };
+      /** Producer(owner thread) position */
+      alignas(64) std::atomic<size_t> Tail{ 0 };
+   };
+
+   /** Ring buffer of current thread; ID of owner logger prevents reusing buffer of destroyed logger. */
+   static thread_local LogRingBuffer* CurrentLogBuffer = nullptr;
+   static thread_local size_t CurrentLogBufferOwner = 0;
+   static std::atomic<size_t> LoggerIDCounter = 0;
+
    Logger::Logger(Context* context) :
       m_folderPath(TEXT("Logs/")),
+      m_loggerID(++LoggerIDCounter),
+      m_bWriterRunning(false),
+      m_bStopWriter(false),
+      m_droppedRecords(0),
       SubSystem(context)
    {
    }
@@ -22,6 +42,32 @@ namespace Mile
       {
          m_loggingBeginTime = std::chrono::system_clock::now();
 
+         std::filesystem::create_directory(m_folderPath);
+         String targetFileName = m_folderPath +
+            Mile::TimeToWString(m_loggingBeginTime,
+               TEXT("[%d_%02d_%02d] %02d_%02d_%02d.mlog"));
+
+         // @TODO: Locale setting
+         std::locale::global(std::locale("Korean"));
+         m_logStream.open(targetFileName);
+         if (!m_logStream.is_open())
+         {
+            std::wcout << TEXT("Failed to open log stream to ")
+               << targetFileName << std::endl;
+            return false;
+         }
+
+         // Record logging start time
+         m_logStream << TEXT("#LOG BUILD TIME: ")
+            << Mile::TimeToWString(m_loggingBeginTime)
+            << std::endl
+            << TEXT("--------------------------------")
+            << std::endl;
+
+         m_bStopWriter = false;
+         m_bWriterRunning = true;
+         m_writer = std::thread(&Logger::WriterLoop, this);
+
          this->Logging(MileLogger, Log, TEXT("Logger initialized."));
          SubSystem::InitSucceed();
          return true;
@@ -35,8 +81,28 @@ namespace Mile
       if (IsInitialized())
       {
          this->Logging(MileLogger, Log, TEXT("Logger deinitialized."));
+
+         {
+            std::lock_guard<std::mutex> lock(m_writerMutex);
+            m_bStopWriter = true;
+         }
+         m_writerCondition.notify_one();
+         if (m_writer.joinable())
+         {
+            m_writer.join();
+         }
+         m_bWriterRunning = false;
+
+         /** Remaining records which logged while writer was stopping. */
          Flush();
-         m_logs.clear();
+         m_logStream << TEXT("--------------------------------") << std::endl;
+         m_logStream.close();
+
+         {
+            std::lock_guard<std::mutex> lock(m_historyMutex);
+            m_history.clear();
+         }
+
          SubSystem::DeInit();
       }
    }
@@ -50,23 +116,143 @@ namespace Mile
       ELogVerbosity verbosity,
       const Mile::String& message)
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
+      LogRecord* record = BeginRecord(category, verbosity);
+      if (record != nullptr)
+      {
+         size_t length = std::min(message.length(), LOG_MESSAGE_CAPACITY - 1);
+         std::memcpy(record->Message, message.c_str(), length * sizeof(wchar_t));
+         EndRecord(record, static_cast<int>(length));
+      }
+   }
+
+   LogRingBuffer* Logger::AcquireThreadBuffer()
+   {
+      if (CurrentLogBufferOwner != m_loggerID)
+      {
+         /** First log of this thread; Registration happens only once per thread. */
+         std::lock_guard<std::mutex> lock(m_buffersMutex);
+         m_buffers.push_back(std::make_unique<LogRingBuffer>());
+         CurrentLogBuffer = m_buffers.back().get();
+         CurrentLogBufferOwner = m_loggerID;
+      }
+
+      return CurrentLogBuffer;
+   }
+
+   LogRecord* Logger::BeginRecord(const LogCategoryBase& category, ELogVerbosity verbosity)
+   {
+      ELogVerbosity finalVerbosity = LogCategoryBase::ResolveVerbosity(verbosity, category.DefaultVerbosity);
+      if (category.IsSuppressed(finalVerbosity))
+      {
+         return nullptr;
+      }
+
+      LogRingBuffer* buffer = AcquireThreadBuffer();
+      size_t tail = buffer->Tail.load(std::memory_order_relaxed);
+      while ((tail - buffer->Head.load(std::memory_order_acquire)) >= LOG_RING_BUFFER_CAPACITY)
+      {
+         if (!m_bWriterRunning.load(std::memory_order_acquire) || (std::this_thread::get_id() == m_writer.get_id()))
+         {
+            m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+         }
+
+         /** Ring buffer is full; Wait until writer drains it. */
+         m_writerCondition.notify_one();
+         std::this_thread::yield();
+      }
+
+      LogRecord& record = buffer->Records[tail % LOG_RING_BUFFER_CAPACITY];
+      record.Category = &category;
+      record.Verbosity = finalVerbosity;
+      record.Time = std::chrono::system_clock::now();
+      return &record;
+   }
+
+   void Logger::EndRecord(LogRecord* record, int length)
+   {
+      /** _snwprintf returns negative value if message has been truncated. */
+      size_t finalLength = (length < 0) ? (LOG_MESSAGE_CAPACITY - 1) : std::min(static_cast<size_t>(length), LOG_MESSAGE_CAPACITY - 1);
+      record->Message[finalLength] = TEXT('\0');
+      record->Length = finalLength;
+
+      LogRingBuffer* buffer = CurrentLogBuffer;
+      size_t tail = buffer->Tail.load(std::memory_order_relaxed) + 1;
+      buffer->Tail.store(tail, std::memory_order_release);
+
+      if ((tail - buffer->Head.load(std::memory_order_relaxed)) >= (LOG_RING_BUFFER_CAPACITY / 2))
+      {
+         m_writerCondition.notify_one();
+      }
+   }
+
+   void Logger::WriterLoop()
+   {
+      while (true)
+      {
+         {
+            std::unique_lock<std::mutex> lock(m_writerMutex);
+            m_writerCondition.wait_for(lock, LOG_WRITER_INTERVAL,
+               [this]() { return m_bStopWriter.load(std::memory_order_acquire); });
+         }
+
+         Drain();
+
+         if (m_bStopWriter.load(std::memory_order_acquire))
+         {
+            break;
+         }
+      }
+   }
+
+   void Logger::Drain()
+   {
       OPTICK_EVENT();
-      ELogVerbosity finalVerbosity = verbosity;
-      if (finalVerbosity == ELogVerbosity::All)
+      std::lock_guard<std::mutex> drainLock(m_drainMutex);
+      std::vector<LogRingBuffer*> buffers;
       {
-         finalVerbosity = category.DefaultVerbosity;
+         std::lock_guard<std::mutex> lock(m_buffersMutex);
+         buffers.reserve(m_buffers.size());
+         for (auto& buffer : m_buffers)
+         {
+            buffers.push_back(buffer.get());
+         }
+      }
+
+      bool bWritten = false;
+      for (auto buffer : buffers)
+      {
+         size_t head = buffer->Head.load(std::memory_order_relaxed);
+         size_t tail = buffer->Tail.load(std::memory_order_acquire);
+         for (; head != tail; ++head)
+         {
+            Write(buffer->Records[head % LOG_RING_BUFFER_CAPACITY]);
+            bWritten = true;
+         }
+
+         buffer->Head.store(head, std::memory_order_release);
       }
 
-      auto log = MLog{ category, finalVerbosity, message, std::chrono::system_clock::now() };
-      m_logs.push_front(log);
+      if (bWritten)
+      {
+         m_logStream.flush();
+      }
+   }
 
+   void Logger::Write(const LogRecord& record)
+   {
+      auto log = MLog{ record.Category, record.Verbosity, Mile::String(record.Message, record.Length), record.Time };
+      if (m_logStream.is_open())
+      {
+         /** Stream is flushed once per drain. */
+         m_logStream << Logger::LogToStr(log) << TEXT('\n');
+      }
 
 #ifdef _DEBUG
       SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), FOREGROUND_INTENSITY);
       std::wcout << TEXT("[") << TimeToWString(log.Time) << TEXT("]");
-      SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), VerbosityToConsoleColor(finalVerbosity));
-      std::wcout << TEXT("[") << log.Category.Name << TEXT("]");
+      SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), VerbosityToConsoleColor(log.Verbosity));
+      std::wcout << TEXT("[") << log.Category->Name << TEXT("]");
       if (log.Verbosity != ELogVerbosity::Log)
       {
          std::wcout << TEXT("[") << VerbosityToString(log.Verbosity) << TEXT("]");
@@ -74,17 +260,25 @@ namespace Mile
       std::wcout << TEXT(" ") << log.Message << std::endl;
       SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), VerbosityToConsoleColor(ELogVerbosity::All));
 #endif
+
+      std::lock_guard<std::mutex> lock(m_historyMutex);
+      if (m_history.size() >= LOG_HISTORY_CAPACITY)
+      {
+         m_history.pop_front();
+      }
+      m_history.push_back(std::move(log));
    }
 
    LogList Logger::Filtering(const LogCategoryBase& category, ELogVerbosity verbosity) const
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
+      std::lock_guard<std::mutex> lock(m_historyMutex);
       LogList tempList{ };
 
-      for (auto log : m_logs)
+      for (auto itr = m_history.rbegin(); itr != m_history.rend(); ++itr)
       {
-         bool bCheckCategory = category.Name == log.Category.Name;
-         bool bCheckVerbosity = 
+         const auto& log = (*itr);
+         bool bCheckCategory = category.Name == log.Category->Name;
+         bool bCheckVerbosity =
             verbosity == ELogVerbosity::All ||
             log.Verbosity == verbosity;
          if (bCheckCategory && bCheckVerbosity)
@@ -96,26 +290,29 @@ namespace Mile
       return tempList;
    }
 
+   Logger* Logger::GetGlobalLogger()
+   {
+      return Engine::GetLogger();
+   }
+
    void Logger::GlobalLogging(const LogCategoryBase& category, ELogVerbosity verbosity, const Mile::String& message)
    {
-      auto globalLogger = Engine::GetLogger();
+      auto globalLogger = GetGlobalLogger();
       if (globalLogger != nullptr)
       {
          globalLogger->Logging(category, verbosity, message);
       }
    }
 
-   bool Logger::Flush(const LogList& list)
+   bool Logger::Flush(const LogList& list, const Mile::String& suffix)
    {
       std::filesystem::create_directory(m_folderPath);
 
       // Open Stream
       String targetFileName = m_folderPath +
          Mile::TimeToWString(std::chrono::system_clock::now(),
-            TEXT("[%d_%02d_%02d] %02d_%02d_%02d.mlog"));
+            TEXT("[%d_%02d_%02d] %02d_%02d_%02d")) + suffix + TEXT(".mlog");
 
-      // @TODO: Locale setting
-      std::locale::global(std::locale("Korean"));
       std::wofstream logStream{ targetFileName };
       if (!logStream.is_open())
       {
@@ -132,7 +329,7 @@ namespace Mile
          << std::endl;
 
       // Record logs
-      for (auto log : list)
+      for (const auto& log : list)
       {
          auto logStr = Logger::LogToStr(log);
          // Write to stream
@@ -150,11 +347,12 @@ namespace Mile
 
    bool Logger::Flush(const LogCategoryBase& category, ELogVerbosity verbosity)
    {
-      return Flush(Filtering(category, verbosity));
+      return Flush(Filtering(category, verbosity), TEXT("_") + category.Name);
    }
 
    bool Logger::Flush()
    {
-      return Flush(m_logs);
+      Drain();
+      return m_logStream.good();
    }
 }
\ No newline at end of file
@@ -28,25 +28,66 @@ namespace Mile
    public:
       LogCategoryBase(const Mile::String& name, ELogVerbosity defaultVerbosity) :
          Name(name),
-         DefaultVerbosity(defaultVerbosity)
+         DefaultVerbosity(defaultVerbosity),
+         RuntimeVerbosity(ELogVerbosity::Log)
       {
       }
 
+      /** Replace 'All' with default verbosity of category. */
+      static constexpr ELogVerbosity ResolveVerbosity(ELogVerbosity verbosity, ELogVerbosity defaultVerbosity)
+      {
+         return (verbosity == ELogVerbosity::All) ? defaultVerbosity : verbosity;
+      }
+
+      /** Logs which are more verbose than runtime verbosity of category will be discarded before formatting. */
+      bool IsSuppressed(ELogVerbosity verbosity) const
+      {
+         return verbosity > RuntimeVerbosity.load(std::memory_order_relaxed);
+      }
+
+      void SetRuntimeVerbosity(ELogVerbosity verbosity) { RuntimeVerbosity.store(verbosity, std::memory_order_relaxed); }
+      ELogVerbosity GetRuntimeVerbosity() const { return RuntimeVerbosity.load(std::memory_order_relaxed); }
+
    public:
       Mile::String Name = TEXT("Unknown");
       ELogVerbosity DefaultVerbosity = ELogVerbosity::Log;
 
+   private:
+      std::atomic<ELogVerbosity> RuntimeVerbosity;
+
+   };
+
+   constexpr size_t LOG_MESSAGE_CAPACITY = 256;
+   constexpr size_t LOG_RING_BUFFER_CAPACITY = 256;
+   constexpr size_t LOG_HISTORY_CAPACITY = 1024;
+
+   /** Fixed size log record which is formatted in place on ring buffer of logging thread. */
+   struct MEAPI LogRecord
+   {
+      const LogCategoryBase* Category = nullptr;
+      ELogVerbosity Verbosity = ELogVerbosity::All;
+      std::chrono::system_clock::time_point Time = std::chrono::system_clock::time_point();
+      size_t Length = 0;
+      wchar_t Message[LOG_MESSAGE_CAPACITY];
    };
 
    struct MEAPI MLog
    {
-      LogCategoryBase Category;
+      const LogCategoryBase* Category = nullptr;
       ELogVerbosity Verbosity = ELogVerbosity::All;
       Mile::String Message = TEXT("");
       std::chrono::system_clock::time_point Time = std::chrono::system_clock::time_point();
    };
 
    using LogList = std::forward_list<MLog>;
+
+   struct LogRingBuffer;
+
+   /**
+    * @brief   Every logging thread owns a lock-free single producer ring buffer of preformatted records.
+    *          Background writer thread drains them and streams to .mlog file incrementally,
+    *          only latest LOG_HISTORY_CAPACITY logs are kept in memory.
+    */
    class MEAPI Logger : public SubSystem
    {
    public:
@@ -62,11 +103,30 @@ namespace Mile
          ELogVerbosity verbosity = ELogVerbosity::All,
          const Mile::String& message = TEXT(""));
 
+      /** Format message directly into ring buffer without any heap allocation. Message longer than LOG_MESSAGE_CAPACITY will be truncated. */
+      template <typename... Args>
+      void Logging(const LogCategoryBase& category, ELogVerbosity verbosity, const wchar_t* format, Args... args)
+      {
+         LogRecord* record = BeginRecord(category, verbosity);
+         if (record != nullptr)
+         {
+            int length = _snwprintf(record->Message, LOG_MESSAGE_CAPACITY, format, args...);
+            EndRecord(record, length);
+         }
+      }
+
+      template <typename... Args>
+      void Logging(const LogCategoryBase& category, ELogVerbosity verbosity, const Mile::String& format, Args... args)
+      {
+         Logging(category, verbosity, format.c_str(), args...);
+      }
+
+      /** Filtering logs in bounded history. */
       LogList Filtering(const LogCategoryBase& category, ELogVerbosity verbosity) const;
 
-      /** Flush Լ Thread-safe  ʽϴ. */
+      /** Write pending records of every threads to log file immediately. */
       bool Flush();
-      /** Flush Լ Thread-safe  ʽϴ. */
+      /** Write logs of category in history to separated log file. */
       bool Flush(const LogCategoryBase& category, ELogVerbosity verbosity = ELogVerbosity::All);
 
       static Mile::String VerbosityToString(ELogVerbosity verbosity)
@@ -110,7 +170,7 @@ namespace Mile
          auto timeStr = TimeToWString(log.Time);
          auto result = Formatting(TEXT("[%s][%s][%s] %s"),
             timeStr.c_str(),
-            log.Category.Name.c_str(),
+            log.Category->Name.c_str(),
             typeStr.c_str(),
             log.Message.c_str());
          return result;
@@ -120,14 +180,60 @@ namespace Mile
          ELogVerbosity verbosity = ELogVerbosity::All,
          const Mile::String& message = TEXT(""));
 
+      template <typename... Args>
+      static void GlobalLogging(const LogCategoryBase& category, ELogVerbosity verbosity, const wchar_t* format, Args... args)
+      {
+         auto globalLogger = GetGlobalLogger();
+         if (globalLogger != nullptr)
+         {
+            globalLogger->Logging(category, verbosity, format, args...);
+         }
+      }
+
+      template <typename... Args>
+      static void GlobalLogging(const LogCategoryBase& category, ELogVerbosity verbosity, const Mile::String& format, Args... args)
+      {
+         GlobalLogging(category, verbosity, format.c_str(), args...);
+      }
+
+      /** Number of records which dropped because ring buffer was full while writer is not running. */
+      size_t GetDroppedRecords() const { return m_droppedRecords.load(std::memory_order_relaxed); }
+
    private:
-      bool Flush(const LogList& list);
+      bool Flush(const LogList& list, const Mile::String& suffix);
+
+      static Logger* GetGlobalLogger();
+
+      /** @return nullptr if record has been dropped. */
+      LogRecord* BeginRecord(const LogCategoryBase& category, ELogVerbosity verbosity);
+      void EndRecord(LogRecord* record, int length);
+      LogRingBuffer* AcquireThreadBuffer();
+
+      void WriterLoop();
+      /** Only one thread may drain at once. */
+      void Drain();
+      void Write(const LogRecord& record);
 
    private:
-      mutable std::mutex m_mutex;
       String   m_folderPath;
-      LogList  m_logs;
       std::chrono::system_clock::time_point  m_loggingBeginTime;
+      size_t   m_loggerID;
+
+      std::mutex m_buffersMutex;
+      std::vector<std::unique_ptr<LogRingBuffer>> m_buffers;
+
+      std::mutex m_drainMutex;
+      std::wofstream m_logStream;
+
+      mutable std::mutex m_historyMutex;
+      std::deque<MLog> m_history;
+
+      std::thread m_writer;
+      std::mutex m_writerMutex;
+      std::condition_variable m_writerCondition;
+      std::atomic<bool> m_bWriterRunning;
+      std::atomic<bool> m_bStopWriter;
+      std::atomic<size_t> m_droppedRecords;
 
    };
 
@@ -135,6 +241,7 @@ namespace Mile
    namespace DefinedLogCategoryType { \
       struct CategoryName##Type : public LogCategoryBase { \
       public: \
+         static constexpr ELogVerbosity CompileTimeDefaultVerbosity = DefaultVerbosity; \
          CategoryName##Type() : LogCategoryBase(TEXT(#CategoryName), DefaultVerbosity) \
          { \
          } \
@@ -150,8 +257,31 @@ namespace Mile
 
 #define DEFINE_LOG_CATEGORY(CategoryName) DefinedLogCategoryType::CategoryName##Type CategoryName
 
-/* Mile Engine Log **/
-#define ME_LOG(CategoryName, Verbosity, Message, ...) Logger::GlobalLogging(CategoryName, Verbosity, Formatting(Message, __VA_ARGS__))
+/**
+ * Logs which are more verbose than ME_LOG_COMPILE_TIME_VERBOSITY are compiled out entirely.
+ * Define it before including Logger.h (or as preprocessor definition) to override.
+ */
+#ifndef ME_LOG_COMPILE_TIME_VERBOSITY
+#if defined(DEBUG) || defined(_DEBUG)
+#define ME_LOG_COMPILE_TIME_VERBOSITY ELogVerbosity::Log
+#else
+#define ME_LOG_COMPILE_TIME_VERBOSITY ELogVerbosity::Display
+#endif
+#endif
+
+/* Mile Engine Log; Arguments are not evaluated for disabled log. **/
+#define ME_LOG(CategoryName, Verbosity, Message, ...) \
+   do \
+   { \
+      constexpr ELogVerbosity ResolvedLogVerbosity = LogCategoryBase::ResolveVerbosity(Verbosity, std::decay_t<decltype(CategoryName)>::CompileTimeDefaultVerbosity); \
+      if constexpr (ResolvedLogVerbosity <= ME_LOG_COMPILE_TIME_VERBOSITY) \
+      { \
+         if (!CategoryName.IsSuppressed(ResolvedLogVerbosity)) \
+         { \
+            Logger::GlobalLogging(CategoryName, ResolvedLogVerbosity, Message, __VA_ARGS__); \
+         } \
+      } \
+   } while (false)
 
 DECLARE_LOG_CATEGORY_EXTERN(MileLogger, Log);
 }
\ No newline at end of file
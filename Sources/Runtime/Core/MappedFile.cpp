@@ -0,0 +1,76 @@
+#include "Core/MappedFile.h"
+
+namespace Mile
+{
+   MappedFile::MappedFile() :
+      m_file(INVALID_HANDLE_VALUE),
+      m_mapping(nullptr),
+      m_data(nullptr),
+      m_size(0)
+   {
+   }
+
+   MappedFile::~MappedFile()
+   {
+      Close();
+   }
+
+   bool MappedFile::Open(const String& filePath)
+   {
+      Close();
+
+      m_file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+      if (m_file == INVALID_HANDLE_VALUE)
+      {
+         return false;
+      }
+
+      LARGE_INTEGER fileSize;
+      /** Empty file can not be mapped. */
+      if (!GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart == 0)
+      {
+         Close();
+         return false;
+      }
+
+      m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (m_mapping == nullptr)
+      {
+         Close();
+         return false;
+      }
+
+      m_data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+      if (m_data == nullptr)
+      {
+         Close();
+         return false;
+      }
+
+      m_size = static_cast<size_t>(fileSize.QuadPart);
+      return true;
+   }
+
+   void MappedFile::Close()
+   {
+      if (m_data != nullptr)
+      {
+         UnmapViewOfFile(m_data);
+         m_data = nullptr;
+      }
+
+      if (m_mapping != nullptr)
+      {
+         CloseHandle(m_mapping);
+         m_mapping = nullptr;
+      }
+
+      if (m_file != INVALID_HANDLE_VALUE)
+      {
+         CloseHandle(m_file);
+         m_file = INVALID_HANDLE_VALUE;
+      }
+
+      m_size = 0;
+   }
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+
+namespace Mile
+{
+   /**
+    * @brief   Read only memory mapped file. Pages are loaded by OS on first access,
+    *          so data can be read in place without copying whole file into memory.
+    */
+   class MEAPI MappedFile
+   {
+   public:
+      MappedFile();
+      ~MappedFile();
+
+      MappedFile(const MappedFile&) = delete;
+      MappedFile& operator=(const MappedFile&) = delete;
+
+      bool Open(const String& filePath);
+      void Close();
+
+      bool IsOpened() const { return (m_data != nullptr); }
+      const void* GetData() const { return m_data; }
+      size_t GetSize() const { return m_size; }
+
+   private:
+      HANDLE m_file;
+      HANDLE m_mapping;
+      const void* m_data;
+      size_t m_size;
+
+   };
+}
\ No newline at end of file
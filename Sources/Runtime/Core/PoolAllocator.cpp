@@ -0,0 +1,163 @@
+#include "Core/PoolAllocator.h"
+
+namespace Mile
+{
+   PoolAllocator::PoolAllocator(size_t blockSize, size_t blockAlignment, size_t blocksPerChunk) :
+      m_blockAlignment(std::max(blockAlignment, alignof(FreeBlock))),
+      m_blocksPerChunk(std::max<size_t>(blocksPerChunk, 1)),
+      m_freeList(nullptr),
+      m_chunkCursor(nullptr),
+      m_chunkEnd(nullptr)
+   {
+      /** Every block has to be able to hold free list link and keep alignment of next block. */
+      size_t size = std::max(blockSize, sizeof(FreeBlock));
+      m_blockSize = (size + (m_blockAlignment - 1)) & ~(m_blockAlignment - 1);
+      m_stats.BlockSize = m_blockSize;
+   }
+
+   PoolAllocator::~PoolAllocator()
+   {
+      Release();
+   }
+
+   void* PoolAllocator::Allocate()
+   {
+      void* block = nullptr;
+      if (m_freeList != nullptr)
+      {
+         block = m_freeList;
+         m_freeList = m_freeList->Next;
+      }
+      else
+      {
+         if (m_chunkCursor == m_chunkEnd)
+         {
+            size_t chunkSize = m_blockSize * m_blocksPerChunk;
+            void* chunk = ::operator new(chunkSize, std::align_val_t(m_blockAlignment));
+            m_chunks.push_back(chunk);
+            m_chunkCursor = reinterpret_cast<UINT8*>(chunk);
+            m_chunkEnd = m_chunkCursor + chunkSize;
+            ++m_stats.ChunksNum;
+            m_stats.ReservedBytes += chunkSize;
+         }
+
+         block = m_chunkCursor;
+         m_chunkCursor += m_blockSize;
+      }
+
+      ++m_stats.AllocatedBlocks;
+      ++m_stats.TotalAllocations;
+      m_stats.PeakAllocatedBlocks = std::max(m_stats.PeakAllocatedBlocks, m_stats.AllocatedBlocks);
+      return block;
+   }
+
+   void PoolAllocator::Deallocate(void* block)
+   {
+      if (block != nullptr)
+      {
+         FreeBlock* freeBlock = reinterpret_cast<FreeBlock*>(block);
+         freeBlock->Next = m_freeList;
+         m_freeList = freeBlock;
+         --m_stats.AllocatedBlocks;
+      }
+   }
+
+   void PoolAllocator::Release()
+   {
+      for (void* chunk : m_chunks)
+      {
+         ::operator delete(chunk, std::align_val_t(m_blockAlignment));
+      }
+
+      m_chunks.clear();
+      m_freeList = nullptr;
+      m_chunkCursor = nullptr;
+      m_chunkEnd = nullptr;
+      m_stats.AllocatedBlocks = 0;
+      m_stats.ChunksNum = 0;
+      m_stats.ReservedBytes = 0;
+   }
+
+   PoolAllocator* ObjectPoolAllocator::FindPool(const std::type_info& type) const
+   {
+      for (const auto& pool : m_pools)
+      {
+         if (pool.first == type)
+         {
+            return pool.second.get();
+         }
+      }
+
+      return nullptr;
+   }
+
+   void* ObjectPoolAllocator::Allocate(const std::type_info& type, size_t size, size_t alignment)
+   {
+      assert(!m_bIsLocked && "Object must not be created while allocator is locked.");
+      PoolAllocator* pool = FindPool(type);
+      if (pool == nullptr)
+      {
+         m_pools.emplace_back(std::type_index(type), std::make_unique<PoolAllocator>(size, alignment));
+         pool = m_pools.back().second.get();
+      }
+
+      return pool->Allocate();
+   }
+
+   void ObjectPoolAllocator::Deallocate(const std::type_info& type, void* block)
+   {
+      assert(!m_bIsLocked && "Object must not be destroyed while allocator is locked.");
+      PoolAllocator* pool = FindPool(type);
+      if (pool != nullptr)
+      {
+         pool->Deallocate(block);
+      }
+   }
+
+   void ObjectPoolAllocator::Release()
+   {
+      for (auto& pool : m_pools)
+      {
+         pool.second->Release();
+      }
+   }
+
+   PoolAllocatorStats ObjectPoolAllocator::GetStats(const std::type_info& type) const
+   {
+      PoolAllocator* pool = FindPool(type);
+      if (pool != nullptr)
+      {
+         return pool->GetStats();
+      }
+
+      return PoolAllocatorStats();
+   }
+
+   PoolAllocatorStats ObjectPoolAllocator::GetTotalStats() const
+   {
+      PoolAllocatorStats total;
+      for (const auto& pool : m_pools)
+      {
+         const PoolAllocatorStats& stats = pool.second->GetStats();
+         total.AllocatedBlocks += stats.AllocatedBlocks;
+         total.PeakAllocatedBlocks += stats.PeakAllocatedBlocks;
+         total.TotalAllocations += stats.TotalAllocations;
+         total.ChunksNum += stats.ChunksNum;
+         total.ReservedBytes += stats.ReservedBytes;
+      }
+
+      return total;
+   }
+
+   std::vector<std::pair<std::string, PoolAllocatorStats>> ObjectPoolAllocator::GetStatsPerType() const
+   {
+      std::vector<std::pair<std::string, PoolAllocatorStats>> statsPerType;
+      statsPerType.reserve(m_pools.size());
+      for (const auto& pool : m_pools)
+      {
+         statsPerType.emplace_back(pool.first.name(), pool.second->GetStats());
+      }
+
+      return statsPerType;
+   }
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+#include <typeindex>
+#include <new>
+#include <cassert>
+
+namespace Mile
+{
+   constexpr size_t DEFAULT_POOL_BLOCKS_PER_CHUNK = 256;
+
+   struct PoolAllocatorStats
+   {
+      size_t BlockSize = 0;
+      size_t AllocatedBlocks = 0;
+      size_t PeakAllocatedBlocks = 0;
+      size_t TotalAllocations = 0;
+      size_t ChunksNum = 0;
+      size_t ReservedBytes = 0;
+   };
+
+   /**
+    * @brief   Fixed size block allocator. Blocks are carved from chunks in order, so blocks allocated in a row are contiguous.
+    *          Freed blocks are reused first. Not thread-safe.
+    */
+   class MEAPI PoolAllocator
+   {
+   public:
+      PoolAllocator(size_t blockSize, size_t blockAlignment, size_t blocksPerChunk = DEFAULT_POOL_BLOCKS_PER_CHUNK);
+      ~PoolAllocator();
+
+      PoolAllocator(const PoolAllocator&) = delete;
+      PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+      void* Allocate();
+      void Deallocate(void* block);
+
+      /**
+       * @brief   Free every chunk at once. Objects in blocks are not destructed,
+       *          so every object must have been destructed before release.
+       */
+      void Release();
+
+      const PoolAllocatorStats& GetStats() const { return m_stats; }
+
+   private:
+      struct FreeBlock
+      {
+         FreeBlock* Next;
+      };
+
+   private:
+      size_t m_blockSize;
+      size_t m_blockAlignment;
+      size_t m_blocksPerChunk;
+      std::vector<void*> m_chunks;
+      FreeBlock* m_freeList;
+      UINT8* m_chunkCursor;
+      UINT8* m_chunkEnd;
+      PoolAllocatorStats m_stats;
+
+   };
+
+   /**
+    * @brief   Keep objects of same type in same pool. Pools are created on first allocation of each type.
+    *          Polymorphic objects return to the pool of their dynamic type. Not thread-safe.
+    */
+   class MEAPI ObjectPoolAllocator
+   {
+   public:
+      ObjectPoolAllocator() : m_bIsLocked(false) { }
+      ~ObjectPoolAllocator() = default;
+
+      ObjectPoolAllocator(const ObjectPoolAllocator&) = delete;
+      ObjectPoolAllocator& operator=(const ObjectPoolAllocator&) = delete;
+
+      void* Allocate(const std::type_info& type, size_t size, size_t alignment);
+      void Deallocate(const std::type_info& type, void* block);
+
+      template <typename Ty, typename... Args>
+      Ty* New(Args&& ... args)
+      {
+         void* block = Allocate(typeid(Ty), sizeof(Ty), alignof(Ty));
+         return new (block) Ty(std::forward<Args>(args)...);
+      }
+
+      template <typename Ty>
+      void Delete(Ty* object)
+      {
+         if (object != nullptr)
+         {
+            /** Dynamic type has to be resolved before destruction. */
+            const std::type_info& type = typeid(*object);
+            void* block = nullptr;
+            if constexpr (std::is_polymorphic_v<Ty>)
+            {
+               block = dynamic_cast<void*>(object);
+            }
+            else
+            {
+               block = static_cast<void*>(object);
+            }
+            object->~Ty();
+            Deallocate(type, block);
+         }
+      }
+
+      /**
+       * @brief   Allocator is not thread-safe. While locked(ex. during parallel update of world),
+       *          any allocation or deallocation is a bug and asserted.
+       */
+      void SetLocked(bool bIsLocked) { m_bIsLocked = bIsLocked; }
+      bool IsLocked() const { return m_bIsLocked; }
+
+      /** Free every chunk of every pool. Every object must have been deleted before release. */
+      void Release();
+
+      PoolAllocatorStats GetStats(const std::type_info& type) const;
+      /** Stats of every pool, summed. */
+      PoolAllocatorStats GetTotalStats() const;
+      /** Type name and stats of each pool. */
+      std::vector<std::pair<std::string, PoolAllocatorStats>> GetStatsPerType() const;
+
+   private:
+      PoolAllocator* FindPool(const std::type_info& type) const;
+
+   private:
+      /** World has only a few types of object, so linear search is faster than hashing type name. */
+      std::vector<std::pair<std::type_index, std::unique_ptr<PoolAllocator>>> m_pools;
+      bool m_bIsLocked;
+
+   };
+}
\ No newline at end of file
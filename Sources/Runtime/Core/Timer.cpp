@@ -7,6 +7,8 @@ namespace Mile
 
    Timer::Timer(Context* context) :
       m_frameCount(0), m_framePerSec(0), m_deltaTime(),
+      m_targetFrameTime(0), m_frameTimeHistory(), m_frameTimeHistoryHead(0), m_frameTimeHistoryNum(0),
+      m_sleepOvershootMean(static_cast<double>(FRAME_PACING_SLEEP_QUANTUM_NS)), m_sleepOvershootM2(0.0), m_sleepOvershootSamples(1),
       SubSystem(context)
    {
    }
@@ -25,6 +27,9 @@ namespace Mile
          m_deltaTime = m_frameEndTime - m_frameBeginTime;
          m_frameCount = 0;
 
+         /** Default scheduler granularity of Windows(about 15.6ms) is too coarse to sleep in frame time. */
+         timeBeginPeriod(1);
+
          ME_LOG(MileTimer, Log, TEXT("Timer initialized."));
          SubSystem::InitSucceed();
          return true;
@@ -38,6 +43,7 @@ namespace Mile
    {
       if (IsInitialized())
       {
+         timeEndPeriod(1);
          ME_LOG(MileTimer, Log, TEXT("Timer deinitialized."));
          SubSystem::DeInit();
       }
@@ -67,5 +73,97 @@ namespace Mile
          m_frameMeasureBeginTime = m_frameEndTime;
          m_frameCount = 0;
       }
+
+      m_frameTimeHistory[m_frameTimeHistoryHead] = m_deltaTime.count();
+      m_frameTimeHistoryHead = (m_frameTimeHistoryHead + 1) % FRAME_PACING_HISTORY_SIZE;
+      m_frameTimeHistoryNum = std::min(m_frameTimeHistoryNum + 1, FRAME_PACING_HISTORY_SIZE);
+   }
+
+   void Timer::WaitForTargetFrameTime(long long targetFrameTimeNS)
+   {
+      OPTICK_EVENT();
+      m_targetFrameTime = targetFrameTimeNS;
+      SleepUntil(m_frameBeginTime + std::chrono::nanoseconds(targetFrameTimeNS));
+   }
+
+   void Timer::SleepUntil(std::chrono::steady_clock::time_point deadline)
+   {
+      auto now = std::chrono::steady_clock::now();
+      while (true)
+      {
+         double stdDev = std::sqrt(m_sleepOvershootM2 / static_cast<double>(m_sleepOvershootSamples));
+         double sleepMargin = m_sleepOvershootMean + stdDev;
+         long long remaining = (deadline - now).count();
+         if (static_cast<double>(remaining) <= (static_cast<double>(FRAME_PACING_SLEEP_QUANTUM_NS) + sleepMargin))
+         {
+            break;
+         }
+
+         auto sleepBegin = now;
+         std::this_thread::sleep_for(std::chrono::nanoseconds(FRAME_PACING_SLEEP_QUANTUM_NS));
+         now = std::chrono::steady_clock::now();
+
+         double overshoot = static_cast<double>((now - sleepBegin).count() - FRAME_PACING_SLEEP_QUANTUM_NS);
+         m_sleepOvershootSamples = std::min(m_sleepOvershootSamples + 1, FRAME_PACING_SLEEP_ESTIMATE_MAX_SAMPLES);
+         double delta = overshoot - m_sleepOvershootMean;
+         m_sleepOvershootMean += delta / static_cast<double>(m_sleepOvershootSamples);
+         m_sleepOvershootM2 += delta * (overshoot - m_sleepOvershootMean);
+         if (m_sleepOvershootSamples == FRAME_PACING_SLEEP_ESTIMATE_MAX_SAMPLES)
+         {
+            /** Keep variance of capped sample count. */
+            m_sleepOvershootM2 *= static_cast<double>(m_sleepOvershootSamples - 1) / static_cast<double>(m_sleepOvershootSamples);
+         }
+      }
+
+      while (now < deadline)
+      {
+         YieldProcessor();
+         now = std::chrono::steady_clock::now();
+      }
+   }
+
+   FramePacingStats Timer::GetPacingStats() const
+   {
+      FramePacingStats stats;
+      stats.TargetFrameTimeNS = m_targetFrameTime;
+      stats.Samples = m_frameTimeHistoryNum;
+      stats.SleepOvershootNS = m_sleepOvershootMean;
+      if (m_frameTimeHistoryNum == 0)
+      {
+         return stats;
+      }
+
+      stats.MinFrameTimeNS = std::numeric_limits<long long>::max();
+      double sum = 0.0;
+      double errorSum = 0.0;
+      for (size_t idx = 0; idx < m_frameTimeHistoryNum; ++idx)
+      {
+         long long frameTime = m_frameTimeHistory[idx];
+         sum += static_cast<double>(frameTime);
+         stats.MinFrameTimeNS = std::min(stats.MinFrameTimeNS, frameTime);
+         stats.MaxFrameTimeNS = std::max(stats.MaxFrameTimeNS, frameTime);
+         if (m_targetFrameTime > 0)
+         {
+            errorSum += static_cast<double>(std::abs(frameTime - m_targetFrameTime));
+            if (frameTime > (m_targetFrameTime + FRAME_PACING_MISS_TOLERANCE_NS))
+            {
+               ++stats.MissedFrames;
+            }
+         }
+      }
+
+      double samples = static_cast<double>(m_frameTimeHistoryNum);
+      stats.AvgFrameTimeNS = sum / samples;
+      stats.AvgErrorNS = errorSum / samples;
+
+      double squaredSum = 0.0;
+      for (size_t idx = 0; idx < m_frameTimeHistoryNum; ++idx)
+      {
+         double diff = static_cast<double>(m_frameTimeHistory[idx]) - stats.AvgFrameTimeNS;
+         squaredSum += diff * diff;
+      }
+      stats.JitterNS = std::sqrt(squaredSum / samples);
+
+      return stats;
    }
 }
\ No newline at end of file
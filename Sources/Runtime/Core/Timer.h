@@ -5,6 +5,31 @@ namespace Mile
 {
    DECLARE_LOG_CATEGORY_EXTERN(MileTimer, Log);
 
+   constexpr size_t FRAME_PACING_HISTORY_SIZE = 120;
+   /** Frame pacer requests OS sleep in this unit while remaining time is long enough. */
+   constexpr long long FRAME_PACING_SLEEP_QUANTUM_NS = 1000000;
+   /** Frames longer than target frame time by more than tolerance are counted as missed. */
+   constexpr long long FRAME_PACING_MISS_TOLERANCE_NS = 500000;
+   /** Upper bound of samples for sleep overshoot estimation, so estimation keeps following recent behaviour of OS scheduler. */
+   constexpr long long FRAME_PACING_SLEEP_ESTIMATE_MAX_SAMPLES = 1000;
+
+   /** Statistics of recent FRAME_PACING_HISTORY_SIZE frames. */
+   struct MEAPI FramePacingStats
+   {
+      long long TargetFrameTimeNS = 0;
+      double AvgFrameTimeNS = 0.0;
+      long long MinFrameTimeNS = 0;
+      long long MaxFrameTimeNS = 0;
+      /** Standard deviation of frame time */
+      double JitterNS = 0.0;
+      /** Average of absolute difference between frame time and target frame time */
+      double AvgErrorNS = 0.0;
+      size_t MissedFrames = 0;
+      size_t Samples = 0;
+      /** Estimated overshoot of single OS sleep request */
+      double SleepOvershootNS = 0.0;
+   };
+
    /**
     * @brief	Timer  ý   ð õ  ϰų ִ Ŭ Դϴ.
     */
@@ -28,6 +53,20 @@ namespace Mile
        */
       void PostEndFrame();
 
+      /**
+       * @brief   Wait until target frame time has elapsed since BeginFrame. If frame already took longer than target, returns immediately.
+       *          Call between PreEndFrame and PostEndFrame.
+       */
+      void WaitForTargetFrameTime(long long targetFrameTimeNS);
+
+      /**
+       * @brief   Hybrid sleep. Sleeps on OS while remaining time is longer than estimated sleep overshoot,
+       *          then spins only for the rest of time(usually less than a millisecond).
+       */
+      void SleepUntil(std::chrono::steady_clock::time_point deadline);
+
+      FramePacingStats GetPacingStats() const;
+
       /**
        * @brief	 Ӱ  ӻ̿ ð ̸ ''  ȯ ݴϴ.
        * @return Ӱ  ð()
@@ -69,5 +108,15 @@ namespace Mile
       long long   m_frameCount;
       long long   m_framePerSec;
 
+      long long   m_targetFrameTime;
+      std::array<long long, FRAME_PACING_HISTORY_SIZE> m_frameTimeHistory;
+      size_t      m_frameTimeHistoryHead;
+      size_t      m_frameTimeHistoryNum;
+
+      /** Welford's online estimation of OS sleep overshoot */
+      double      m_sleepOvershootMean;
+      double      m_sleepOvershootM2;
+      long long   m_sleepOvershootSamples;
+
    };
 }
\ No newline at end of file
@@ -8,6 +8,7 @@ namespace Elaina
    {
       using SetupCallbackType = std::function<void(RenderPassBuilder&, DataType&)>;
       using ExecuteCallbackType = std::function<void(const DataType&)>;
+      using SubmitCallbackType = std::function<void(const DataType&)>;
 
    public:
       explicit CallbackRenderPass(const StringType& name,
@@ -20,10 +21,24 @@ namespace Elaina
       {
       }
 
+      /** Parallel recordable render pass; executeCallback records commands on worker thread and submitCallback submits them. */
+      explicit CallbackRenderPass(const StringType& name,
+         const SetupCallbackType& setupCallback, const ExecuteCallbackType& executeCallback, const SubmitCallbackType& submitCallback,
+         size_t distributionGruop = 0) :
+         Data(DataType()),
+         SetupCallback(setupCallback),
+         ExecuteCallback(executeCallback),
+         SubmitCallback(submitCallback),
+         RenderPass(name, distributionGruop)
+      {
+      }
+
       virtual ~CallbackRenderPass() = default;
 
       const DataType& GetData() const { return Data; }
 
+      virtual bool IsParallelRecordable() const override { return static_cast<bool>(SubmitCallback); }
+
    protected:
       virtual void Setup(RenderPassBuilder& builder) override
       {
@@ -35,10 +50,19 @@ namespace Elaina
          ExecuteCallback(Data);
       }
 
+      virtual void Submit() override
+      {
+         if (SubmitCallback)
+         {
+            SubmitCallback(Data);
+         }
+      }
+
    protected:
       DataType Data;
       const SetupCallbackType SetupCallback;
       const ExecuteCallbackType ExecuteCallback;
+      const SubmitCallbackType SubmitCallback;
 
       friend FrameGraph;
 
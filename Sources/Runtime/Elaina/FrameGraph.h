@@ -1,6 +1,7 @@
 #pragma once
 #include <algorithm>
 #include <stack>
+#include <unordered_map>
 #include <fstream>
 #include <Elaina/FrameResource.h>
 #include <Elaina/RenderPass.h>
@@ -19,6 +20,11 @@ namespace Elaina
       Elaina::RenderPass* RenderPass = nullptr;
       std::vector<FrameResourceBase*> ToRealize;
       std::vector<FrameResourceBase*> ToDerealize;
+
+      /** Indices of phases which must be executed before this phase. (Always less than own index) */
+      std::vector<size_t> Dependencies;
+      /** Depth in dependency graph; Phases of same level are independent to each other. */
+      size_t Level = 0;
    };
 
    /**
@@ -92,7 +98,7 @@ namespace Elaina
          return newResource;
       }
 
-      /** Compile */
+      /** Compile; Results are cached and only recompiled when render passes or resources have been changed. */
       void Compile()
       {
          /** Sort render passes by Distribution Group */
@@ -102,6 +108,12 @@ namespace Elaina
                return lhs->GetDistributionGroup() < rhs->GetDistributionGroup();
             });
 
+         size_t structuralHash = ComputeStructuralHash();
+         if (bCompiled && structuralHash == CompiledHash)
+         {
+            return;
+         }
+
          /** Calculate Reference Count */
          for (auto renderPass : RenderPasses)
          {
@@ -161,7 +173,7 @@ namespace Elaina
                if (writer->IsNeedToCull())
                {
                   /** Cull ó  render pass ϴ ҽ ۷ īƮ ҽش */
-                  for (auto readResource : creator->Reads)
+                  for (auto readResource : writer->Reads)
                   {
                      if (readResource->RefCount > 0) /** Do not include external permanent */
                      {
@@ -177,10 +189,37 @@ namespace Elaina
             }
          }
 
+         /** Last use of each resource in one linear sweep over survived render passes. */
+         for (auto resource : Resources)
+         {
+            resource->LastUserIndex = INVALID_RENDER_PASS_INDEX;
+         }
+
+         for (size_t renderPassIdx = 0; renderPassIdx < RenderPasses.size(); ++renderPassIdx)
+         {
+            auto renderPass = RenderPasses[renderPassIdx];
+            if (!renderPass->IsNeedToCull())
+            {
+               for (auto resource : renderPass->Creates)
+               {
+                  resource->LastUserIndex = renderPassIdx;
+               }
+               for (auto resource : renderPass->Reads)
+               {
+                  resource->LastUserIndex = renderPassIdx;
+               }
+               for (auto resource : renderPass->Writes)
+               {
+                  resource->LastUserIndex = renderPassIdx;
+               }
+            }
+         }
+
          /** Construct render phases (Find Realized/Derealized resources each render pass) */
          Phases.clear();
-         for (auto targetRenderPass : RenderPasses)
+         for (size_t renderPassIdx = 0; renderPassIdx < RenderPasses.size(); ++renderPassIdx)
          {
+            auto targetRenderPass = RenderPasses[renderPassIdx];
             if (!targetRenderPass->IsNeedToCull())
             {
                RenderPhase newPhase;
@@ -190,70 +229,35 @@ namespace Elaina
                for (auto resource : targetRenderPass->Creates)
                {
                   newPhase.ToRealize.push_back(resource);
-                  if (resource->Readers.empty() && resource->Writers.empty())
-                  {
-                     /** Immediately derealize own resource after render pass excuted if there a no more any referencing by other render pass. */
-                     newPhase.ToDerealize.push_back(resource);
-                  }
                }
 
-               /** For resources which read and write by current render pass. */
-               auto readsAndWrites{ targetRenderPass->Reads };
-               readsAndWrites.insert(
-                  readsAndWrites.end(),
-                  targetRenderPass->Writes.begin(), targetRenderPass->Writes.end());
-
-               /** Greedy selection */
-               for (auto resource : readsAndWrites)
+               /** Derealize transient resources right after its last user. */
+               auto derealizeIfLastUser = [&newPhase, renderPassIdx](FrameResourceBase* resource)
                {
-                  if (resource->IsTransient())
+                  if (resource->IsTransient() && resource->LastUserIndex == renderPassIdx &&
+                     std::find(newPhase.ToDerealize.begin(), newPhase.ToDerealize.end(), resource) == newPhase.ToDerealize.end())
                   {
-                     bool bFoundLastReader = false;
-                     size_t lastIndex = 0;
-                     if (!resource->Readers.empty())
-                     {
-                        for (auto renderPassItr = RenderPasses.begin(); renderPassItr != RenderPasses.end(); ++renderPassItr)
-                        {
-                           if ((*renderPassItr) == resource->Readers.back())
-                           {
-                              bFoundLastReader = true;
-                              lastIndex = std::distance(RenderPasses.begin(), renderPassItr);
-                           }
-                        }
-                     }
-
-                     bool bFoundLastWriters = false;
-                     if (!resource->Writers.empty())
-                     {
-                        for (auto renderPassItr = RenderPasses.begin(); renderPassItr != RenderPasses.end(); ++renderPassItr)
-                        {
-                           if ((*renderPassItr) == resource->Writers.back())
-                           {
-                              bFoundLastWriters = true;
-                              lastIndex = std::max(
-                                 lastIndex,
-                                 (size_t)std::distance(RenderPasses.begin(), renderPassItr));
-                           }
-                        }
-                     }
-
-                     /** @TODO MORE OPTIMIZE(ѹ   deserialize  ѹ ص */
-                     bool bNeedToDerealizeOnCurrent = targetRenderPass == RenderPasses[lastIndex];
-                     if ((bFoundLastWriters || bFoundLastReader) && bNeedToDerealizeOnCurrent)
-                     {
-                        newPhase.ToDerealize.push_back(resource);
-                     }
+                     newPhase.ToDerealize.push_back(resource);
                   }
-               }
+               };
+
+               std::for_each(targetRenderPass->Creates.begin(), targetRenderPass->Creates.end(), derealizeIfLastUser);
+               std::for_each(targetRenderPass->Reads.begin(), targetRenderPass->Reads.end(), derealizeIfLastUser);
+               std::for_each(targetRenderPass->Writes.begin(), targetRenderPass->Writes.end(), derealizeIfLastUser);
 
                Phases.push_back(std::move(newPhase));
             }
          }
+
+         BuildDependencies();
+         CompiledHash = structuralHash;
+         bCompiled = true;
       }
 
       /** Execute */
       void Execute()
       {
+         TransientPool.NextFrame();
          for (auto& phase : Phases)
          {
             /* Realize resource */
@@ -266,6 +270,7 @@ namespace Elaina
             }
 
             phase.RenderPass->Execute();
+            phase.RenderPass->Submit();
 
             /* Derealize Resource*/
             {
@@ -278,6 +283,74 @@ namespace Elaina
          }
       }
 
+      /**
+      * @brief Execute independent render passes concurrently.
+      *        Phases of each dependency level are executed at once; parallel recordable render passes record on thread pool
+      *        and then every render pass of the level is submitted in topological order on calling thread.
+      *        Render passes which are not parallel recordable are executed on calling thread in their submission order.
+      *        Every resource dependencies between render passes must be declared through RenderPassBuilder.
+      *        (Render passes of RendererPBR record on immediate context and none of them opts into parallel recording yet,
+      *        so renderer keeps using Execute.)
+      * @param threadPool Any thread pool which provides ParallelFor(first, last, func(chunkBegin, chunkEnd), grainSize).
+      */
+      template <typename ThreadPoolType>
+      void ExecuteParallel(ThreadPoolType& threadPool)
+      {
+         TransientPool.NextFrame();
+         for (size_t levelIdx = 0; levelIdx < PhaseLevels.size(); ++levelIdx)
+         {
+            const auto& level = PhaseLevels[levelIdx];
+            /* Realize resource; Resource pool is not thread-safe. */
+            {
+               OPTICK_EVENT("RealizeResources");
+               for (size_t phaseIdx : level)
+               {
+                  for (auto resource : Phases[phaseIdx].ToRealize)
+                  {
+                     resource->Realize();
+                  }
+               }
+            }
+
+            /* Record */
+            threadPool.ParallelFor(0, level.size(),
+               [this, &level](size_t begin, size_t end)
+               {
+                  for (size_t idx = begin; idx < end; ++idx)
+                  {
+                     RenderPass* renderPass = Phases[level[idx]].RenderPass;
+                     if (renderPass->IsParallelRecordable())
+                     {
+                        renderPass->Execute();
+                     }
+                  }
+               }, 1);
+
+            /* Submit */
+            for (size_t phaseIdx : level)
+            {
+               RenderPass* renderPass = Phases[phaseIdx].RenderPass;
+               if (renderPass->IsParallelRecordable())
+               {
+                  renderPass->Submit();
+               }
+               else
+               {
+                  renderPass->Execute();
+               }
+            }
+
+            /* Derealize Resource*/
+            {
+               OPTICK_EVENT("DeRealizeResources");
+               for (auto resource : LevelDerealizes[levelIdx])
+               {
+                  resource->Derealize();
+               }
+            }
+         }
+      }
+
       /** If a distribution group executed, then it makes able to execute only with equal or exceed distribution group! */
       void ExecuteDistributionGroup(const size_t distributionGroup)
       {
@@ -295,6 +368,7 @@ namespace Elaina
                   }
 
                   phase.RenderPass->Execute();
+                  phase.RenderPass->Submit();
 
                   /* Derealize Resource*/
                   for (auto resource : phase.ToDerealize)
@@ -328,11 +402,24 @@ namespace Elaina
          RenderPasses.clear();
          Resources.clear();
          Phases.clear();
+         PhaseLevels.clear();
+         LevelDerealizes.clear();
+         bCompiled = false;
 
          LatestExecutedDistributionGruop = 0;
          LatestExcutedIndex = 0;
       }
 
+      ResourcePool& GetResourcePool() { return TransientPool; }
+      const ResourcePoolStats& GetResourcePoolStats() const { return TransientPool.GetStats(); }
+
+      const std::vector<RenderPhase>& GetPhases() const { return Phases; }
+      bool IsCompiled() const { return bCompiled; }
+      /** Force recompile on next Compile. (ex. Render pass changed it's cull immunity) */
+      void Invalidate() { bCompiled = false; }
+      /** Indices of phases grouped by dependency level */
+      const std::vector<std::vector<size_t>>& GetPhaseLevels() const { return PhaseLevels; }
+
 
       void ExportVisualization(const StringType& FilePath, const VisualizeParams& params = VisualizeParams())
       {
@@ -421,10 +508,149 @@ namespace Elaina
          stream << "}"; // End of diagraph FrameGraph
       }
 
+   private:
+      /** Hash of graph structure; Render passes in execution order, their references and resources. */
+      size_t ComputeStructuralHash() const
+      {
+         auto hashResources = [](size_t seed, const std::vector<FrameResourceBase*>& resources)
+         {
+            seed = HashCombine(seed, resources.size());
+            for (auto resource : resources)
+            {
+               seed = HashCombine(seed, std::hash<const void*>()(resource));
+            }
+            return seed;
+         };
+
+         size_t seed = HashCombine(RenderPasses.size(), Resources.size());
+         for (auto renderPass : RenderPasses)
+         {
+            seed = HashCombine(seed, std::hash<const void*>()(renderPass));
+            seed = HashCombine(seed, renderPass->GetDistributionGroup());
+            seed = HashCombine(seed, renderPass->IsCullImmune() ? 1 : 0);
+            seed = hashResources(seed, renderPass->Creates);
+            seed = hashResources(seed, renderPass->Reads);
+            seed = hashResources(seed, renderPass->Writes);
+         }
+
+         return hashResources(seed, Resources);
+      }
+
+      /**
+      * @brief Derive dependency DAG from resource references of compiled phases.
+      *        Read after write, write after write and write after read to same resource make an edge from earlier phase.
+      */
+      void BuildDependencies()
+      {
+         std::unordered_map<FrameResourceBase*, size_t> lastWriters;
+         std::unordered_map<FrameResourceBase*, std::vector<size_t>> readersSinceWrite;
+
+         PhaseLevels.clear();
+         for (size_t phaseIdx = 0; phaseIdx < Phases.size(); ++phaseIdx)
+         {
+            auto& phase = Phases[phaseIdx];
+            RenderPass* renderPass = phase.RenderPass;
+            phase.Dependencies.clear();
+
+            for (auto resource : renderPass->Reads)
+            {
+               auto foundItr = lastWriters.find(resource);
+               if (foundItr != lastWriters.end())
+               {
+                  phase.Dependencies.push_back(foundItr->second);
+               }
+            }
+
+            auto creates{ renderPass->Creates };
+            creates.insert(creates.end(), renderPass->Writes.begin(), renderPass->Writes.end());
+            for (auto resource : creates)
+            {
+               auto foundItr = lastWriters.find(resource);
+               if (foundItr != lastWriters.end())
+               {
+                  phase.Dependencies.push_back(foundItr->second);
+               }
+
+               auto& readers = readersSinceWrite[resource];
+               phase.Dependencies.insert(phase.Dependencies.end(), readers.begin(), readers.end());
+            }
+
+            for (auto resource : creates)
+            {
+               lastWriters[resource] = phaseIdx;
+               readersSinceWrite[resource].clear();
+            }
+
+            for (auto resource : renderPass->Reads)
+            {
+               auto foundItr = lastWriters.find(resource);
+               if (foundItr == lastWriters.end() || foundItr->second != phaseIdx)
+               {
+                  readersSinceWrite[resource].push_back(phaseIdx);
+               }
+            }
+
+            std::sort(phase.Dependencies.begin(), phase.Dependencies.end());
+            phase.Dependencies.erase(
+               std::unique(phase.Dependencies.begin(), phase.Dependencies.end()),
+               phase.Dependencies.end());
+            phase.Dependencies.erase(
+               std::remove(phase.Dependencies.begin(), phase.Dependencies.end(), phaseIdx),
+               phase.Dependencies.end());
+
+            phase.Level = 0;
+            for (size_t dependency : phase.Dependencies)
+            {
+               phase.Level = std::max(phase.Level, Phases[dependency].Level + 1);
+            }
+
+            if (PhaseLevels.size() <= phase.Level)
+            {
+               PhaseLevels.resize(phase.Level + 1);
+            }
+            PhaseLevels[phase.Level].push_back(phaseIdx);
+         }
+
+         /** Last user in serial order is not always executed at last level; Derealize resources after every user's level. */
+         std::unordered_map<const RenderPass*, size_t> renderPassLevels;
+         for (const auto& phase : Phases)
+         {
+            renderPassLevels[phase.RenderPass] = phase.Level;
+         }
+
+         LevelDerealizes.clear();
+         LevelDerealizes.resize(PhaseLevels.size());
+         for (const auto& phase : Phases)
+         {
+            for (auto resource : phase.ToDerealize)
+            {
+               size_t lastLevel = phase.Level;
+               auto updateLastLevel = [&renderPassLevels, &lastLevel](const RenderPass* user)
+               {
+                  auto foundItr = renderPassLevels.find(user);
+                  if (foundItr != renderPassLevels.end())
+                  {
+                     lastLevel = std::max(lastLevel, foundItr->second);
+                  }
+               };
+
+               std::for_each(resource->Readers.begin(), resource->Readers.end(), updateLastLevel);
+               std::for_each(resource->Writers.begin(), resource->Writers.end(), updateLastLevel);
+               LevelDerealizes[lastLevel].push_back(resource);
+            }
+         }
+      }
+
    private:
       std::vector<RenderPass*> RenderPasses;
       std::vector<FrameResourceBase*> Resources;
       std::vector<RenderPhase> Phases;
+      std::vector<std::vector<size_t>> PhaseLevels;
+      std::vector<std::vector<FrameResourceBase*>> LevelDerealizes;
+      ResourcePool TransientPool;
+
+      size_t CompiledHash = 0;
+      bool bCompiled = false;
 
       size_t LatestExecutedDistributionGruop = 0;
       size_t LatestExcutedIndex = 0;
@@ -437,6 +663,7 @@ namespace Elaina
    ResourceType* RenderPassBuilder::Create(const StringType& name, const DescriptorType& descriptor)
    {
       ResourceType* newResource = new ResourceType(name, TargetRenderPass, descriptor);
+      newResource->Pool = &TargetFrameGraph->TransientPool;
       TargetFrameGraph->Resources.push_back(newResource);
       TargetRenderPass->Creates.push_back(newResource);
       return newResource;
@@ -2,11 +2,14 @@
 #include <vector>
 #include <Elaina/Elaina.config.h>
 #include <Elaina/Realize.h>
+#include <Elaina/ResourcePool.h>
 
 namespace Elaina
 {
    class RenderPass;
    class FrameGraph;
+
+   constexpr size_t INVALID_RENDER_PASS_INDEX = static_cast<size_t>(-1);
    class RenderPassBuilder;
 
    /** Resource Handler */
@@ -31,7 +34,9 @@ namespace Elaina
       explicit FrameResourceBase(const StringType& name, RenderPass* creator) :
          Name(name),
          Creator(creator),
-         RefCount(0)
+         RefCount(0),
+         Pool(nullptr),
+         LastUserIndex(INVALID_RENDER_PASS_INDEX)
       {
          static size_t IdentifierCounter = 0;
          Identifier = IdentifierCounter;
@@ -60,6 +65,10 @@ namespace Elaina
       std::vector<RenderPass*> Readers;
       std::vector<RenderPass*> Writers;
       size_t RefCount;
+      /** Pool of transient actuals. (nullptr if realize without pooling) */
+      ResourcePool* Pool;
+      /** Index of last render pass which references this resource. (Updated on compile) */
+      size_t LastUserIndex;
 
       friend FrameGraph;
       friend RenderPassBuilder;
@@ -102,6 +111,15 @@ namespace Elaina
       {
          if (IsTransient() && !IsRealized())
          {
+            if constexpr (PoolingTraits<DescriptorType, ActualType>::bPoolable)
+            {
+               if (Pool != nullptr)
+               {
+                  Actual = Pool->Acquire<DescriptorType, ActualType>(Descriptor);
+                  return;
+               }
+            }
+
             Actual = Elaina::Realize<DescriptorType, ActualType>(Descriptor);
          }
       }
@@ -110,6 +128,15 @@ namespace Elaina
       {
          if (IsTransient() && IsRealized())
          {
+            if constexpr (PoolingTraits<DescriptorType, ActualType>::bPoolable)
+            {
+               if (Pool != nullptr)
+               {
+                  Pool->Release<DescriptorType, ActualType>(Descriptor, Actual);
+                  return;
+               }
+            }
+
             Elaina::SafeDelete(Actual);
          }
       }
@@ -36,6 +36,12 @@ namespace Elaina
 
       size_t GetDistributionGroup() const { return DistributionGroup; }
 
+      /**
+      * @brief Is able to record on worker thread with its own command context?
+      *        Recorded commands are submitted through Submit on the thread which executing frame graph.
+      */
+      virtual bool IsParallelRecordable() const { return false; }
+
    protected:
       /**
       * @brief Create resource handles 
@@ -47,6 +53,11 @@ namespace Elaina
       */
       virtual void Execute() = 0;
 
+      /**
+      * @brief Submit commands which recorded by Execute (Only for parallel recordable render pass)
+      */
+      virtual void Submit() { }
+
    private:
       /** 
       * @brief Calculate Reference count
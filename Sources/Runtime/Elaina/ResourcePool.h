@@ -0,0 +1,276 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <Elaina/Elaina.config.h>
+#include <Elaina/Realize.h>
+
+namespace Elaina
+{
+   /**
+   * @brief Customization point of transient resource pooling.
+   *        Specialize it for descriptor/actual pair which is expensive to realize and safe to reuse between render passes.
+   *        Transient resources without specialization are realized/derealized as before.
+   */
+   template <typename DescriptorType, typename ActualType>
+   struct PoolingTraits
+   {
+      static constexpr bool bPoolable = false;
+
+      /** Actual of descriptor which is not poolable is realized on acquire and deleted right on release, without counting as miss. */
+      static bool IsPoolable(const DescriptorType& descriptor) { return true; }
+
+      /** Descriptors which are able to share an actual must have same hash. */
+      static size_t Hash(const DescriptorType& descriptor) { return 0; }
+
+      /** Is 'pooledActual'(realized from 'pooledDescriptor') reusable for 'descriptor'? */
+      static bool IsReusable(const DescriptorType& pooledDescriptor, const ActualType& pooledActual, const DescriptorType& descriptor) { return false; }
+
+      /** Reset states of reused actual which previous user may changed. */
+      static void Recycle(const DescriptorType& descriptor, ActualType& actual) { }
+
+      /** Approximate size of actual in bytes. */
+      static size_t SizeOf(const DescriptorType& descriptor, const ActualType& actual) { return sizeof(ActualType); }
+   };
+
+   inline size_t HashCombine(size_t seed, size_t value)
+   {
+      return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+   }
+
+   struct ResourcePoolStats
+   {
+      /** Counters of latest frame */
+      size_t Hits = 0;
+      size_t Misses = 0;
+
+      size_t TotalHits = 0;
+      size_t TotalMisses = 0;
+
+      /** Actuals that pool owns (In use + Idle) */
+      size_t LiveResources = 0;
+      size_t LiveBytes = 0;
+      size_t IdleResources = 0;
+   };
+
+   /**
+   * @brief Descriptor keyed pool of realized actuals.
+   *        FrameGraph derealizes transient resources right after its last user, so resources with non-overlapping lifetimes
+   *        end up sharing an actual within a frame and steady state frames does not realize any new actual.
+   */
+   class ResourcePool
+   {
+      class PooledResourceBase
+      {
+      public:
+         virtual ~PooledResourceBase() = default;
+
+         size_t Bytes = 0;
+         size_t LastUsedFrame = 0;
+      };
+
+      template <typename DescriptorType, typename ActualType>
+      class PooledResource : public PooledResourceBase
+      {
+      public:
+         PooledResource(const DescriptorType& descriptor, ActualType* actual) :
+            Descriptor(descriptor),
+            Actual(actual)
+         {
+         }
+
+         virtual ~PooledResource()
+         {
+            Elaina::SafeDelete(Actual);
+         }
+
+         DescriptorType Descriptor;
+         ActualType* Actual;
+      };
+
+      struct PoolKey
+      {
+         const void* Type = nullptr;
+         size_t Hash = 0;
+
+         bool operator==(const PoolKey& rhs) const
+         {
+            return (Type == rhs.Type) && (Hash == rhs.Hash);
+         }
+      };
+
+      struct PoolKeyHasher
+      {
+         size_t operator()(const PoolKey& key) const
+         {
+            return HashCombine(reinterpret_cast<size_t>(key.Type), key.Hash);
+         }
+      };
+
+      template <typename DescriptorType, typename ActualType>
+      static const void* TypeKey()
+      {
+         static const char key = 0;
+         return &key;
+      }
+
+   public:
+      ResourcePool() = default;
+      ~ResourcePool()
+      {
+         Clear();
+      }
+
+      ResourcePool(const ResourcePool&) = delete;
+      ResourcePool& operator=(const ResourcePool&) = delete;
+
+      template <typename DescriptorType, typename ActualType>
+      ActualType* Acquire(const DescriptorType& descriptor)
+      {
+         using Traits = PoolingTraits<DescriptorType, ActualType>;
+         using PooledType = PooledResource<DescriptorType, ActualType>;
+
+         if (!Traits::IsPoolable(descriptor))
+         {
+            return Elaina::Realize<DescriptorType, ActualType>(descriptor);
+         }
+
+         PoolKey key{ TypeKey<DescriptorType, ActualType>(), Traits::Hash(descriptor) };
+         auto foundItr = IdleResources.find(key);
+         if (foundItr != IdleResources.end())
+         {
+            auto& bucket = foundItr->second;
+            for (auto itr = bucket.begin(); itr != bucket.end(); ++itr)
+            {
+               PooledType* pooled = static_cast<PooledType*>(*itr);
+               if (Traits::IsReusable(pooled->Descriptor, *pooled->Actual, descriptor))
+               {
+                  bucket.erase(itr);
+                  --Stats.IdleResources;
+
+                  pooled->Descriptor = descriptor;
+                  pooled->LastUsedFrame = CurrentFrame;
+                  Traits::Recycle(descriptor, *pooled->Actual);
+                  InUseResources[pooled->Actual] = pooled;
+
+                  ++Stats.Hits;
+                  ++Stats.TotalHits;
+                  return pooled->Actual;
+               }
+            }
+         }
+
+         ++Stats.Misses;
+         ++Stats.TotalMisses;
+
+         ActualType* actual = Elaina::Realize<DescriptorType, ActualType>(descriptor);
+         if (actual != nullptr)
+         {
+            PooledType* pooled = new PooledType(descriptor, actual);
+            pooled->Bytes = Traits::SizeOf(descriptor, *actual);
+            pooled->LastUsedFrame = CurrentFrame;
+            InUseResources[actual] = pooled;
+
+            ++Stats.LiveResources;
+            Stats.LiveBytes += pooled->Bytes;
+         }
+
+         return actual;
+      }
+
+      /** Give back actual to pool. Actual which is not poolable or does not acquired from this pool will be deleted immediately. */
+      template <typename DescriptorType, typename ActualType>
+      void Release(const DescriptorType& descriptor, ActualType*& actual)
+      {
+         using Traits = PoolingTraits<DescriptorType, ActualType>;
+
+         auto foundItr = Traits::IsPoolable(descriptor) ? InUseResources.find(actual) : InUseResources.end();
+         if (foundItr != InUseResources.end())
+         {
+            PooledResourceBase* pooled = foundItr->second;
+            InUseResources.erase(foundItr);
+
+            pooled->LastUsedFrame = CurrentFrame;
+            PoolKey key{ TypeKey<DescriptorType, ActualType>(), Traits::Hash(descriptor) };
+            IdleResources[key].push_back(pooled);
+            ++Stats.IdleResources;
+            actual = nullptr;
+         }
+         else
+         {
+            Elaina::SafeDelete(actual);
+         }
+      }
+
+      /** Evict idle actuals which are not used more than MaxIdleFrames. */
+      void NextFrame()
+      {
+         ++CurrentFrame;
+         Stats.Hits = 0;
+         Stats.Misses = 0;
+
+         for (auto bucketItr = IdleResources.begin(); bucketItr != IdleResources.end();)
+         {
+            auto& bucket = bucketItr->second;
+            for (auto itr = bucket.begin(); itr != bucket.end();)
+            {
+               PooledResourceBase* pooled = (*itr);
+               if ((CurrentFrame - pooled->LastUsedFrame) > MaxIdleFrames)
+               {
+                  Evict(pooled);
+                  itr = bucket.erase(itr);
+               }
+               else
+               {
+                  ++itr;
+               }
+            }
+
+            if (bucket.empty())
+            {
+               bucketItr = IdleResources.erase(bucketItr);
+            }
+            else
+            {
+               ++bucketItr;
+            }
+         }
+      }
+
+      /** Delete every idle actuals. Actuals in use come back to pool on release. */
+      void Clear()
+      {
+         for (auto& bucket : IdleResources)
+         {
+            for (auto pooled : bucket.second)
+            {
+               Evict(pooled);
+            }
+         }
+
+         IdleResources.clear();
+      }
+
+      void SetMaxIdleFrames(size_t frames) { MaxIdleFrames = frames; }
+      size_t GetMaxIdleFrames() const { return MaxIdleFrames; }
+
+      const ResourcePoolStats& GetStats() const { return Stats; }
+
+   private:
+      void Evict(PooledResourceBase* pooled)
+      {
+         --Stats.IdleResources;
+         --Stats.LiveResources;
+         Stats.LiveBytes -= pooled->Bytes;
+         Elaina::SafeDelete(pooled);
+      }
+
+   private:
+      std::unordered_map<PoolKey, std::vector<PooledResourceBase*>, PoolKeyHasher> IdleResources;
+      std::unordered_map<const void*, PooledResourceBase*> InUseResources;
+
+      size_t CurrentFrame = 0;
+      size_t MaxIdleFrames = 3;
+      ResourcePoolStats Stats;
+
+   };
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "GameFramework/ComponentRegistry.h"
+#include "GameFramework/Entity.h"
+#include "Component/Component.h"
+
+namespace Mile
+{
+   void ComponentRegistry::Register(Component* component)
+   {
+      if (component != nullptr && !component->m_bIsRegistered)
+      {
+         ComponentArray& components = m_components[std::type_index(typeid(*component))];
+         UINT64 entityOrder = GetEntityOrder(component);
+         /** Components are usually added to latest entity. */
+         if (components.EntityOrders.empty() || components.EntityOrders.back() <= entityOrder)
+         {
+            components.Components.push_back(component);
+            components.EntityOrders.push_back(entityOrder);
+         }
+         else
+         {
+            auto orderItr = std::upper_bound(components.EntityOrders.begin(), components.EntityOrders.end(), entityOrder);
+            size_t idx = std::distance(components.EntityOrders.begin(), orderItr);
+            components.Components.insert(components.Components.begin() + idx, component);
+            components.EntityOrders.insert(orderItr, entityOrder);
+         }
+
+         component->m_bIsRegistered = true;
+      }
+   }
+
+   void ComponentRegistry::Unregister(Component* component)
+   {
+      if (component != nullptr && component->m_bIsRegistered)
+      {
+         auto foundItr = m_components.find(std::type_index(typeid(*component)));
+         if (foundItr != m_components.end())
+         {
+            ComponentArray& components = foundItr->second;
+            UINT64 entityOrder = GetEntityOrder(component);
+            auto orderItr = std::lower_bound(components.EntityOrders.begin(), components.EntityOrders.end(), entityOrder);
+            for (size_t idx = std::distance(components.EntityOrders.begin(), orderItr);
+               idx < components.EntityOrders.size() && components.EntityOrders[idx] == entityOrder; ++idx)
+            {
+               if (components.Components[idx] == component)
+               {
+                  components.Components[idx] = nullptr;
+                  ++components.RemovedNum;
+                  ++m_removedNum;
+                  break;
+               }
+            }
+         }
+
+         component->m_bIsRegistered = false;
+      }
+   }
+
+   void ComponentRegistry::Compact()
+   {
+      if (m_removedNum == 0)
+      {
+         return;
+      }
+
+      for (auto& pair : m_components)
+      {
+         ComponentArray& components = pair.second;
+         if (components.RemovedNum > 0)
+         {
+            size_t aliveNum = 0;
+            for (size_t idx = 0; idx < components.Components.size(); ++idx)
+            {
+               if (components.Components[idx] != nullptr)
+               {
+                  components.Components[aliveNum] = components.Components[idx];
+                  components.EntityOrders[aliveNum] = components.EntityOrders[idx];
+                  ++aliveNum;
+               }
+            }
+
+            components.Components.resize(aliveNum);
+            components.EntityOrders.resize(aliveNum);
+            components.RemovedNum = 0;
+         }
+      }
+
+      m_removedNum = 0;
+   }
+
+   void ComponentRegistry::Clear()
+   {
+      for (auto& pair : m_components)
+      {
+         for (Component* component : pair.second.Components)
+         {
+            if (component != nullptr)
+            {
+               component->m_bIsRegistered = false;
+            }
+         }
+      }
+
+      m_components.clear();
+      m_removedNum = 0;
+   }
+
+   const ComponentRegistry::ComponentArray* ComponentRegistry::Find(std::type_index type) const
+   {
+      auto foundItr = m_components.find(type);
+      if (foundItr != m_components.end())
+      {
+         return &foundItr->second;
+      }
+
+      return nullptr;
+   }
+
+   UINT64 ComponentRegistry::GetEntityOrder(const Component* component)
+   {
+      return component->GetEntity()->m_worldOrder;
+   }
+}
\ No newline at end of file
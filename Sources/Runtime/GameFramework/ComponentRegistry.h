@@ -0,0 +1,117 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+#include <typeindex>
+
+namespace Mile
+{
+   class Component;
+
+   /**
+   * @brief    Contiguous view over components of exact type 'Ty', in order of their entities in world.
+   *           Slots of components which have been removed since latest compaction are skipped.
+   */
+   template <typename Ty>
+   class ComponentSpan
+   {
+   public:
+      class Iterator
+      {
+      public:
+         Iterator(Component* const* ptr, Component* const* end) :
+            m_ptr(ptr),
+            m_end(end)
+         {
+            SkipRemoved();
+         }
+
+         Ty* operator*() const { return static_cast<Ty*>(*m_ptr); }
+         Iterator& operator++() { ++m_ptr; SkipRemoved(); return (*this); }
+         bool operator==(const Iterator& rhs) const { return m_ptr == rhs.m_ptr; }
+         bool operator!=(const Iterator& rhs) const { return m_ptr != rhs.m_ptr; }
+
+      private:
+         void SkipRemoved()
+         {
+            while (m_ptr != m_end && (*m_ptr) == nullptr)
+            {
+               ++m_ptr;
+            }
+         }
+
+      private:
+         Component* const* m_ptr;
+         Component* const* m_end;
+
+      };
+
+   public:
+      ComponentSpan(Component* const* data = nullptr, size_t size = 0) :
+         m_data(data),
+         m_size(size)
+      {
+      }
+
+      Iterator begin() const { return Iterator(m_data, m_data + m_size); }
+      Iterator end() const { return Iterator(m_data + m_size, m_data + m_size); }
+
+      /** Number of slots; Upper bound of number of components. */
+      size_t size() const { return m_size; }
+      bool empty() const { return begin() == end(); }
+
+   private:
+      Component* const* m_data;
+      size_t m_size;
+
+   };
+
+   /**
+   * @brief    Per-type arrays of components which are owned by entities of a world.
+   *           Components are keyed by their exact(dynamic) type, same as Entity::GetComponent.
+   *           Each array is kept in order of entities in world, and components of an entity in order they have been added,
+   *           so queries need neither sort nor per entity lookup.
+   *           Adding component to latest entity is an append; Removal only clears its slot, which is compacted at once later.
+   */
+   class MEAPI ComponentRegistry
+   {
+   public:
+      ComponentRegistry() = default;
+      ComponentRegistry(const ComponentRegistry&) = delete;
+      ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+
+      void Register(Component* component);
+      void Unregister(Component* component);
+      /** Remove cleared slots, keeping order. Spans of compacted types are invalidated. */
+      void Compact();
+      void Clear();
+
+      template <typename Ty>
+      ComponentSpan<Ty> GetComponents() const
+      {
+         const ComponentArray* components = Find(std::type_index(typeid(Ty)));
+         if (components != nullptr)
+         {
+            return ComponentSpan<Ty>(components->Components.data(), components->Components.size());
+         }
+
+         return ComponentSpan<Ty>();
+      }
+
+   private:
+      struct ComponentArray
+      {
+         /** nullptr if component has been removed since latest compaction. */
+         std::vector<Component*> Components;
+         /** Order of owner entity in world, per slot. Sorted, so slot of component is found by binary search. */
+         std::vector<UINT64> EntityOrders;
+         size_t RemovedNum = 0;
+      };
+
+      const ComponentArray* Find(std::type_index type) const;
+      static UINT64 GetEntityOrder(const Component* component);
+
+   private:
+      std::unordered_map<std::type_index, ComponentArray> m_components;
+      size_t m_removedNum = 0;
+
+   };
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Component/Component.h"
 #include "Component/ComponentRegister.h"
 #include "GameFramework/Transform.h"
+#include "GameFramework/WorldArchive.h"
 
 namespace Mile
 {
@@ -14,15 +15,23 @@ namespace Mile
       m_world(world),
       m_context(nullptr),
       m_bIsActivated(true),
-      m_transform(new Transform(this)),
+      m_transform(nullptr),
       m_parent(nullptr),
       m_bIsVisibleOnHierarchy(true),
       m_bIsSerializable(true),
+      m_worldIndex(0),
+      m_worldOrder(0),
+      m_bIsPendingDestroy(false),
       m_bCanEverUpdate(true)
    {
       if (m_world != nullptr)
       {
          m_context = m_world->GetContext();
+         m_transform = m_world->GetAllocator().New<Transform>(this);
+      }
+      else
+      {
+         m_transform = new Transform(this);
       }
 
       SetName(name);
@@ -31,10 +40,20 @@ namespace Mile
 
    Entity::~Entity()
    {
-      SafeDelete(m_transform);
+      if (m_world != nullptr)
+      {
+         m_world->GetAllocator().Delete(m_transform);
+         m_transform = nullptr;
+      }
+      else
+      {
+         SafeDelete(m_transform);
+      }
+
       for (auto component : m_components)
       {
-         SafeDelete(component);
+         UnregisterComponent(component);
+         Component::Destroy(component);
       }
 
       for (auto* child : m_children)
@@ -78,14 +97,14 @@ namespace Mile
 
    void Entity::DeSerialize(const json& jsonData)
    {
-      m_nameUTF8 = GetValueSafelyFromJson(jsonData, "Name", std::string("Entity"));
+      std::string nameUTF8 = GetValueSafelyFromJson(jsonData, "Name", std::string("Entity"));
+      ApplyName(String2WString(nameUTF8), nameUTF8);
       m_tagUTF8 = GetValueSafelyFromJson(jsonData, "Tag", std::string("None"));
-      m_name = String2WString(m_nameUTF8);
       m_tag = String2WString(m_tagUTF8);
       m_bIsActivated = GetValueSafelyFromJson<bool>(jsonData, "IsActivated", true);
 
-      std::vector<json> components = jsonData["Components"];
-      for (auto component : components)
+      const json& components = jsonData["Components"];
+      for (const auto& component : components)
       {
          auto foundedType = component.find("Type");
          if (foundedType == component.end())
@@ -93,14 +112,11 @@ namespace Mile
             ME_LOG(MileEntity, Fatal, TEXT("Can't findout any type information from serialized data!"));
          }
 
-         std::string type = (*foundedType);
-         Component* compInst = ComponentRegister::GetInstance().Acquire(type, this);
-         compInst->DeSerialize(component);
-         m_components.push_back(compInst);
+         DeSerializeComponent(*foundedType, component);
       }
 
-      std::vector<json> children = jsonData["Children"];
-      for (auto child : children)
+      const json& children = jsonData["Children"];
+      for (const auto& child : children)
       {
          Entity* tempChild = m_world->CreateEntity(TEXT(""));
          tempChild->DeSerialize(child);
@@ -110,6 +126,52 @@ namespace Mile
       m_transform->DeSerialize(jsonData["Transform"]);
    }
 
+   void Entity::DeSerialize(const WorldArchiveView& archive, const WorldArchiveEntity& archivedEntity)
+   {
+      std::string nameUTF8{ archive.GetString(archivedEntity.Name) };
+      ApplyName(String2WString(nameUTF8), nameUTF8);
+      m_tagUTF8 = archive.GetString(archivedEntity.Tag);
+      m_tag = String2WString(m_tagUTF8);
+      m_bIsActivated = (archivedEntity.bIsActivated != 0);
+
+      for (UINT32 idx = 0; idx < archivedEntity.ComponentNum; ++idx)
+      {
+         const WorldArchiveComponent& component = archive.GetComponent(archivedEntity.FirstComponent + idx);
+         DeSerializeComponent(std::string(archive.GetString(component.Type)), archive.GetComponentData(component));
+      }
+
+      m_transform->SetPosition(Vector3(archivedEntity.Position[0], archivedEntity.Position[1], archivedEntity.Position[2]));
+      m_transform->SetScale(Vector3(archivedEntity.Scale[0], archivedEntity.Scale[1], archivedEntity.Scale[2]));
+      m_transform->SetRotation(Quaternion(archivedEntity.Rotation[0], archivedEntity.Rotation[1], archivedEntity.Rotation[2], archivedEntity.Rotation[3]));
+   }
+
+   void Entity::DeSerializeComponent(const std::string& type, const json& jsonData)
+   {
+      Component* compInst = ComponentRegister::GetInstance().Acquire(type, this);
+      if (compInst != nullptr)
+      {
+         compInst->DeSerialize(jsonData);
+         m_components.push_back(compInst);
+         RegisterComponent(compInst);
+      }
+   }
+
+   void Entity::SetName(const String& name)
+   {
+      ApplyName(name, WString2String(name));
+   }
+
+   void Entity::ApplyName(const String& name, const std::string& nameUTF8)
+   {
+      String oldName = std::move(m_name);
+      m_name = name;
+      m_nameUTF8 = nameUTF8;
+      if (m_world != nullptr)
+      {
+         m_world->OnEntityRenamed(this, oldName);
+      }
+   }
+
    bool Entity::Init()
    {
       return true;
@@ -165,6 +227,7 @@ namespace Mile
          {
             m_children.erase(std::find(m_children.begin(), m_children.end(), child));
             child->GetTransform()->SetParent(nullptr);
+            child->m_parent = nullptr;
             return true;
          }
       }
@@ -174,7 +237,9 @@ namespace Mile
 
    void Entity::SetTransform(const Transform& transform)
    {
-      (*m_transform) = transform;
+      m_transform->SetPosition(transform.GetPosition());
+      m_transform->SetScale(transform.GetScale());
+      m_transform->SetRotation(transform.GetRotation());
    }
 
    Entity* Entity::GetChildByName(const String& name)
@@ -240,6 +305,22 @@ namespace Mile
       }
    }
 
+   void Entity::RegisterComponent(Component* component)
+   {
+      if (m_world != nullptr)
+      {
+         m_world->GetComponentRegistry().Register(component);
+      }
+   }
+
+   void Entity::UnregisterComponent(Component* component)
+   {
+      if (m_world != nullptr)
+      {
+         m_world->GetComponentRegistry().Unregister(component);
+      }
+   }
+
    std::vector<Component*>& Entity::GetComponents()
    {
       return m_components;
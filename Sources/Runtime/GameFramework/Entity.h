@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Logger.h"
+#include "GameFramework/EntityHandle.h"
 
 #define DEFAULT_ENTITY_NAME TEXT("Entity")
 #define DEFAULT_ENTITY_TAG TEXT("Default")
@@ -12,10 +13,15 @@ namespace Mile
    class World;
    class Component;
    class Transform;
+   class WorldArchiveView;
+   struct WorldArchiveEntity;
    class MEAPI Entity
    {
       friend World;
       friend class ModelLoader;
+      friend class WorldArchiveWriter;
+      friend class Prefab;
+      friend class ComponentRegistry;
 
    private:
       Entity(World* world, const String& name = DEFAULT_ENTITY_NAME, const String& tag = DEFAULT_ENTITY_TAG);
@@ -26,6 +32,8 @@ namespace Mile
       json Serialize() const;
       // Null world entitiy must not deserialized.
       void DeSerialize(const json& jsonData);
+      /** Children are not deserialized; World loads archived entities in pre-order and attaches them to parent. */
+      void DeSerialize(const WorldArchiveView& archive, const WorldArchiveEntity& archivedEntity);
 
       /**
       * @brief    Entity ʱȭ մϴ. (   Entity Transform  ˴ϴ. )
@@ -100,7 +108,7 @@ namespace Mile
       * @brief    Entity ο ̸ ݴϴ.
       * @param    Entity  ο ̸
       */
-      void SetName(const String& name) { m_name = name; m_nameUTF8 = WString2String(m_name); }
+      void SetName(const String& name);
 
       const String& GetTag() const { return m_tag; }
       const std::string& GetTagUTF8() const { return m_tagUTF8; }
@@ -131,8 +139,18 @@ namespace Mile
       void OnDisable();
 
       World* GetWorld() const { return m_world; }
+
+      /** Handle of entity in its world. Null if entity does not belong to any world. */
+      EntityHandle GetHandle() const { return m_handle; }
+      bool IsPendingDestroy() const { return m_bIsPendingDestroy; }
       Context* GetContext() const { return m_context; }
 
+   private:
+      void ApplyName(const String& name, const std::string& nameUTF8);
+      void DeSerializeComponent(const std::string& type, const json& jsonData);
+      void RegisterComponent(Component* component);
+      void UnregisterComponent(Component* component);
+
    private:
       bool     m_bIsActivated;
       Context* m_context;
@@ -149,6 +167,13 @@ namespace Mile
       bool  m_bIsVisibleOnHierarchy;
       bool  m_bIsSerializable;
 
+      EntityHandle m_handle;
+      /** Position in entity storage of world */
+      size_t m_worldIndex;
+      /** Increases in order entities have been added to world. Unlike world index, it is not changed when storage has been compacted. */
+      UINT64 m_worldOrder;
+      bool  m_bIsPendingDestroy;
+
    protected:
       bool     m_bCanEverUpdate;
 
@@ -157,8 +182,9 @@ namespace Mile
    template <typename Ty>
    Ty* Entity::AddComponent()
    {
-      Component* component = new Ty(this);
+      Component* component = Ty::template Allocate<Ty>(this);
       m_components.push_back(component);
+      RegisterComponent(component);
 
       component->Reset();
       component->SetActive(true);
@@ -171,11 +197,12 @@ namespace Mile
    {
       if (target != nullptr)
       {
-         for (auto itr = m_components.begin(); itr != m_components.end(); ++itr)
+         auto foundItr = std::find(m_components.begin(), m_components.end(), target);
+         if (foundItr != m_components.end())
          {
-            SafeDelete(target);
-            m_components.erase(itr);
-            break;
+            m_components.erase(foundItr);
+            UnregisterComponent(target);
+            Ty::Destroy(target);
          }
       }
    }
@@ -183,13 +210,18 @@ namespace Mile
    template <typename Ty>
    void Entity::RemoveComponents()
    {
-      for (auto itr = m_components.begin(); itr != m_components.end(); ++itr)
+      for (auto itr = m_components.begin(); itr != m_components.end();)
       {
          Component* foundComponent = *itr;
          if (typeid(Ty) == typeid (*(foundComponent)))
          {
-            SafeDelete(foundComponent);
-            m_components.erase(itr);
+            UnregisterComponent(foundComponent);
+            Ty::Destroy(foundComponent);
+            itr = m_components.erase(itr);
+         }
+         else
+         {
+            ++itr;
          }
       }
    }
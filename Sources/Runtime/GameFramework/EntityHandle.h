@@ -0,0 +1,22 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+
+namespace Mile
+{
+   constexpr UINT32 INVALID_ENTITY_INDEX = 0xffffffff;
+
+   /**
+    * @brief   Weak reference to entity of world. Slot of destroyed entity is reused with increased generation,
+    *          so handles of destroyed entity never validate against new entity.
+    */
+   struct EntityHandle
+   {
+      UINT32 Index = INVALID_ENTITY_INDEX;
+      UINT32 Generation = 0;
+
+      bool IsNull() const { return (Index == INVALID_ENTITY_INDEX); }
+
+      bool operator==(const EntityHandle& rhs) const { return (Index == rhs.Index) && (Generation == rhs.Generation); }
+      bool operator!=(const EntityHandle& rhs) const { return !(*this == rhs); }
+   };
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "GameFramework/Prefab.h"
+#include "GameFramework/Entity.h"
+#include "GameFramework/World.h"
+#include "GameFramework/Transform.h"
+#include "Component/Component.h"
+
+namespace Mile
+{
+   void Prefab::Compile(const Entity* root)
+   {
+      Clear();
+      Compile(root, PREFAB_NULL_INDEX);
+   }
+
+   void Prefab::Compile(const Entity* entity, UINT32 parent)
+   {
+      if (entity == nullptr || !entity->m_bIsSerializable)
+      {
+         return;
+      }
+
+      PrefabEntity record;
+      record.Name = entity->m_name;
+      record.NameUTF8 = entity->m_nameUTF8;
+      record.Tag = entity->m_tag;
+      record.TagUTF8 = entity->m_tagUTF8;
+      record.Parent = parent;
+      record.bIsActivated = entity->m_bIsActivated;
+
+      const Transform* transform = entity->m_transform;
+      record.Position = transform->GetPosition();
+      record.Scale = transform->GetScale();
+      record.Rotation = transform->GetRotation();
+
+      record.FirstComponent = static_cast<UINT32>(m_components.size());
+      ComponentRegister& componentRegister = ComponentRegister::GetInstance();
+      for (const Component* component : entity->m_components)
+      {
+         PrefabComponent componentRecord;
+         componentRecord.Data = component->Serialize();
+         componentRecord.Constructor = componentRegister.FindConstructor(WString2String(component->GetType()));
+         if (componentRecord.Constructor != nullptr)
+         {
+            m_components.push_back(std::move(componentRecord));
+         }
+      }
+      record.ComponentNum = static_cast<UINT32>(m_components.size()) - record.FirstComponent;
+
+      UINT32 entityIdx = static_cast<UINT32>(m_entities.size());
+      if (parent != PREFAB_NULL_INDEX)
+      {
+         ++m_entities[parent].ChildrenNum;
+      }
+      m_entities.push_back(std::move(record));
+
+      for (const Entity* child : entity->m_children)
+      {
+         Compile(child, entityIdx);
+      }
+   }
+
+   void Prefab::Clear()
+   {
+      m_entities.clear();
+      m_components.clear();
+   }
+
+   Entity* Prefab::Instantiate(World* targetWorld, const String& entityName) const
+   {
+      if (targetWorld == nullptr)
+      {
+         return nullptr;
+      }
+
+      std::vector<Entity*> instances;
+      instances.reserve(m_entities.size());
+      targetWorld->ReserveEntities(std::max<size_t>(m_entities.size(), 1));
+      return Instantiate(targetWorld, entityName, instances);
+   }
+
+   std::vector<Entity*> Prefab::InstantiateMany(World* targetWorld, size_t count, const String& entityName) const
+   {
+      std::vector<Entity*> roots;
+      if (targetWorld == nullptr)
+      {
+         return roots;
+      }
+
+      roots.reserve(count);
+      targetWorld->ReserveEntities(count * std::max<size_t>(m_entities.size(), 1));
+
+      std::vector<Entity*> instances;
+      instances.reserve(m_entities.size());
+      for (size_t idx = 0; idx < count; ++idx)
+      {
+         roots.push_back(Instantiate(targetWorld, entityName, instances));
+      }
+
+      return roots;
+   }
+
+   Entity* Prefab::Instantiate(World* targetWorld, const String& entityName, std::vector<Entity*>& instances) const
+   {
+      if (IsEmpty())
+      {
+         return targetWorld->CreateEntity(entityName);
+      }
+
+      instances.clear();
+      for (const PrefabEntity& record : m_entities)
+      {
+         Entity* entity = targetWorld->CreateEntity(TEXT(""));
+         entity->ApplyName(record.Name, record.NameUTF8);
+         entity->m_tag = record.Tag;
+         entity->m_tagUTF8 = record.TagUTF8;
+         entity->m_bIsActivated = record.bIsActivated;
+         entity->m_children.reserve(record.ChildrenNum);
+         entity->m_components.reserve(record.ComponentNum);
+
+         if (record.Parent != PREFAB_NULL_INDEX)
+         {
+            /** Local transform must be applied after attached to parent. */
+            instances[record.Parent]->AttachChild(entity);
+         }
+
+         Transform* transform = entity->m_transform;
+         transform->SetPosition(record.Position);
+         transform->SetScale(record.Scale);
+         transform->SetRotation(record.Rotation);
+
+         for (UINT32 idx = 0; idx < record.ComponentNum; ++idx)
+         {
+            const PrefabComponent& componentRecord = m_components[record.FirstComponent + idx];
+            Component* component = (*componentRecord.Constructor)(entity);
+            component->DeSerialize(componentRecord.Data);
+            entity->m_components.push_back(component);
+            entity->RegisterComponent(component);
+         }
+
+         instances.push_back(entity);
+      }
+
+      Entity* root = instances.front();
+      root->SetName(entityName);
+      return root;
+   }
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+#include "Math/Vector3.h"
+#include "Math/Quaternion.h"
+#include "Component/ComponentRegister.h"
+
+namespace Mile
+{
+   class Entity;
+   class World;
+
+   constexpr UINT32 PREFAB_NULL_INDEX = 0xffffffff;
+
+   /** Construction record of entity. Names are kept in both encodings to avoid conversion per instance. */
+   struct PrefabEntity
+   {
+      String Name;
+      std::string NameUTF8;
+      String Tag;
+      std::string TagUTF8;
+      UINT32 Parent = PREFAB_NULL_INDEX;
+      bool bIsActivated = true;
+      /** Local transform */
+      Vector3 Position;
+      Vector3 Scale = Vector3(1.0f, 1.0f, 1.0f);
+      Quaternion Rotation;
+      UINT32 FirstComponent = 0;
+      UINT32 ComponentNum = 0;
+      UINT32 ChildrenNum = 0;
+   };
+
+   /** Construction record of component. Constructor is resolved and properties are parsed at compile time. */
+   struct PrefabComponent
+   {
+      const ComponentRegister::ConstructorType* Constructor = nullptr;
+      json Data;
+   };
+
+   /**
+    * @brief   Compiled entity hierarchy which can be instantiated repeatedly.
+    *          Entities are stored in pre-order, so parent always precedes its children.
+    */
+   class MEAPI Prefab
+   {
+   public:
+      /** Compile given entity and its every descendant. Entities which serialization is disabled are skipped. */
+      void Compile(const Entity* root);
+      void Clear();
+
+      bool IsEmpty() const { return m_entities.empty(); }
+      size_t GetEntitiesNum() const { return m_entities.size(); }
+
+      /**
+       * @brief   Empty prefab(ex. model which has failed to load) still instantiates an entity without any component.
+       * @return  Root entity of new instance, nullptr only if there is no target world.
+       */
+      Entity* Instantiate(World* targetWorld, const String& entityName) const;
+
+      /**
+       * @brief   Spawn multiple instances at once. World storage is reserved once for every instance.
+       * @return  Root entities of new instances
+       */
+      std::vector<Entity*> InstantiateMany(World* targetWorld, size_t count, const String& entityName) const;
+
+   private:
+      void Compile(const Entity* entity, UINT32 parent);
+      Entity* Instantiate(World* targetWorld, const String& entityName, std::vector<Entity*>& instances) const;
+
+   private:
+      std::vector<PrefabEntity> m_entities;
+      std::vector<PrefabComponent> m_components;
+
+   };
+}
\ No newline at end of file
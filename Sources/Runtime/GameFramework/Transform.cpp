@@ -28,4 +28,68 @@ namespace Mile
       res.Normalize();
       return res;
    }
+
+   void Transform::UpdateHierarchy()
+   {
+      UpdateCache();
+      if (m_bHasDirtyDescendant)
+      {
+         m_bHasDirtyDescendant = false;
+         for (Transform* child : m_children)
+         {
+            if (child->m_bIsDirty || child->m_bHasDirtyDescendant)
+            {
+               child->UpdateHierarchy();
+            }
+         }
+      }
+   }
+
+   void Transform::MarkDirty()
+   {
+      if (!m_bIsDirty)
+      {
+         m_bIsDirty = true;
+         ++m_version;
+         for (Transform* child : m_children)
+         {
+            child->MarkDirty();
+         }
+      }
+
+      for (Transform* parent = m_parent; parent != nullptr && !parent->m_bHasDirtyDescendant; parent = parent->m_parent)
+      {
+         parent->m_bHasDirtyDescendant = true;
+      }
+   }
+
+   void Transform::UpdateCacheImpl() const
+   {
+      m_localMatrix = Matrix::CreateTransformMatrix(m_position, m_scale, m_rotation);
+      Matrix invLocalMatrix = Matrix::CreateTransformMatrix(
+         Vector3(-m_position.x, -m_position.y, -m_position.z),
+         Vector3(1.0f / m_scale.x, 1.0f / m_scale.y, 1.0f / m_scale.z),
+         m_rotation.Inverse());
+      Matrix localRotTransMatrix = Matrix::CreateRotation(m_rotation) * Matrix::CreateTranslation(m_position);
+
+      if (m_parent != nullptr)
+      {
+         m_parent->UpdateCache();
+         m_worldMatrix = m_localMatrix * m_parent->m_worldMatrix;
+         m_inverseWorldMatrix = invLocalMatrix * m_parent->m_inverseWorldMatrix;
+         m_worldRotTransMatrix = localRotTransMatrix * m_parent->m_worldRotTransMatrix;
+         m_worldRotation = m_parent->m_worldRotation.Rotated(m_rotation);
+         m_worldScale = m_scale * m_parent->m_worldScale;
+      }
+      else
+      {
+         m_worldMatrix = m_localMatrix;
+         m_inverseWorldMatrix = invLocalMatrix;
+         m_worldRotTransMatrix = localRotTransMatrix;
+         m_worldRotation = m_rotation;
+         m_worldScale = m_scale;
+      }
+
+      m_bIsDirty = false;
+   }
 }
\ No newline at end of file
@@ -9,6 +9,13 @@
 namespace Mile
 {
    class Entity;
+   /**
+   * @brief   Local transform of entity with cached local/world matrices.
+   *          Changes mark the transform and its descendants as dirty, cached matrices are recomputed at most once per change.
+   *          Getters recompute dirty caches lazily, which writes the cache without any synchronization.
+   *          Dirty transforms are resolved eagerly on main thread by World::UpdateTransforms before worker threads
+   *          read them (parallel update phases, culling and rendering); Getters of clean transforms do not write anything.
+   */
    class MEAPI alignas(16) Transform
    {
    public:
@@ -17,7 +24,10 @@ namespace Mile
          m_position(position),
          m_scale(scale),
          m_rotation(rotation),
-         m_parent(nullptr)
+         m_parent(nullptr),
+         m_bIsDirty(true),
+         m_bHasDirtyDescendant(false),
+         m_version(1)
       {
       }
 
@@ -27,6 +37,19 @@ namespace Mile
       {
       }
 
+      ~Transform()
+      {
+         DetachFromParent();
+         for (Transform* child : m_children)
+         {
+            child->m_parent = nullptr;
+            child->MarkDirty();
+         }
+      }
+
+      Transform(const Transform&) = delete;
+      Transform& operator=(const Transform&) = delete;
+
       json Serialize() const
       {
          json serialized;
@@ -41,6 +64,7 @@ namespace Mile
          m_position.DeSerialize(jsonObj["Position"]);
          m_scale.DeSerialize(jsonObj["Scale"]);
          m_rotation.DeSerialize(jsonObj["Rotation"]);
+         MarkDirty();
       }
 
       Vector3 GetPosition(ETransformSpace space = ETransformSpace::Local) const
@@ -64,13 +88,16 @@ namespace Mile
          {
             m_position = position;
          }
+
+         MarkDirty();
       }
 
       Vector3 GetScale(ETransformSpace space = ETransformSpace::Local) const
       {
          if (space == ETransformSpace::World && HasParent())
          {
-            return m_scale * m_parent->GetScale(space);
+            UpdateCache();
+            return m_worldScale;
          }
 
          return m_scale;
@@ -87,6 +114,8 @@ namespace Mile
          {
             m_scale = scale;
          }
+
+         MarkDirty();
       }
 
       void SetRotation(const Quaternion& rot, ETransformSpace space = ETransformSpace::Local)
@@ -99,13 +128,16 @@ namespace Mile
          {
             m_rotation = rot;
          }
+
+         MarkDirty();
       }
 
       Quaternion GetRotation(ETransformSpace space = ETransformSpace::Local) const
       {
          if (space == ETransformSpace::World && HasParent())
          {
-            return m_parent->GetRotation(ETransformSpace::World).Rotated(m_rotation);
+            UpdateCache();
+            return m_worldRotation;
          }
          else
          {
@@ -137,46 +169,41 @@ namespace Mile
       bool HasParent() const { return m_parent != nullptr; }
       Entity* GetEntity() const { return m_entity; }
 
-      Matrix GetWorldMatrix() const
+      const Matrix& GetLocalMatrix() const
       {
-         Matrix localMatrix = Matrix::CreateTransformMatrix(m_position, m_scale, m_rotation);
-         if (m_parent != nullptr)
-         {
-            return localMatrix * m_parent->GetWorldMatrix();
-         }
-
-         return localMatrix;
+         UpdateCache();
+         return m_localMatrix;
       }
 
-      Matrix GetInverseWorldMatrix() const
+      const Matrix& GetWorldMatrix() const
       {
-         Matrix invLocalMatrix = Matrix::CreateTransformMatrix(
-            Vector3(-m_position.x, -m_position.y, -m_position.z),
-            Vector3(1.0f / m_scale.x, 1.0f / m_scale.y, 1.0f / m_scale.z),
-            m_rotation.Inverse());
-
-         if (m_parent != nullptr)
-         {
-            return invLocalMatrix * m_parent->GetInverseWorldMatrix();
-         }
-
-         return invLocalMatrix;
+         UpdateCache();
+         return m_worldMatrix;
       }
 
-      Matrix GetWorldRotTransMatrix() const
+      const Matrix& GetInverseWorldMatrix() const
       {
-         Matrix localMatrix = Matrix::CreateRotation(m_rotation) * Matrix::CreateTranslation(m_position);
-         if (m_parent != nullptr)
-         {
-            return localMatrix * m_parent->GetWorldRotTransMatrix();
-         }
+         UpdateCache();
+         return m_inverseWorldMatrix;
+      }
 
-         return localMatrix;
+      const Matrix& GetWorldRotTransMatrix() const
+      {
+         UpdateCache();
+         return m_worldRotTransMatrix;
       }
 
       Vector3 GetForward(ETransformSpace space = ETransformSpace::World) const;
       Vector3 GetUp(ETransformSpace space = ETransformSpace::World) const;
 
+      bool IsDirty() const { return m_bIsDirty; }
+      bool HasDirtyDescendant() const { return m_bHasDirtyDescendant; }
+      /** Increased whenever world transform has been changed. */
+      UINT64 GetVersion() const { return m_version; }
+
+      /** Recompute every dirty transform of this subtree. Parent always updated before its children. */
+      void UpdateHierarchy();
+
    private:
       void SetParent(Transform* parent)
       {
@@ -186,6 +213,7 @@ namespace Mile
             Vector3 oldWorldScale = GetScale(ETransformSpace::World);
             Quaternion oldWorldRotation = GetRotation(ETransformSpace::World);
 
+            DetachFromParent();
             if (parent == nullptr)
             {
                SetPosition(oldWorldPos);
@@ -195,6 +223,7 @@ namespace Mile
             else
             {
                m_parent = parent;
+               m_parent->m_children.push_back(this);
                SetPosition(oldWorldPos, ETransformSpace::World);
                SetScale(oldWorldScale, ETransformSpace::World);
                SetRotation(oldWorldRotation, ETransformSpace::World);
@@ -202,6 +231,29 @@ namespace Mile
          }
       }
 
+      void DetachFromParent()
+      {
+         if (m_parent != nullptr)
+         {
+            auto& siblings = m_parent->m_children;
+            siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+            m_parent = nullptr;
+         }
+      }
+
+      /** Dirty transform always has dirty descendants, so propagation stops at already dirty transform. */
+      void MarkDirty();
+
+      void UpdateCache() const
+      {
+         if (m_bIsDirty)
+         {
+            UpdateCacheImpl();
+         }
+      }
+
+      void UpdateCacheImpl() const;
+
    private:
       /* Local Transform **/
       Vector3     m_position;
@@ -210,6 +262,18 @@ namespace Mile
 
       Entity* m_entity;
       Transform* m_parent;
+      std::vector<Transform*> m_children;
+
+      /* Cached Transform **/
+      mutable Matrix m_localMatrix;
+      mutable Matrix m_worldMatrix;
+      mutable Matrix m_inverseWorldMatrix;
+      mutable Matrix m_worldRotTransMatrix;
+      mutable Quaternion m_worldRotation;
+      mutable Vector3 m_worldScale;
+      mutable bool m_bIsDirty;
+      bool m_bHasDirtyDescendant;
+      UINT64 m_version;
 
       friend Entity;
    };
@@ -1,16 +1,42 @@
 #include "GameFramework/World.h"
 #include "Core/Context.h"
 #include "Core/Config.h"
+#include "Core/MappedFile.h"
+#include "Core/FrameTimeline.h"
 #include "Resource/ResourceManager.h"
 #include "Resource/PlainText.h"
 #include "Resource/Model.h"
+#include "GameFramework/Transform.h"
+#include "GameFramework/WorldArchive.h"
+#include "MT/ThreadPool.h"
 
 namespace Mile
 {
    DEFINE_LOG_CATEGORY(MileWorld);
 
+   static void EraseFromNameIndex(std::unordered_map<String, std::vector<Entity*>>& nameIndex, const String& name, Entity* entity)
+   {
+      auto foundItr = nameIndex.find(name);
+      if (foundItr != nameIndex.end())
+      {
+         auto& entities = foundItr->second;
+         auto foundEntity = std::find(entities.begin(), entities.end(), entity);
+         if (foundEntity != entities.end())
+         {
+            entities.erase(foundEntity);
+         }
+
+         if (entities.empty())
+         {
+            nameIndex.erase(foundItr);
+         }
+      }
+   }
+
    World::World(Context* context) :
       m_name(TEXT("Untitled")),
+      m_freeSlot(INVALID_ENTITY_INDEX),
+      m_latestEntityOrder(0),
       m_loadedData(nullptr),
       SubSystem(context)
    {
@@ -27,7 +53,7 @@ namespace Mile
       std::vector<json> serializedEntities;
       for (auto entity : m_entities)
       {
-         if (!entity->HasParent())
+         if (entity != nullptr && !entity->HasParent())
          {
             serializedEntities.push_back(entity->Serialize());
          }
@@ -41,7 +67,7 @@ namespace Mile
    {
       if (jsonData.find("Entities") != jsonData.end())
       {
-         const std::vector<json>& entities = jsonData["Entities"];
+         const json& entities = jsonData["Entities"];
          for (const auto& entity : entities)
          {
             Entity* temp = CreateEntity(TEXT(""));
@@ -50,6 +76,41 @@ namespace Mile
       }
    }
 
+   std::vector<UINT8> World::SerializeToArchive() const
+   {
+      WorldArchiveWriter writer;
+      for (auto entity : m_entities)
+      {
+         if (entity != nullptr && !entity->HasParent())
+         {
+            writer.AddEntity(entity);
+         }
+      }
+
+      return writer.Build();
+   }
+
+   void World::DeSerialize(const WorldArchiveView& archive)
+   {
+      size_t entitiesNum = archive.GetEntitiesNum();
+      std::vector<Entity*> loadedEntities;
+      loadedEntities.reserve(entitiesNum);
+      m_entities.reserve(m_entities.size() + entitiesNum);
+      for (size_t idx = 0; idx < entitiesNum; ++idx)
+      {
+         const WorldArchiveEntity& archivedEntity = archive.GetEntity(idx);
+         Entity* entity = CreateEntity(TEXT(""));
+         if (archivedEntity.Parent != WORLD_ARCHIVE_NULL_INDEX)
+         {
+            /** Local transform must be applied after attached to parent. */
+            loadedEntities[archivedEntity.Parent]->AttachChild(entity);
+         }
+
+         entity->DeSerialize(archive, archivedEntity);
+         loadedEntities.push_back(entity);
+      }
+   }
+
    bool World::Init()
    {
       Context* context = GetContext();
@@ -77,71 +138,332 @@ namespace Mile
 
    void World::Start()
    {
-      for (auto entity : m_entities)
+      /** Entities can be created or destroyed while iterating. */
+      for (size_t idx = 0; idx < m_entities.size(); ++idx)
       {
-         entity->Start();
+         Entity* entity = m_entities[idx];
+         if (entity != nullptr)
+         {
+            entity->Start();
+         }
       }
    }
 
    void World::Update()
    {
       OPTICK_EVENT();
+      ME_TIMELINE_SCOPE("World::Update");
+      BuildUpdateQueues();
+      for (const ComponentUpdateQueue& queue : m_updateQueues)
+      {
+         /** Serial components may destroy entities; Destroyed ones are released at flush. */
+         for (Component* component : queue.Serial)
+         {
+            if (!component->GetEntity()->IsPendingDestroy())
+            {
+               component->Update();
+            }
+         }
+
+         if (!queue.Parallel.empty())
+         {
+            /** Serial components may have moved entities; Parallel components must only see resolved transforms. */
+            UpdateTransforms();
+            UpdateParallel(queue);
+         }
+      }
+
+      FlushDestroyedEntities();
+      UpdateTransforms();
+   }
+
+   void World::BuildUpdateQueues()
+   {
+      OPTICK_EVENT();
+      for (ComponentUpdateQueue& queue : m_updateQueues)
+      {
+         queue.Serial.clear();
+         queue.Parallel.clear();
+         queue.HierarchyOffsets.clear();
+      }
+
+      for (Entity* entity : m_entities)
+      {
+         if (entity != nullptr && entity->GetParent() == nullptr)
+         {
+            std::array<size_t, COMPONENT_UPDATE_PHASE_NUM> hierarchyOffsets;
+            for (size_t phase = 0; phase < COMPONENT_UPDATE_PHASE_NUM; ++phase)
+            {
+               hierarchyOffsets[phase] = m_updateQueues[phase].Parallel.size();
+            }
+
+            GatherUpdates(entity);
+
+            for (size_t phase = 0; phase < COMPONENT_UPDATE_PHASE_NUM; ++phase)
+            {
+               ComponentUpdateQueue& queue = m_updateQueues[phase];
+               if (queue.Parallel.size() > hierarchyOffsets[phase])
+               {
+                  queue.HierarchyOffsets.push_back(hierarchyOffsets[phase]);
+               }
+            }
+         }
+      }
+   }
+
+   void World::GatherUpdates(Entity* entity)
+   {
+      /** Deactivated entity does not update its descendants either. */
+      if (entity->m_bIsActivated && entity->IsUpdateEnabled())
+      {
+         for (Component* component : entity->m_components)
+         {
+            if (component->IsActivated() && component->IsUpdateEnabled())
+            {
+               ComponentUpdateQueue& queue = m_updateQueues[static_cast<size_t>(component->GetUpdatePhase())];
+               if (component->IsParallelUpdatable())
+               {
+                  queue.Parallel.push_back(component);
+               }
+               else
+               {
+                  queue.Serial.push_back(component);
+               }
+            }
+         }
+
+         for (Entity* child : entity->m_children)
+         {
+            GatherUpdates(child);
+         }
+      }
+   }
+
+   void World::UpdateParallel(const ComponentUpdateQueue& queue)
+   {
+      size_t hierarchiesNum = queue.HierarchyOffsets.size();
+      auto updateHierarchies = [&queue, hierarchiesNum](size_t begin, size_t end)
+      {
+         for (size_t hierarchy = begin; hierarchy < end; ++hierarchy)
+         {
+            size_t first = queue.HierarchyOffsets[hierarchy];
+            size_t last = ((hierarchy + 1) < hierarchiesNum) ? queue.HierarchyOffsets[hierarchy + 1] : queue.Parallel.size();
+            for (size_t idx = first; idx < last; ++idx)
+            {
+               Component* component = queue.Parallel[idx];
+               if (!component->GetEntity()->IsPendingDestroy())
+               {
+                  component->Update();
+               }
+            }
+         }
+      };
+
+      /** Parallel components must not create or destroy entities or components; Catch it on debug build. */
+      m_allocator.SetLocked(true);
+      ThreadPool* threadPool = GetContext()->GetSubSystem<ThreadPool>();
+      if (threadPool != nullptr && hierarchiesNum > 1)
+      {
+         /** Transform changes propagate through hierarchy, so a hierarchy never splits across threads. */
+         threadPool->ParallelFor(0, hierarchiesNum, updateHierarchies);
+      }
+      else
+      {
+         updateHierarchies(0, hierarchiesNum);
+      }
+      m_allocator.SetLocked(false);
+   }
+
+   void World::UpdateTransforms() const
+   {
+      OPTICK_EVENT();
+      std::vector<Transform*> dirtyRoots;
       for (auto entity : m_entities)
       {
-         entity->Update();
+         if (entity == nullptr)
+         {
+            continue;
+         }
+
+         Transform* transform = entity->GetTransform();
+         if (!transform->HasParent() && (transform->IsDirty() || transform->HasDirtyDescendant()))
+         {
+            dirtyRoots.push_back(transform);
+         }
+      }
+
+      /** Root hierarchies do not share any transform. */
+      ThreadPool* threadPool = GetContext()->GetSubSystem<ThreadPool>();
+      if (threadPool != nullptr && dirtyRoots.size() > 1)
+      {
+         threadPool->ParallelFor(0, dirtyRoots.size(),
+            [&dirtyRoots](size_t begin, size_t end)
+            {
+               for (size_t idx = begin; idx < end; ++idx)
+               {
+                  dirtyRoots[idx]->UpdateHierarchy();
+               }
+            });
+      }
+      else
+      {
+         for (Transform* root : dirtyRoots)
+         {
+            root->UpdateHierarchy();
+         }
       }
    }
 
    Entity* World::CreateEntity(const String& name)
    {
-      auto newEntity = new Entity(this, name);
-      m_entities.push_back(newEntity);
+      auto newEntity = new (m_allocator.Allocate(typeid(Entity), sizeof(Entity), alignof(Entity))) Entity(this, name);
+      RegisterEntity(newEntity);
 
       return newEntity;
    }
 
+   void World::RegisterEntity(Entity* entity)
+   {
+      UINT32 slotIdx = m_freeSlot;
+      if (slotIdx != INVALID_ENTITY_INDEX)
+      {
+         m_freeSlot = m_slots[slotIdx].NextFree;
+      }
+      else
+      {
+         slotIdx = static_cast<UINT32>(m_slots.size());
+         m_slots.emplace_back();
+      }
+
+      EntitySlot& slot = m_slots[slotIdx];
+      slot.Target = entity;
+      slot.NextFree = INVALID_ENTITY_INDEX;
+
+      entity->m_handle = EntityHandle{ slotIdx, slot.Generation };
+      entity->m_worldIndex = m_entities.size();
+      entity->m_worldOrder = ++m_latestEntityOrder;
+      m_entities.push_back(entity);
+      m_nameIndex[entity->GetName()].push_back(entity);
+   }
+
+   void World::ReleaseSlot(Entity* entity)
+   {
+      UINT32 slotIdx = entity->m_handle.Index;
+      EntitySlot& slot = m_slots[slotIdx];
+      slot.Target = nullptr;
+      ++slot.Generation;
+      slot.NextFree = m_freeSlot;
+      m_freeSlot = slotIdx;
+
+      entity->m_handle = EntityHandle();
+   }
+
+   void World::OnEntityRenamed(Entity* entity, const String& oldName)
+   {
+      if (!entity->m_handle.IsNull())
+      {
+         EraseFromNameIndex(m_nameIndex, oldName, entity);
+         m_nameIndex[entity->GetName()].push_back(entity);
+      }
+   }
+
    bool World::DestroyEntity(Entity* target)
    {
-      for (auto itr = m_entities.begin(); itr != m_entities.end(); ++itr)
+      /** Destroy only queues entity, so allocator does not catch it during parallel update. */
+      assert(!m_allocator.IsLocked() && "Entity must not be destroyed during parallel update.");
+      if (CheckEntityValidation(target))
       {
-         if (target == (*itr))
-         {
-            ME_LOG(MileWorld, Log, String(TEXT("Destroy entity : ")) + target->GetName());
-            m_entities.erase(itr);
-            for (auto child : target->GetChildren())
-            {
-               DestroyEntity(child);
-            }
+         ME_LOG(MileWorld, Log, TEXT("Destroy entity : %s"), target->GetName().c_str());
 
-            SafeDelete(target);
-            return true;
+         /** Parent must not keep pointer to destroyed entity, since its memory will be reused by pool. */
+         Entity* parent = target->GetParent();
+         if (parent != nullptr)
+         {
+            parent->DetachChild(target);
          }
+
+         QueueDestroy(target);
+         return true;
       }
 
       return false;
    }
 
-   bool World::CheckEntityValidation(Entity* target) const
+   bool World::DestroyEntity(EntityHandle handle)
+   {
+      return DestroyEntity(GetEntity(handle));
+   }
+
+   void World::QueueDestroy(Entity* entity)
+   {
+      entity->m_bIsPendingDestroy = true;
+      EraseFromNameIndex(m_nameIndex, entity->GetName(), entity);
+      ReleaseSlot(entity);
+      m_entities[entity->m_worldIndex] = nullptr;
+      for (Component* component : entity->m_components)
+      {
+         m_componentRegistry.Unregister(component);
+      }
+      m_pendingDestroy.push_back(entity);
+
+      for (Entity* child : entity->m_children)
+      {
+         if (child->m_world == this)
+         {
+            QueueDestroy(child);
+         }
+      }
+   }
+
+   void World::FlushDestroyedEntities()
    {
+      /** Slots of removed components are compacted here as well, including components which have been removed from living entities. */
+      m_componentRegistry.Compact();
+      if (m_pendingDestroy.empty())
+      {
+         return;
+      }
+
+      OPTICK_EVENT();
+      for (Entity* entity : m_pendingDestroy)
+      {
+         /** Children of this world are pending as well. */
+         auto& children = entity->m_children;
+         children.erase(std::remove_if(children.begin(), children.end(),
+            [this](Entity* child) { return child->m_world == this; }), children.end());
+      }
+
+      for (Entity* entity : m_pendingDestroy)
+      {
+         m_allocator.Delete(entity);
+      }
+      m_pendingDestroy.clear();
+
+      /** Compact storage once, keeping order of entities. */
+      size_t aliveNum = 0;
       for (Entity* entity : m_entities)
       {
-         if (entity == target)
+         if (entity != nullptr)
          {
-            return true;
+            entity->m_worldIndex = aliveNum;
+            m_entities[aliveNum] = entity;
+            ++aliveNum;
          }
       }
+      m_entities.resize(aliveNum);
+   }
 
-      return false;
+   bool World::CheckEntityValidation(Entity* target) const
+   {
+      return (target != nullptr) && (target->m_world == this) && (GetEntity(target->m_handle) == target);
    }
 
    Entity* World::GetEntityByName(const String& name) const
    {
-      for (const auto& entity : m_entities)
+      auto foundItr = m_nameIndex.find(name);
+      if (foundItr != m_nameIndex.end() && !foundItr->second.empty())
       {
-         if (name == (entity)->GetName())
-         {
-            return entity;
-         }
+         return foundItr->second.front();
       }
 
       return nullptr;
@@ -149,7 +471,17 @@ namespace Mile
 
    std::vector<Entity*> World::GetEntities() const
    {
-      return m_entities;
+      std::vector<Entity*> entities;
+      entities.reserve(GetEntitiesNum());
+      for (auto entity : m_entities)
+      {
+         if (entity != nullptr)
+         {
+            entities.push_back(entity);
+         }
+      }
+
+      return entities;
    }
 
    std::vector<Entity*> World::GetRootEntities() const
@@ -157,7 +489,7 @@ namespace Mile
       std::vector<Entity*> rootEntities{ };
       for (auto entity : m_entities)
       {
-         if (entity->GetParent() == nullptr)
+         if (entity != nullptr && entity->GetParent() == nullptr)
          {
             rootEntities.push_back(entity);
          }
@@ -168,6 +500,31 @@ namespace Mile
 
    bool World::LoadFrom(const String& filePath, bool bClearWorld)
    {
+      MappedFile mappedFile;
+      if (mappedFile.Open(filePath) && WorldArchiveView::IsWorldArchive(mappedFile.GetData(), mappedFile.GetSize()))
+      {
+         WorldArchiveView archive{ mappedFile.GetData(), mappedFile.GetSize() };
+         if (archive.IsValid())
+         {
+            if (bClearWorld)
+            {
+               Clear();
+            }
+
+            this->m_loadedData = nullptr;
+            this->m_archivePath = filePath;
+            this->m_name = Resource::GetFileNameFromPath(filePath);
+            this->DeSerialize(archive);
+            ME_LOG(MileWorld, Log, TEXT("World loaded. : ") + filePath);
+            OnWorldLoaded.Broadcast();
+            return true;
+         }
+
+         ME_LOG(MileWorld, Fatal, TEXT("World archive is corrupted. : ") + filePath);
+         return false;
+      }
+      mappedFile.Close();
+
       Context* context = GetContext();
       auto resMng = context->GetSubSystem<ResourceManager>();
       auto res = resMng->Create<PlainText<std::string>>(filePath);
@@ -179,6 +536,7 @@ namespace Mile
          }
 
          this->m_loadedData = res;
+         this->m_archivePath.clear();
          this->m_name = m_loadedData->GetName();
          this->DeSerialize(json::parse(res->GetData().empty() ? "{}" : res->GetData()));
          ME_LOG(MileWorld, Log, TEXT("World loaded. : ") + filePath);
@@ -192,6 +550,26 @@ namespace Mile
 
    bool World::SaveTo(const String& filePath)
    {
+      if (std::filesystem::path(filePath).extension() == WORLD_ARCHIVE_EXTENSION)
+      {
+         std::vector<UINT8> archive = SerializeToArchive();
+         std::ofstream stream(std::filesystem::path(filePath), std::ios::binary | std::ios::trunc);
+         if (stream.is_open())
+         {
+            stream.write(reinterpret_cast<const char*>(archive.data()), archive.size());
+            if (stream.good())
+            {
+               m_loadedData = nullptr;
+               m_archivePath = filePath;
+               m_name = Resource::GetFileNameFromPath(filePath);
+               ME_LOG(MileWorld, Log, TEXT("World data saved. : ") + filePath);
+               return true;
+            }
+         }
+
+         return false;
+      }
+
       Context* context = GetContext();
       auto resMng = context->GetSubSystem<ResourceManager>();
       auto res = resMng->GetByPath<PlainText<std::string>>(filePath);
@@ -207,6 +585,7 @@ namespace Mile
          if (res->Save())
          {
             m_loadedData = res;
+            m_archivePath.clear();
             m_name = m_loadedData->GetName();
             ME_LOG(MileWorld, Log, TEXT("World data saved. : ") + res->GetPath());
             return true;
@@ -218,6 +597,11 @@ namespace Mile
 
    bool World::Save()
    {
+      if (!m_archivePath.empty())
+      {
+         return SaveTo(m_archivePath);
+      }
+
       if (m_loadedData != nullptr)
       {
          m_loadedData->SetData(this->Serialize().dump());
@@ -233,13 +617,40 @@ namespace Mile
 
    void World::Clear()
    {
+      FlushDestroyedEntities();
+      /** Cleared at once before entities are deleted, so components are not unregistered one by one. */
+      m_componentRegistry.Clear();
+      for (auto entity : m_entities)
+      {
+         /** Children of this world are destroyed by world, not by their parent. */
+         auto& children = entity->m_children;
+         children.erase(std::remove_if(children.begin(), children.end(),
+            [this](Entity* child) { return child->m_world == this; }), children.end());
+      }
+
       for (auto entity : m_entities)
       {
-         SafeDelete(entity);
+         m_allocator.Delete(entity);
       }
 
       m_entities.clear();
+      m_nameIndex.clear();
+      for (UINT32 idx = 0; idx < m_slots.size(); ++idx)
+      {
+         /** Keep generations, so handles acquired before clear remain invalid. */
+         EntitySlot& slot = m_slots[idx];
+         if (slot.Target != nullptr)
+         {
+            slot.Target = nullptr;
+            ++slot.Generation;
+            slot.NextFree = m_freeSlot;
+            m_freeSlot = idx;
+         }
+      }
+
+      m_allocator.Release();
       m_loadedData = nullptr;
+      m_archivePath.clear();
 
       m_name = TEXT("Untitled");
 
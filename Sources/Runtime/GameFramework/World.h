@@ -1,8 +1,10 @@
 #pragma once
 #include "Core/Logger.h"
 #include "Core/Delegate.h"
+#include "Core/PoolAllocator.h"
 #include "Component/Component.h"
 #include "GameFramework/Entity.h"
+#include "GameFramework/ComponentRegistry.h"
 
 namespace Mile
 {
@@ -13,8 +15,11 @@ namespace Mile
    template<typename Ty>
    class PlainText;
    class Entity;
+   class WorldArchiveView;
    class MEAPI World : public SubSystem
    {
+      friend Entity;
+
    public:
       World(Context* context);
       virtual ~World();
@@ -23,6 +28,12 @@ namespace Mile
       json Serialize() const;
       void DeSerialize(const json& jsonData);
 
+      /**
+      * @brief    Binary world archive. Archived entities are created in pre-order without intermediate JSON tree.
+      */
+      std::vector<UINT8> SerializeToArchive() const;
+      void DeSerialize(const WorldArchiveView& archive);
+
       /**
       * @brief    World ʱȭմϴ.
       */
@@ -36,25 +47,64 @@ namespace Mile
 
       /**
       * @brief    World Ǿִ Entity Update մϴ.
+      *           Components are updated phase by phase, and each entity is updated exactly once per frame.
+      *           Parallel updatable components of different root hierarchies are updated on thread pool.
+      *           In each phase, every serial component is updated before any parallel one,
+      *           so components of an entity are not always updated in order they have been added.
+      *           World allocator is locked during parallel update; See Component::IsParallelUpdatable.
       */
       void Update();
 
+      /**
+      * @brief    Recompute dirty transforms of every entity. Root hierarchies are updated in parallel.
+      *           Only cached matrices are written, so it is callable on const world.
+      *           Must be called on main thread before any worker thread reads transforms of this world.
+      *           (World::Update calls it before parallel update phases, renderer calls it before rendering.)
+      */
+      void UpdateTransforms() const;
+
       /**
       * @brief    World ο Entity մϴ.
       * @return    Entity
       */
       Entity* CreateEntity(const String& name);
 
+      /**
+      * @brief    Reserve storage for given number of additional entities. (ex. Before spawning many prefab instances)
+      */
+      void ReserveEntities(size_t num) { m_entities.reserve(m_entities.size() + num); }
+
       /**
        * @brief   World  Entity ã մϴ
        * @return   ߴ
        */
       bool DestroyEntity(Entity* target);
+      bool DestroyEntity(EntityHandle handle);
+
+      /**
+       * @brief   Destroyed entities are invalidated immediately but released and removed from storage here at once.
+       *          Called at end of every update and when world has been cleared.
+       */
+      void FlushDestroyedEntities();
 
       /**
        * @breif    World ִ Entity Ȯմϴ.
        */
       bool CheckEntityValidation(Entity* target) const;
+      /** Prefer handle when entity may have been destroyed; Pointer of destroyed entity may be reused. */
+      bool CheckEntityValidation(EntityHandle handle) const { return (GetEntity(handle) != nullptr); }
+
+      /** @return   Entity which handle refers to, or nullptr if it has been destroyed. */
+      Entity* GetEntity(EntityHandle handle) const
+      {
+         if (handle.Index < m_slots.size())
+         {
+            const EntitySlot& slot = m_slots[handle.Index];
+            return (slot.Generation == handle.Generation) ? slot.Target : nullptr;
+         }
+
+         return nullptr;
+      }
 
       /**
       * @brief    World Ǿִ Entitiy ־ ̸  Entity ȯմϴ.
@@ -76,6 +126,7 @@ namespace Mile
 
       /**
        * @brief   忡 Ǿִ  Entity  ־ Ʈ Ÿ Ʈ  ȯմϴ.
+       *          First component of given type per entity, in order of entities. (Registry is used instead of walking entities.)
        */
       template <typename ComponentType, 
          std::enable_if_t<std::is_base_of_v<Component, ComponentType>, bool> = true>
@@ -90,29 +141,49 @@ namespace Mile
          std::enable_if_t<std::is_base_of_v<Component, ComponentType>, bool> = true>
          void GetComponentsFromEntities(std::vector<ComponentType*>& components, bool onlyActivated = true) const
       {
-         for (Entity* entity : m_entities)
+         ComponentSpan<ComponentType> registered = GetComponents<ComponentType>();
+         components.reserve(components.size() + registered.size());
+         /** Components of an entity are adjacent in registry; Only first of them, same as Entity::GetComponent. */
+         const Entity* latestEntity = nullptr;
+         for (ComponentType* component : registered)
          {
-            if (entity != nullptr)
+            const Entity* entity = component->GetEntity();
+            if (entity != latestEntity)
             {
-               ComponentType* foundComponent = nullptr;
-               foundComponent = entity->GetComponent<ComponentType>();
-
-               if (foundComponent != nullptr)
+               latestEntity = entity;
+               if ((onlyActivated && component->IsActivated()) || (!onlyActivated))
                {
-                  if ((onlyActivated && foundComponent->IsActivated()) || (!onlyActivated))
-                  {
-                     components.push_back(foundComponent);
-                  }
+                  components.push_back(component);
                }
             }
          }
       }
 
+      /**
+       * @brief   Every components of given type in this world(including deactivated ones) in order of entities, without walking entities.
+       *          Span is invalidated when component of same type has been added, or destroyed entities have been flushed.
+       */
+      template <typename ComponentType,
+         std::enable_if_t<std::is_base_of_v<Component, ComponentType>, bool> = true>
+      ComponentSpan<ComponentType> GetComponents() const
+      {
+         return m_componentRegistry.GetComponents<ComponentType>();
+      }
+
+      ComponentRegistry& GetComponentRegistry() { return m_componentRegistry; }
+
+      /**
+       * @brief   Entities, transforms and components of this world are allocated from typed pools of this allocator.
+       *          Every pool is released in bulk when world has been cleared.
+       */
+      ObjectPoolAllocator& GetAllocator() { return m_allocator; }
+      const ObjectPoolAllocator& GetAllocator() const { return m_allocator; }
+
       bool LoadFrom(const String& filePath, bool bClearWorld = true);
       bool SaveTo(const String& filePath);
       bool Save();
 
-      bool IsSaved() const { return (m_loadedData != nullptr); }
+      bool IsSaved() const { return (m_loadedData != nullptr) || !m_archivePath.empty(); }
 
       /**
        * @breif   忡 Ǿ ִ  Entity մϴ.
@@ -121,12 +192,52 @@ namespace Mile
 
       String GetWorldName() const { return m_name; }
 
-      size_t GetEntitiesNum() const { return m_entities.size(); }
+      size_t GetEntitiesNum() const { return m_entities.size() - m_pendingDestroy.size(); }
+
+   private:
+      /** Components to be updated in a phase of current frame. */
+      struct ComponentUpdateQueue
+      {
+         std::vector<Component*> Serial;
+         std::vector<Component*> Parallel;
+         /** Parallel components of same root hierarchy are contiguous; Begin offset of each hierarchy. */
+         std::vector<size_t> HierarchyOffsets;
+      };
+
+      struct EntitySlot
+      {
+         Entity* Target = nullptr;
+         UINT32 Generation = 0;
+         UINT32 NextFree = INVALID_ENTITY_INDEX;
+      };
+
+      void RegisterEntity(Entity* entity);
+      void ReleaseSlot(Entity* entity);
+      /** Invalidate entity and its every descendant, and queue them to be released. */
+      void QueueDestroy(Entity* entity);
+      void OnEntityRenamed(Entity* entity, const String& oldName);
+
+      /** Every activated entity is visited exactly once, from root hierarchies. */
+      void BuildUpdateQueues();
+      void GatherUpdates(Entity* entity);
+      void UpdateParallel(const ComponentUpdateQueue& queue);
 
    private:
       String m_name;
+      /** Destroyed entities are left as nullptr until flushed. */
       std::vector<Entity*> m_entities;
+      std::vector<EntitySlot> m_slots;
+      UINT32 m_freeSlot;
+      /** Order of latest entity which has been added to world. */
+      UINT64 m_latestEntityOrder;
+      std::unordered_map<String, std::vector<Entity*>> m_nameIndex;
+      std::vector<Entity*> m_pendingDestroy;
+      std::array<ComponentUpdateQueue, COMPONENT_UPDATE_PHASE_NUM> m_updateQueues;
+      ComponentRegistry m_componentRegistry;
+      ObjectPoolAllocator m_allocator;
       PlainText<std::string>* m_loadedData;
+      /** Path of binary world archive which world has been loaded from or saved to. */
+      String m_archivePath;
 
    public:
       OnWorldLoadedMulticastDelegate OnWorldLoaded;
@@ -0,0 +1,380 @@
+#include "GameFramework/WorldArchive.h"
+#include "GameFramework/Entity.h"
+#include "GameFramework/Transform.h"
+#include "Component/Component.h"
+
+namespace Mile
+{
+   static bool IsRangeValid(UINT64 offset, UINT64 elementSize, UINT64 num, size_t size)
+   {
+      if (offset > size)
+      {
+         return false;
+      }
+
+      return (num == 0) || (elementSize * num <= (size - offset));
+   }
+
+   static size_t AlignArchiveOffset(size_t offset)
+   {
+      return (offset + (WORLD_ARCHIVE_ALIGNMENT - 1)) & ~(WORLD_ARCHIVE_ALIGNMENT - 1);
+   }
+
+   WorldArchiveView::WorldArchiveView(const void* data, size_t size) :
+      m_data(reinterpret_cast<const UINT8*>(data)),
+      m_size(size),
+      m_header(nullptr),
+      m_strings(nullptr),
+      m_entities(nullptr),
+      m_components(nullptr)
+   {
+      if (!IsWorldArchive(data, size))
+      {
+         return;
+      }
+
+      const auto header = reinterpret_cast<const WorldArchiveHeader*>(m_data);
+      bool bIsValid =
+         header->TotalSize <= size &&
+         IsRangeValid(header->StringTableOffset, sizeof(WorldArchiveString), header->StringNum, size) &&
+         IsRangeValid(header->StringDataOffset, 1, 0, size) &&
+         IsRangeValid(header->EntityTableOffset, sizeof(WorldArchiveEntity), header->EntityNum, size) &&
+         IsRangeValid(header->ComponentTableOffset, sizeof(WorldArchiveComponent), header->ComponentNum, size) &&
+         IsRangeValid(header->PayloadOffset, 1, 0, size);
+      if (!bIsValid)
+      {
+         return;
+      }
+
+      const auto entities = reinterpret_cast<const WorldArchiveEntity*>(m_data + header->EntityTableOffset);
+      for (UINT32 idx = 0; idx < header->EntityNum; ++idx)
+      {
+         /** Pre-order; Parent must be loaded before its children. */
+         const WorldArchiveEntity& entity = entities[idx];
+         bool bIsParentValid = (entity.Parent == WORLD_ARCHIVE_NULL_INDEX) || (entity.Parent < idx);
+         bool bIsComponentsValid =
+            (entity.FirstComponent <= header->ComponentNum) &&
+            (entity.ComponentNum <= (header->ComponentNum - entity.FirstComponent));
+         if (!bIsParentValid || !bIsComponentsValid)
+         {
+            return;
+         }
+      }
+
+      m_header = header;
+      m_strings = reinterpret_cast<const WorldArchiveString*>(m_data + header->StringTableOffset);
+      m_entities = entities;
+      m_components = reinterpret_cast<const WorldArchiveComponent*>(m_data + header->ComponentTableOffset);
+   }
+
+   std::string_view WorldArchiveView::GetString(UINT32 idx) const
+   {
+      if (IsValid() && idx < m_header->StringNum)
+      {
+         const WorldArchiveString& str = m_strings[idx];
+         if (IsRangeValid(m_header->StringDataOffset + str.Offset, 1, str.Length, m_size))
+         {
+            return std::string_view(
+               reinterpret_cast<const char*>(m_data + m_header->StringDataOffset + str.Offset),
+               str.Length);
+         }
+      }
+
+      return std::string_view();
+   }
+
+   json WorldArchiveView::GetComponentData(const WorldArchiveComponent& component) const
+   {
+      if (IsValid() && IsRangeValid(component.PayloadOffset, 1, component.PayloadSize, m_size))
+      {
+         const UINT8* begin = m_data + component.PayloadOffset;
+         json data = json::from_cbor(begin, begin + component.PayloadSize, true, false);
+         if (!data.is_discarded())
+         {
+            return data;
+         }
+      }
+
+      return json();
+   }
+
+   json WorldArchiveView::ToJson() const
+   {
+      size_t entitiesNum = GetEntitiesNum();
+      std::vector<std::vector<UINT32>> children(entitiesNum);
+      std::vector<json> roots;
+      for (UINT32 idx = 0; idx < entitiesNum; ++idx)
+      {
+         UINT32 parent = m_entities[idx].Parent;
+         if (parent != WORLD_ARCHIVE_NULL_INDEX)
+         {
+            children[parent].push_back(idx);
+         }
+      }
+
+      for (UINT32 idx = 0; idx < entitiesNum; ++idx)
+      {
+         if (m_entities[idx].Parent == WORLD_ARCHIVE_NULL_INDEX)
+         {
+            roots.push_back(EntityToJson(idx, children));
+         }
+      }
+
+      json serialized;
+      serialized["Entities"] = std::move(roots);
+      return serialized;
+   }
+
+   json WorldArchiveView::EntityToJson(size_t idx, const std::vector<std::vector<UINT32>>& children) const
+   {
+      const WorldArchiveEntity& entity = m_entities[idx];
+      json serialized;
+      serialized["Name"] = std::string(GetString(entity.Name));
+      serialized["Tag"] = std::string(GetString(entity.Tag));
+      serialized["IsActivated"] = (entity.bIsActivated != 0);
+
+      json transform;
+      transform["Position"] = Vector3(entity.Position[0], entity.Position[1], entity.Position[2]).Serialize();
+      transform["Scale"] = Vector3(entity.Scale[0], entity.Scale[1], entity.Scale[2]).Serialize();
+      transform["Rotation"] = Quaternion(entity.Rotation[0], entity.Rotation[1], entity.Rotation[2], entity.Rotation[3]).Serialize();
+      serialized["Transform"] = std::move(transform);
+
+      std::vector<json> components;
+      components.reserve(entity.ComponentNum);
+      for (UINT32 compIdx = 0; compIdx < entity.ComponentNum; ++compIdx)
+      {
+         const WorldArchiveComponent& component = m_components[entity.FirstComponent + compIdx];
+         json serializedComponent = GetComponentData(component);
+         serializedComponent["Type"] = std::string(GetString(component.Type));
+         components.push_back(std::move(serializedComponent));
+      }
+      serialized["Components"] = std::move(components);
+
+      std::vector<json> serializedChildren;
+      serializedChildren.reserve(children[idx].size());
+      for (UINT32 child : children[idx])
+      {
+         serializedChildren.push_back(EntityToJson(child, children));
+      }
+      serialized["Children"] = std::move(serializedChildren);
+
+      return serialized;
+   }
+
+   bool WorldArchiveView::IsWorldArchive(const void* data, size_t size)
+   {
+      if (data == nullptr || size < sizeof(WorldArchiveHeader))
+      {
+         return false;
+      }
+
+      const auto header = reinterpret_cast<const WorldArchiveHeader*>(data);
+      return (header->Magic == WORLD_ARCHIVE_MAGIC) && (header->Version == WORLD_ARCHIVE_VERSION);
+   }
+
+   void WorldArchiveWriter::AddEntity(const Entity* entity)
+   {
+      AddEntity(entity, WORLD_ARCHIVE_NULL_INDEX);
+   }
+
+   void WorldArchiveWriter::AddEntity(const Entity* entity, UINT32 parent)
+   {
+      if (entity == nullptr || !entity->m_bIsSerializable)
+      {
+         return;
+      }
+
+      WorldArchiveEntity archived;
+      archived.Name = AddString(entity->GetNameUTF8());
+      archived.Tag = AddString(entity->GetTagUTF8());
+      archived.Parent = parent;
+      archived.bIsActivated = entity->m_bIsActivated ? 1 : 0;
+
+      const Transform* transform = entity->m_transform;
+      Vector3 position = transform->GetPosition();
+      Vector3 scale = transform->GetScale();
+      Quaternion rotation = transform->GetRotation();
+      archived.Position[0] = position.x; archived.Position[1] = position.y; archived.Position[2] = position.z;
+      archived.Scale[0] = scale.x; archived.Scale[1] = scale.y; archived.Scale[2] = scale.z;
+      archived.Rotation[0] = rotation.w; archived.Rotation[1] = rotation.x; archived.Rotation[2] = rotation.y; archived.Rotation[3] = rotation.z;
+
+      archived.FirstComponent = static_cast<UINT32>(m_components.size());
+      archived.ComponentNum = static_cast<UINT32>(entity->m_components.size());
+      for (const Component* component : entity->m_components)
+      {
+         AddComponent(component->Serialize());
+      }
+
+      UINT32 entityIdx = static_cast<UINT32>(m_entities.size());
+      m_entities.push_back(archived);
+      for (const Entity* child : entity->m_children)
+      {
+         AddEntity(child, entityIdx);
+      }
+   }
+
+   void WorldArchiveWriter::AddEntity(const json& serializedEntity)
+   {
+      AddEntity(serializedEntity, WORLD_ARCHIVE_NULL_INDEX);
+   }
+
+   void WorldArchiveWriter::AddEntity(const json& serializedEntity, UINT32 parent)
+   {
+      if (!serializedEntity.is_object() || serializedEntity.empty())
+      {
+         return;
+      }
+
+      WorldArchiveEntity archived;
+      archived.Name = AddString(GetValueSafelyFromJson(serializedEntity, "Name", std::string("Entity")));
+      archived.Tag = AddString(GetValueSafelyFromJson(serializedEntity, "Tag", std::string("None")));
+      archived.Parent = parent;
+      archived.bIsActivated = GetValueSafelyFromJson<bool>(serializedEntity, "IsActivated", true) ? 1 : 0;
+
+      auto foundTransform = serializedEntity.find("Transform");
+      if (foundTransform != serializedEntity.end())
+      {
+         Vector3 position;
+         Vector3 scale;
+         Quaternion rotation;
+         position.DeSerialize((*foundTransform)["Position"]);
+         scale.DeSerialize((*foundTransform)["Scale"]);
+         rotation.DeSerialize((*foundTransform)["Rotation"]);
+         archived.Position[0] = position.x; archived.Position[1] = position.y; archived.Position[2] = position.z;
+         archived.Scale[0] = scale.x; archived.Scale[1] = scale.y; archived.Scale[2] = scale.z;
+         archived.Rotation[0] = rotation.w; archived.Rotation[1] = rotation.x; archived.Rotation[2] = rotation.y; archived.Rotation[3] = rotation.z;
+      }
+
+      archived.FirstComponent = static_cast<UINT32>(m_components.size());
+      auto foundComponents = serializedEntity.find("Components");
+      if (foundComponents != serializedEntity.end())
+      {
+         for (const auto& component : (*foundComponents))
+         {
+            AddComponent(component);
+         }
+      }
+      archived.ComponentNum = static_cast<UINT32>(m_components.size()) - archived.FirstComponent;
+
+      UINT32 entityIdx = static_cast<UINT32>(m_entities.size());
+      m_entities.push_back(archived);
+
+      auto foundChildren = serializedEntity.find("Children");
+      if (foundChildren != serializedEntity.end())
+      {
+         for (const auto& child : (*foundChildren))
+         {
+            AddEntity(child, entityIdx);
+         }
+      }
+   }
+
+   void WorldArchiveWriter::AddWorld(const json& serializedWorld)
+   {
+      auto foundEntities = serializedWorld.find("Entities");
+      if (foundEntities != serializedWorld.end())
+      {
+         for (const auto& entity : (*foundEntities))
+         {
+            AddEntity(entity);
+         }
+      }
+   }
+
+   void WorldArchiveWriter::AddComponent(const json& serializedComponent)
+   {
+      WorldArchiveComponent archived;
+      json properties = serializedComponent;
+      auto foundType = properties.find("Type");
+      if (foundType != properties.end())
+      {
+         archived.Type = AddString(*foundType);
+         properties.erase(foundType);
+      }
+
+      std::vector<UINT8> payload = json::to_cbor(properties);
+      /** Payload offset is relative to payload section until archive has been built. */
+      archived.PayloadOffset = m_payloads.size();
+      archived.PayloadSize = static_cast<UINT32>(payload.size());
+      m_payloads.insert(m_payloads.end(), payload.begin(), payload.end());
+      m_components.push_back(archived);
+   }
+
+   UINT32 WorldArchiveWriter::AddString(const std::string& str)
+   {
+      auto foundItr = m_stringIndices.find(str);
+      if (foundItr != m_stringIndices.end())
+      {
+         return foundItr->second;
+      }
+
+      UINT32 idx = static_cast<UINT32>(m_strings.size());
+      m_strings.push_back(str);
+      m_stringIndices[str] = idx;
+      return idx;
+   }
+
+   std::vector<UINT8> WorldArchiveWriter::Build() const
+   {
+      WorldArchiveHeader header;
+      header.StringNum = static_cast<UINT32>(m_strings.size());
+      header.EntityNum = static_cast<UINT32>(m_entities.size());
+      header.ComponentNum = static_cast<UINT32>(m_components.size());
+
+      std::vector<WorldArchiveString> stringTable;
+      stringTable.reserve(m_strings.size());
+      size_t stringDataSize = 0;
+      for (const auto& str : m_strings)
+      {
+         WorldArchiveString archived;
+         archived.Offset = static_cast<UINT32>(stringDataSize);
+         archived.Length = static_cast<UINT32>(str.length());
+         stringTable.push_back(archived);
+         stringDataSize += str.length();
+      }
+
+      size_t offset = AlignArchiveOffset(sizeof(WorldArchiveHeader));
+      header.StringTableOffset = offset;
+      offset = AlignArchiveOffset(offset + (sizeof(WorldArchiveString) * stringTable.size()));
+      header.StringDataOffset = offset;
+      offset = AlignArchiveOffset(offset + stringDataSize);
+      header.EntityTableOffset = offset;
+      offset = AlignArchiveOffset(offset + (sizeof(WorldArchiveEntity) * m_entities.size()));
+      header.ComponentTableOffset = offset;
+      offset = AlignArchiveOffset(offset + (sizeof(WorldArchiveComponent) * m_components.size()));
+      header.PayloadOffset = offset;
+      header.TotalSize = offset + m_payloads.size();
+
+      std::vector<UINT8> archive(static_cast<size_t>(header.TotalSize), 0);
+      UINT8* data = archive.data();
+      std::memcpy(data, &header, sizeof(WorldArchiveHeader));
+      if (!stringTable.empty())
+      {
+         std::memcpy(data + header.StringTableOffset, stringTable.data(), sizeof(WorldArchiveString) * stringTable.size());
+      }
+
+      for (size_t idx = 0; idx < m_strings.size(); ++idx)
+      {
+         std::memcpy(data + header.StringDataOffset + stringTable[idx].Offset, m_strings[idx].data(), m_strings[idx].length());
+      }
+
+      if (!m_entities.empty())
+      {
+         std::memcpy(data + header.EntityTableOffset, m_entities.data(), sizeof(WorldArchiveEntity) * m_entities.size());
+      }
+
+      auto components = reinterpret_cast<WorldArchiveComponent*>(data + header.ComponentTableOffset);
+      for (size_t idx = 0; idx < m_components.size(); ++idx)
+      {
+         components[idx] = m_components[idx];
+         components[idx].PayloadOffset += header.PayloadOffset;
+      }
+
+      if (!m_payloads.empty())
+      {
+         std::memcpy(data + header.PayloadOffset, m_payloads.data(), m_payloads.size());
+      }
+
+      return archive;
+   }
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+#include <string_view>
+
+namespace Mile
+{
+   class Entity;
+
+   /** "MWLD" */
+   constexpr UINT32 WORLD_ARCHIVE_MAGIC = 0x444C574D;
+   constexpr UINT32 WORLD_ARCHIVE_VERSION = 1;
+   constexpr UINT32 WORLD_ARCHIVE_NULL_INDEX = 0xffffffff;
+   constexpr size_t WORLD_ARCHIVE_ALIGNMENT = 16;
+   constexpr wchar_t WORLD_ARCHIVE_EXTENSION[] = TEXT(".mworld");
+
+   /**
+    * @brief   Binary world archive layout. Every offset is relative to beginning of archive.
+    *          [Header][String table][String data][Entity table][Component table][Component payloads]
+    *          Entities are stored in pre-order, so parent always precedes its children and
+    *          components of an entity are contiguous in component table.
+    */
+   struct WorldArchiveHeader
+   {
+      UINT32 Magic = WORLD_ARCHIVE_MAGIC;
+      UINT32 Version = WORLD_ARCHIVE_VERSION;
+      UINT32 StringNum = 0;
+      UINT32 EntityNum = 0;
+      UINT32 ComponentNum = 0;
+      UINT32 Reserved = 0;
+      UINT64 StringTableOffset = 0;
+      UINT64 StringDataOffset = 0;
+      UINT64 EntityTableOffset = 0;
+      UINT64 ComponentTableOffset = 0;
+      UINT64 PayloadOffset = 0;
+      UINT64 TotalSize = 0;
+   };
+
+   /** UTF-8 string in string data; Strings are deduplicated. */
+   struct WorldArchiveString
+   {
+      UINT32 Offset = 0;
+      UINT32 Length = 0;
+   };
+
+   struct WorldArchiveEntity
+   {
+      UINT32 Name = WORLD_ARCHIVE_NULL_INDEX;
+      UINT32 Tag = WORLD_ARCHIVE_NULL_INDEX;
+      UINT32 Parent = WORLD_ARCHIVE_NULL_INDEX;
+      UINT32 bIsActivated = 1;
+      /** Local transform */
+      float Position[3] = { 0.0f, 0.0f, 0.0f };
+      float Scale[3] = { 1.0f, 1.0f, 1.0f };
+      /** w, x, y, z */
+      float Rotation[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+      UINT32 FirstComponent = 0;
+      UINT32 ComponentNum = 0;
+   };
+
+   /** Component properties are stored as CBOR payload, so component types keep their own (de)serialization. */
+   struct WorldArchiveComponent
+   {
+      UINT32 Type = WORLD_ARCHIVE_NULL_INDEX;
+      UINT32 PayloadSize = 0;
+      UINT64 PayloadOffset = 0;
+   };
+
+   /**
+    * @brief   Read only view of binary world archive in memory. (ex. Memory mapped file)
+    *          It does not own or copy data, so data must outlive the view.
+    */
+   class MEAPI WorldArchiveView
+   {
+   public:
+      WorldArchiveView(const void* data, size_t size);
+
+      /** Magic, version and every table range have been validated. */
+      bool IsValid() const { return (m_header != nullptr); }
+
+      size_t GetEntitiesNum() const { return IsValid() ? m_header->EntityNum : 0; }
+      const WorldArchiveEntity& GetEntity(size_t idx) const { return m_entities[idx]; }
+
+      size_t GetComponentsNum() const { return IsValid() ? m_header->ComponentNum : 0; }
+      const WorldArchiveComponent& GetComponent(size_t idx) const { return m_components[idx]; }
+
+      std::string_view GetString(UINT32 idx) const;
+      json GetComponentData(const WorldArchiveComponent& component) const;
+
+      /** Export archive as JSON which has same layout with World::Serialize. (For tooling) */
+      json ToJson() const;
+
+      static bool IsWorldArchive(const void* data, size_t size);
+
+   private:
+      json EntityToJson(size_t idx, const std::vector<std::vector<UINT32>>& children) const;
+
+   private:
+      const UINT8* m_data;
+      size_t m_size;
+      const WorldArchiveHeader* m_header;
+      const WorldArchiveString* m_strings;
+      const WorldArchiveEntity* m_entities;
+      const WorldArchiveComponent* m_components;
+
+   };
+
+   /**
+    * @brief   Build binary world archive from live entities or JSON serialized entities. (For tooling)
+    */
+   class MEAPI WorldArchiveWriter
+   {
+   public:
+      /** Add entity with its every descendant. Entities which serialization is disabled are skipped. */
+      void AddEntity(const Entity* entity);
+
+      /** Import entity hierarchy which is serialized as JSON by Entity::Serialize. */
+      void AddEntity(const json& serializedEntity);
+
+      /** Import every root entities from JSON serialized by World::Serialize. */
+      void AddWorld(const json& serializedWorld);
+
+      std::vector<UINT8> Build() const;
+
+   private:
+      void AddEntity(const Entity* entity, UINT32 parent);
+      void AddEntity(const json& serializedEntity, UINT32 parent);
+      void AddComponent(const json& serializedComponent);
+      UINT32 AddString(const std::string& str);
+
+   private:
+      std::vector<std::string> m_strings;
+      std::unordered_map<std::string, UINT32> m_stringIndices;
+      std::vector<WorldArchiveEntity> m_entities;
+      std::vector<WorldArchiveComponent> m_components;
+      std::vector<UINT8> m_payloads;
+
+   };
+}
\ No newline at end of file
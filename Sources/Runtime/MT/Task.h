@@ -0,0 +1,205 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+
+namespace Mile
+{
+   constexpr size_t TASK_INLINE_STORAGE_SIZE = 96;
+
+   /**
+    * @brief   Move only type-erased callable. Callables that fit in TASK_INLINE_STORAGE_SIZE bytes are stored inline
+    *          so that scheduling a task does not need any heap allocation. Bigger callables fall back to heap.
+    */
+   class MEAPI Task
+   {
+      enum class EOperation
+      {
+         Move,
+         Destroy
+      };
+
+      using InvokeFunc = void(*)(void*);
+      using ManageFunc = void(*)(EOperation, void*, void*);
+
+   public:
+      Task() :
+         m_invoke(nullptr),
+         m_manage(nullptr)
+      {
+      }
+
+      template <typename FUNC,
+         std::enable_if_t<!std::is_same_v<std::decay_t<FUNC>, Task>, bool> = true>
+      Task(FUNC&& func) :
+         Task()
+      {
+         Assign(std::forward<FUNC>(func));
+      }
+
+      Task(Task&& other) noexcept :
+         Task()
+      {
+         MoveFrom(other);
+      }
+
+      Task& operator=(Task&& other) noexcept
+      {
+         if (this != &other)
+         {
+            Reset();
+            MoveFrom(other);
+         }
+
+         return (*this);
+      }
+
+      Task(const Task&) = delete;
+      Task& operator=(const Task&) = delete;
+
+      ~Task()
+      {
+         Reset();
+      }
+
+      template <typename FUNC>
+      void Assign(FUNC&& func)
+      {
+         using FuncType = std::decay_t<FUNC>;
+         Reset();
+
+         if constexpr (IsStoredInline<FuncType>())
+         {
+            new (m_storage) FuncType(std::forward<FUNC>(func));
+            m_invoke = [](void* storage)
+            {
+               (*reinterpret_cast<FuncType*>(storage))();
+            };
+            m_manage = [](EOperation op, void* dest, void* src)
+            {
+               FuncType* srcFunc = reinterpret_cast<FuncType*>(src);
+               if (op == EOperation::Move)
+               {
+                  new (dest) FuncType(std::move(*srcFunc));
+               }
+               srcFunc->~FuncType();
+            };
+         }
+         else
+         {
+            FuncType* heapFunc = new FuncType(std::forward<FUNC>(func));
+            std::memcpy(m_storage, &heapFunc, sizeof(FuncType*));
+            m_invoke = [](void* storage)
+            {
+               FuncType* target = nullptr;
+               std::memcpy(&target, storage, sizeof(FuncType*));
+               (*target)();
+            };
+            m_manage = [](EOperation op, void* dest, void* src)
+            {
+               if (op == EOperation::Move)
+               {
+                  std::memcpy(dest, src, sizeof(FuncType*));
+               }
+               else
+               {
+                  FuncType* target = nullptr;
+                  std::memcpy(&target, src, sizeof(FuncType*));
+                  delete target;
+               }
+            };
+         }
+      }
+
+      void Reset()
+      {
+         if (m_manage != nullptr)
+         {
+            m_manage(EOperation::Destroy, nullptr, m_storage);
+         }
+
+         m_invoke = nullptr;
+         m_manage = nullptr;
+      }
+
+      void operator()()
+      {
+         m_invoke(m_storage);
+      }
+
+      bool IsValid() const { return (m_invoke != nullptr); }
+      explicit operator bool() const { return IsValid(); }
+
+      template <typename FUNC>
+      static constexpr bool IsStoredInline()
+      {
+         return (sizeof(FUNC) <= TASK_INLINE_STORAGE_SIZE) &&
+            (alignof(FUNC) <= alignof(std::max_align_t)) &&
+            std::is_nothrow_move_constructible_v<FUNC>;
+      }
+
+   private:
+      void MoveFrom(Task& other)
+      {
+         if (other.m_manage != nullptr)
+         {
+            other.m_manage(EOperation::Move, m_storage, other.m_storage);
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+            other.m_invoke = nullptr;
+            other.m_manage = nullptr;
+         }
+      }
+
+   private:
+      alignas(std::max_align_t) unsigned char m_storage[TASK_INLINE_STORAGE_SIZE];
+      InvokeFunc m_invoke;
+      ManageFunc m_manage;
+
+   };
+
+   class ThreadPool;
+   /**
+    * @brief   Counter based group of tasks. Waiting on a group lets the waiting thread execute pending tasks
+    *          instead of blocking, so it is safe to wait from worker threads as well.
+    *          The first exception thrown by a task of group is captured and rethrown from Wait.
+    */
+   class MEAPI TaskGroup
+   {
+   public:
+      TaskGroup(ThreadPool& threadPool) :
+         m_threadPool(threadPool),
+         m_pendingTasks(0),
+         m_exception(nullptr)
+      {
+      }
+
+      /** Exception which has not been rethrown by Wait is discarded. */
+      ~TaskGroup()
+      {
+         WaitForTasks();
+      }
+
+      TaskGroup(const TaskGroup&) = delete;
+      TaskGroup& operator=(const TaskGroup&) = delete;
+
+      template <typename FUNC>
+      void Run(FUNC&& func);
+
+      void Wait();
+
+      bool IsDone() const { return (m_pendingTasks.load(std::memory_order_acquire) == 0); }
+
+   private:
+      void WaitForTasks();
+      void CaptureException(std::exception_ptr exception);
+
+   private:
+      ThreadPool& m_threadPool;
+      std::atomic<size_t> m_pendingTasks;
+
+      std::mutex m_exceptionMutex;
+      std::exception_ptr m_exception;
+
+      friend ThreadPool;
+
+   };
+}
\ No newline at end of file
@@ -1,6 +1,421 @@
 #include "MT/ThreadPool.h"
+#include "MT/WorkStealingQueue.h"
 
 namespace Mile
 {
    DEFINE_LOG_CATEGORY(MileThreadPool);
+
+   constexpr size_t INVALID_WORKER_INDEX = std::numeric_limits<size_t>::max();
+   constexpr size_t TASK_ENTRY_ALLOC_PROBES = 8;
+
+   struct TaskEntry
+   {
+      Task Func;
+      std::atomic<bool> bInUse{ false };
+      bool bHeapAllocated = false;
+   };
+
+   struct TaskWorkerQueue
+   {
+      WorkStealingQueue<TaskEntry*, TASK_QUEUE_CAPACITY> Queue;
+      /** Ring of task entries; only owner worker allocates from it. */
+      std::array<TaskEntry, TASK_QUEUE_CAPACITY> Entries;
+      size_t AllocCursor = 0;
+      UINT32 RandomState = 0;
+   };
+
+   /** Index of worker which is running on current thread. (INVALID_WORKER_INDEX if current thread is not a worker) */
+   static thread_local ThreadPool* CurrentPool = nullptr;
+   static thread_local size_t CurrentWorkerIdx = INVALID_WORKER_INDEX;
+
+   static UINT32 NextRandom(UINT32& state)
+   {
+      /** xorshift32 */
+      state ^= (state << 13);
+      state ^= (state >> 17);
+      state ^= (state << 5);
+      return state;
+   }
+
+   ThreadPool::ThreadPool(Context* context, size_t numberOfThreads) :
+      m_threadNum(numberOfThreads),
+      m_bStop(false),
+      m_pendingTasks(0),
+      m_sleepingWorkers(0),
+      m_injectedTaskNum(0),
+      SubSystem(context)
+   {
+      m_workerQueues.reserve(m_threadNum);
+      for (size_t idx = 0; idx < m_threadNum; ++idx)
+      {
+         m_workerQueues.push_back(std::make_unique<TaskWorkerQueue>());
+         m_workerQueues[idx]->RandomState = static_cast<UINT32>(idx * 2654435761u) | 1u;
+      }
+   }
+
+   ThreadPool::~ThreadPool()
+   {
+      {
+         std::unique_lock<std::mutex> lock(m_mutex);
+         m_bStop = true;
+      }
+
+      // Wake up all threads to stop thread pool.
+      m_condition.notify_all();
+
+      for (std::thread& worker : m_workers)
+      {
+         // Wait for join all threads.
+         worker.join();
+      }
+
+      DeInit();
+   }
+
+   bool ThreadPool::Init()
+   {
+      Context* context = GetContext();
+      if (SubSystem::Init())
+      {
+         // Thread Pool must init once.
+         // But its able to mark as Deinitialized.
+         m_bStop = false;
+         if (m_workers.empty())
+         {
+            for (size_t idx = 0; idx < m_threadNum; ++idx)
+            {
+               // Actual thread initialize.
+               m_workers.emplace_front([this, idx]
+                  {
+                     std::string threadName = ("Worker");
+                     threadName.append(std::to_string(idx));
+                     OPTICK_THREAD(threadName.c_str());
+                     this->WorkerLoop(idx);
+                  });
+            }
+         }
+
+         ME_LOG(MileThreadPool, Log, TEXT("Thread Pool initialized."));
+         SubSystem::InitSucceed();
+
+         // Workers may waiting for initialization.
+         {
+            std::unique_lock<std::mutex> lock(m_mutex);
+         }
+         m_condition.notify_all();
+         return true;
+      }
+
+      ME_LOG(MileThreadPool, Fatal, TEXT("Failed to initialize Thread Pool."));
+      return false;
+   }
+
+   void ThreadPool::DeInit()
+   {
+      if (IsInitialized())
+      {
+         m_workers.clear();
+         ME_LOG(MileThreadPool, Log, TEXT("Thread Pool deinitialized."));
+         SubSystem::DeInit();
+      }
+   }
+
+   bool ThreadPool::TryExecuteOne()
+   {
+      size_t workerIdx = (CurrentPool == this) ? CurrentWorkerIdx : INVALID_WORKER_INDEX;
+      return ExecuteOne(workerIdx);
+   }
+
+   void ThreadPool::Submit(Task&& task)
+   {
+      m_pendingTasks.fetch_add(1, std::memory_order_seq_cst);
+
+      bool bQueued = false;
+      if (CurrentPool == this && CurrentWorkerIdx != INVALID_WORKER_INDEX)
+      {
+         TaskWorkerQueue& workerQueue = *m_workerQueues[CurrentWorkerIdx];
+         TaskEntry* entry = AllocateEntry(workerQueue);
+         entry->Func = std::move(task);
+         if (workerQueue.Queue.Push(entry))
+         {
+            bQueued = true;
+         }
+         else
+         {
+            /** Local queue is full, fallback to injection queue. */
+            task = std::move(entry->Func);
+            ReleaseEntry(entry);
+         }
+      }
+
+      if (!bQueued)
+      {
+         std::unique_lock<std::mutex> lock(m_injectionMutex);
+         m_injectedTasks.push_back(std::move(task));
+         m_injectedTaskNum.fetch_add(1, std::memory_order_release);
+      }
+
+      WakeUpWorker();
+   }
+
+   void ThreadPool::WakeUpWorker()
+   {
+      if (m_sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+      {
+         /** Acquire lock to make sure that sleeping worker actually waiting on condition variable. */
+         {
+            std::unique_lock<std::mutex> lock(m_mutex);
+         }
+         m_condition.notify_one();
+      }
+   }
+
+   void ThreadPool::WorkerLoop(size_t workerIdx)
+   {
+      CurrentPool = this;
+      CurrentWorkerIdx = workerIdx;
+
+      while (true)
+      {
+         if (ExecuteOne(workerIdx))
+         {
+            continue;
+         }
+
+         if (m_pendingTasks.load(std::memory_order_seq_cst) > 0)
+         {
+            /** Task is on the way to queue. */
+            std::this_thread::yield();
+            continue;
+         }
+
+         std::unique_lock<std::mutex> lock(m_mutex);
+         m_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+         // Waiting for task.
+         m_condition.wait(lock, [this]
+            {
+               return (m_bStop ||
+                  m_pendingTasks.load(std::memory_order_seq_cst) > 0) &&
+                  IsInitialized();
+            });
+         m_sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+
+         if (m_bStop && m_pendingTasks.load(std::memory_order_seq_cst) == 0)
+         {
+            return;
+         }
+      }
+   }
+
+   bool ThreadPool::ExecuteOne(size_t workerIdx)
+   {
+      TaskEntry* entry = nullptr;
+      bool bFound = false;
+      if (workerIdx != INVALID_WORKER_INDEX)
+      {
+         bFound = m_workerQueues[workerIdx]->Queue.Pop(entry);
+      }
+
+      if (!bFound)
+      {
+         if (workerIdx != INVALID_WORKER_INDEX)
+         {
+            bFound = PopInjectedTasks(workerIdx, entry);
+         }
+         else
+         {
+            /** Non-worker thread does not own any entry ring, run task directly. */
+            Task task;
+            if (PopInjectedTask(task))
+            {
+               m_pendingTasks.fetch_sub(1, std::memory_order_seq_cst);
+               task();
+               return true;
+            }
+         }
+      }
+
+      if (!bFound)
+      {
+         bFound = StealTask(workerIdx, entry);
+      }
+
+      if (bFound)
+      {
+         m_pendingTasks.fetch_sub(1, std::memory_order_seq_cst);
+         RunEntry(entry);
+      }
+
+      return bFound;
+   }
+
+   bool ThreadPool::PopInjectedTasks(size_t workerIdx, TaskEntry*& out)
+   {
+      if (m_injectedTaskNum.load(std::memory_order_acquire) == 0)
+      {
+         return false;
+      }
+
+      std::unique_lock<std::mutex> lock(m_injectionMutex);
+      if (m_injectedTasks.empty())
+      {
+         return false;
+      }
+
+      /** Move batch of tasks to local queue, to spread out injected tasks between workers. */
+      TaskWorkerQueue& workerQueue = *m_workerQueues[workerIdx];
+      size_t batchSize = std::min(
+         std::max<size_t>(m_injectedTasks.size() / (m_threadNum + 1), 1),
+         TASK_INJECTION_BATCH_SIZE);
+
+      out = AllocateEntry(workerQueue);
+      out->Func = std::move(m_injectedTasks.front());
+      m_injectedTasks.pop_front();
+
+      size_t movedNum = 1;
+      for (; movedNum < batchSize; ++movedNum)
+      {
+         TaskEntry* entry = AllocateEntry(workerQueue);
+         entry->Func = std::move(m_injectedTasks.front());
+         if (!workerQueue.Queue.Push(entry))
+         {
+            m_injectedTasks.front() = std::move(entry->Func);
+            ReleaseEntry(entry);
+            break;
+         }
+
+         m_injectedTasks.pop_front();
+      }
+
+      m_injectedTaskNum.fetch_sub(movedNum, std::memory_order_release);
+      lock.unlock();
+
+      if (movedNum > 1)
+      {
+         /** Other workers can steal moved tasks. */
+         WakeUpWorker();
+      }
+
+      return true;
+   }
+
+   bool ThreadPool::PopInjectedTask(Task& out)
+   {
+      if (m_injectedTaskNum.load(std::memory_order_acquire) == 0)
+      {
+         return false;
+      }
+
+      std::unique_lock<std::mutex> lock(m_injectionMutex);
+      if (m_injectedTasks.empty())
+      {
+         return false;
+      }
+
+      out = std::move(m_injectedTasks.front());
+      m_injectedTasks.pop_front();
+      m_injectedTaskNum.fetch_sub(1, std::memory_order_release);
+      return true;
+   }
+
+   bool ThreadPool::StealTask(size_t workerIdx, TaskEntry*& out)
+   {
+      size_t queueNum = m_workerQueues.size();
+      if (queueNum == 0)
+      {
+         return false;
+      }
+
+      size_t startIdx = 0;
+      if (workerIdx != INVALID_WORKER_INDEX)
+      {
+         startIdx = NextRandom(m_workerQueues[workerIdx]->RandomState) % queueNum;
+      }
+
+      for (size_t offset = 0; offset < queueNum; ++offset)
+      {
+         size_t victimIdx = (startIdx + offset) % queueNum;
+         if (victimIdx != workerIdx && m_workerQueues[victimIdx]->Queue.Steal(out))
+         {
+            return true;
+         }
+      }
+
+      return false;
+   }
+
+   TaskEntry* ThreadPool::AllocateEntry(TaskWorkerQueue& queue)
+   {
+      for (size_t probe = 0; probe < TASK_ENTRY_ALLOC_PROBES; ++probe)
+      {
+         TaskEntry& entry = queue.Entries[queue.AllocCursor];
+         queue.AllocCursor = (queue.AllocCursor + 1) & (TASK_QUEUE_CAPACITY - 1);
+         if (!entry.bInUse.load(std::memory_order_acquire))
+         {
+            entry.bInUse.store(true, std::memory_order_relaxed);
+            return &entry;
+         }
+      }
+
+      /** Ring is crowded by long running tasks. */
+      TaskEntry* entry = new TaskEntry();
+      entry->bHeapAllocated = true;
+      entry->bInUse = true;
+      return entry;
+   }
+
+   void ThreadPool::ReleaseEntry(TaskEntry* entry)
+   {
+      entry->Func.Reset();
+      if (entry->bHeapAllocated)
+      {
+         delete entry;
+      }
+      else
+      {
+         entry->bInUse.store(false, std::memory_order_release);
+      }
+   }
+
+   void ThreadPool::RunEntry(TaskEntry* entry)
+   {
+      entry->Func();
+      ReleaseEntry(entry);
+   }
+
+   void TaskGroup::Wait()
+   {
+      WaitForTasks();
+
+      std::exception_ptr exception = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(m_exceptionMutex);
+         std::swap(exception, m_exception);
+      }
+
+      if (exception != nullptr)
+      {
+         std::rethrow_exception(exception);
+      }
+   }
+
+   void TaskGroup::WaitForTasks()
+   {
+      while (!IsDone())
+      {
+         if (!m_threadPool.TryExecuteOne())
+         {
+            std::this_thread::yield();
+         }
+      }
+   }
+
+   void TaskGroup::CaptureException(std::exception_ptr exception)
+   {
+      std::lock_guard<std::mutex> lock(m_exceptionMutex);
+      if (m_exception == nullptr)
+      {
+         m_exception = exception;
+      }
+   }
 }
\ No newline at end of file
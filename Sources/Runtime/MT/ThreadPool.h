@@ -1,151 +1,164 @@
 #pragma once
 #include "Core/Logger.h"
+#include "MT/Task.h"
 
 namespace Mile
 {
    DECLARE_LOG_CATEGORY_EXTERN(MileThreadPool, ELogVerbosity::Log);
 
+   constexpr size_t TASK_QUEUE_CAPACITY = 1024;
+   constexpr size_t TASK_INJECTION_BATCH_SIZE = 32;
+
+   struct TaskEntry;
+   struct TaskWorkerQueue;
+
+   /**
+    * @brief   Work stealing thread pool.
+    *          Every worker owns a lock-free deque. Tasks added from worker threads go to its own deque,
+    *          tasks added from other threads(ex. main thread) go to the injection queue and workers grab them in batch.
+    *          Idle workers steal from other workers before going to sleep.
+    */
    // Default ThreadPool size : ( Physical Core + Logical Core ) - 1
    class MEAPI ThreadPool : public SubSystem
    {
    public:
-      ThreadPool(Context* context, size_t numberOfThreads) :
-         m_threadNum(numberOfThreads),
-         m_bStop(false),
-         SubSystem(context)
-      {
-      }
-
+      ThreadPool(Context* context, size_t numberOfThreads);
       ThreadPool(Context* context) :
          ThreadPool(context, std::thread::hardware_concurrency() - 1)
       {
       }
 
-      ~ThreadPool()
-      {
-         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_bStop = true;
-         }
+      ~ThreadPool();
 
-         // Wake up all threads to stop thread pool.
-         m_condition.notify_all();
+      virtual bool Init() override;
+      virtual void DeInit() override;
 
-         for (std::thread& worker : m_workers)
+      template <typename FUNC, typename... Args>
+      auto AddTask(FUNC&& func, Args&& ... args)
+      {
+         using return_type = typename std::result_of<FUNC(Args...)>::type;
+
+         if (m_bStop.load(std::memory_order_acquire))
          {
-            // Wait for join all threads.
-            worker.join();
+            throw std::runtime_error("Add on stopped Thread Pool!");
          }
 
-         DeInit();
-      }
-
-      virtual bool Init() override
-      {
-         Context* context = GetContext();
-         if (SubSystem::Init())
+         std::promise<return_type> promise;
+         std::future<return_type> result = promise.get_future();
+         Submit(Task(
+            [promise = std::move(promise),
+            boundFunc = std::bind(std::forward<FUNC>(func), std::forward<Args>(args)...)]() mutable
          {
-            // Thread Pool must init once.
-            // But its able to mark as Deinitialized.
-            m_bStop = false;
-            if (m_workers.empty())
+            try
             {
-               for (size_t idx = 0; idx < m_threadNum; ++idx)
+               if constexpr (std::is_void_v<return_type>)
+               {
+                  boundFunc();
+                  promise.set_value();
+               }
+               else
                {
-                  // Actual thread initialize.
-                  m_workers.emplace_front([this, idx]
-                     {
-                        std::string threadName = ("Worker");
-                        threadName.append(std::to_string(idx));
-                        OPTICK_THREAD(threadName.c_str());
-                        while (true)
-                        {
-                           std::function<void()> task;
-
-                           // Mutex Scope
-                           {
-                              std::unique_lock<std::mutex> lock(this->m_mutex);
-
-                              // Waiting for task.
-                              this->m_condition.wait(lock, [this]
-                                 {
-                                    return (this->m_bStop ||
-                                       !this->m_tasks.empty()) &&
-                                       this->IsInitialized();
-                                 });
-
-                              if (this->m_bStop && this->m_tasks.empty())
-                              {
-                                 return;
-                              }
-
-                              task = std::move(this->m_tasks.front());
-                              this->m_tasks.pop();
-                           }
-
-                           // Running task in thread!
-                           task();
-                        }
-                     });
+                  promise.set_value(boundFunc());
                }
             }
+            catch (...)
+            {
+               promise.set_exception(std::current_exception());
+            }
+         }));
 
-            ME_LOG(MileThreadPool, Log, TEXT("Thread Pool initialized."));
-            SubSystem::InitSucceed();
-            return true;
-         }
-
-         ME_LOG(MileThreadPool, Fatal, TEXT("Failed to initialize Thread Pool."));
-         return false;
+         return result;
       }
 
-      virtual void DeInit() override
+      /**
+       * @brief   Split [first, last) into chunks and run func(chunkBegin, chunkEnd) on thread pool.
+       *          Calling thread also executes chunks until every chunk has been done.
+       * @param   grainSize   Number of elements per chunk. If it is 0, it will be decided by number of threads.
+       */
+      template <typename FUNC>
+      void ParallelFor(size_t first, size_t last, FUNC&& func, size_t grainSize = 0)
       {
-         if (IsInitialized())
+         if (first >= last)
          {
-            m_workers.clear();
-            ME_LOG(MileThreadPool, Log, TEXT("Thread Pool deinitialized."));
-            SubSystem::DeInit();
+            return;
          }
-      }
 
-      template <typename FUNC, typename... Args>
-      auto AddTask(FUNC&& func, Args&& ... args)
-      {
-         using return_type = typename std::result_of<FUNC(Args...)>::type;
-
-         auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(
-               std::forward<FUNC>(func),
-               std::forward<Args>(args)...));
-
-         std::future<return_type> result = task->get_future();
+         size_t count = last - first;
+         if (grainSize == 0)
          {
-            std::unique_lock<std::mutex> lock(m_mutex);
-
-            if (m_bStop)
-            {
-               throw std::runtime_error("Add on stopped Thread Pool!");
-            }
+            grainSize = std::max<size_t>(count / ((m_threadNum + 1) * 4), 1);
+         }
 
-            m_tasks.emplace([task] { (*task)(); });
+         TaskGroup group(*this);
+         for (size_t chunkBegin = first; chunkBegin < last; chunkBegin += grainSize)
+         {
+            size_t chunkEnd = std::min(chunkBegin + grainSize, last);
+            group.Run([&func, chunkBegin, chunkEnd]()
+               {
+                  func(chunkBegin, chunkEnd);
+               });
          }
 
-         // Wake up one thread in pool.
-         m_condition.notify_one();
-         return result;
+         group.Wait();
       }
 
+      /** Execute one of pending tasks on calling thread. @return false if there was no task to execute. */
+      bool TryExecuteOne();
+
       size_t GetThreads() const { return m_threadNum; }
 
+   private:
+      void Submit(Task&& task);
+      bool ExecuteOne(size_t workerIdx);
+      void WorkerLoop(size_t workerIdx);
+      void WakeUpWorker();
+
+      TaskEntry* AllocateEntry(TaskWorkerQueue& queue);
+      void ReleaseEntry(TaskEntry* entry);
+      void RunEntry(TaskEntry* entry);
+
+      bool PopInjectedTasks(size_t workerIdx, TaskEntry*& out);
+      bool PopInjectedTask(Task& out);
+      bool StealTask(size_t workerIdx, TaskEntry*& out);
+
    private:
       size_t      m_threadNum;
-      bool        m_bStop;
+      std::atomic<bool> m_bStop;
 
       std::mutex                     m_mutex;
       std::condition_variable        m_condition;
       std::forward_list<std::thread> m_workers;
-      std::queue<std::function<void()>> m_tasks;
+      std::vector<std::unique_ptr<TaskWorkerQueue>> m_workerQueues;
+
+      /** Queued but not yet dequeued tasks. */
+      std::atomic<size_t> m_pendingTasks;
+      std::atomic<size_t> m_sleepingWorkers;
+
+      std::mutex                     m_injectionMutex;
+      std::deque<Task>               m_injectedTasks;
+      std::atomic<size_t>            m_injectedTaskNum;
+
+      friend TaskGroup;
 
    };
+
+   template <typename FUNC>
+   void TaskGroup::Run(FUNC&& func)
+   {
+      m_pendingTasks.fetch_add(1, std::memory_order_acq_rel);
+      m_threadPool.Submit(Task(
+         [this, groupFunc = std::forward<FUNC>(func)]() mutable
+      {
+         try
+         {
+            groupFunc();
+         }
+         catch (...)
+         {
+            CaptureException(std::current_exception());
+         }
+
+         m_pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+      }));
+   }
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+
+namespace Mile
+{
+   /**
+    * @brief   Fixed capacity lock-free work stealing deque. (Chase-Lev)
+    *          Only the owner thread may call Push/Pop, any thread may call Steal.
+    *          Owner works on the bottom(LIFO) while thieves take from the top(FIFO).
+    */
+   template <typename Ty, size_t Capacity>
+   class WorkStealingQueue
+   {
+      static_assert(std::is_pointer_v<Ty>, "WorkStealingQueue only stores pointers.");
+      static_assert((Capacity& (Capacity - 1)) == 0, "WorkStealingQueue capacity must be power of two.");
+
+   public:
+      WorkStealingQueue() :
+         m_top(0),
+         m_bottom(0)
+      {
+         for (auto& slot : m_buffer)
+         {
+            slot.store(nullptr, std::memory_order_relaxed);
+         }
+      }
+
+      WorkStealingQueue(const WorkStealingQueue&) = delete;
+      WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+      /** @return false if queue is full. */
+      bool Push(Ty item)
+      {
+         INT64 bottom = m_bottom.load(std::memory_order_relaxed);
+         INT64 top = m_top.load(std::memory_order_acquire);
+         if ((bottom - top) >= static_cast<INT64>(Capacity))
+         {
+            return false;
+         }
+
+         m_buffer[bottom & Mask].store(item, std::memory_order_relaxed);
+         m_bottom.store(bottom + 1, std::memory_order_release);
+         return true;
+      }
+
+      bool Pop(Ty& out)
+      {
+         INT64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+         m_bottom.store(bottom, std::memory_order_relaxed);
+         std::atomic_thread_fence(std::memory_order_seq_cst);
+         INT64 top = m_top.load(std::memory_order_relaxed);
+
+         if (top <= bottom)
+         {
+            out = m_buffer[bottom & Mask].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+               /** Last item; race against thieves. */
+               bool bWon = m_top.compare_exchange_strong(top, top + 1,
+                  std::memory_order_seq_cst, std::memory_order_relaxed);
+               m_bottom.store(bottom + 1, std::memory_order_relaxed);
+               return bWon;
+            }
+
+            return true;
+         }
+
+         m_bottom.store(bottom + 1, std::memory_order_relaxed);
+         return false;
+      }
+
+      bool Steal(Ty& out)
+      {
+         INT64 top = m_top.load(std::memory_order_acquire);
+         std::atomic_thread_fence(std::memory_order_seq_cst);
+         INT64 bottom = m_bottom.load(std::memory_order_acquire);
+
+         if (top < bottom)
+         {
+            Ty item = m_buffer[top & Mask].load(std::memory_order_relaxed);
+            if (m_top.compare_exchange_strong(top, top + 1,
+               std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+               out = item;
+               return true;
+            }
+         }
+
+         return false;
+      }
+
+      bool IsEmpty() const
+      {
+         INT64 bottom = m_bottom.load(std::memory_order_relaxed);
+         INT64 top = m_top.load(std::memory_order_relaxed);
+         return (bottom <= top);
+      }
+
+   private:
+      static constexpr INT64 Mask = static_cast<INT64>(Capacity - 1);
+
+      alignas(64) std::atomic<INT64> m_top;
+      alignas(64) std::atomic<INT64> m_bottom;
+      std::array<std::atomic<Ty>, Capacity> m_buffer;
+
+   };
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#include "Math/Matrix.h"
+
+namespace Mile
+{
+   /** Axis aligned bounding box */
+   struct MEAPI AABB
+   {
+      Vector3 Min = Vector3(FLT_MAX, FLT_MAX, FLT_MAX);
+      Vector3 Max = Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+      bool IsValid() const { return (Min.x <= Max.x) && (Min.y <= Max.y) && (Min.z <= Max.z); }
+
+      Vector3 GetCenter() const { return (Min + Max) * 0.5f; }
+      Vector3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+      void Encapsulate(const Vector3& point)
+      {
+         Min = Vector3(std::min(Min.x, point.x), std::min(Min.y, point.y), std::min(Min.z, point.z));
+         Max = Vector3(std::max(Max.x, point.x), std::max(Max.y, point.y), std::max(Max.z, point.z));
+      }
+
+      /** Bounds of transformed box. (Arvo's method) */
+      AABB Transformed(const Matrix& mat) const
+      {
+         Vector3 center = GetCenter() * mat;
+         Vector3 extents = GetExtents();
+         Vector3 newExtents = Vector3(
+            std::abs(mat.m11) * extents.x + std::abs(mat.m21) * extents.y + std::abs(mat.m31) * extents.z,
+            std::abs(mat.m12) * extents.x + std::abs(mat.m22) * extents.y + std::abs(mat.m32) * extents.z,
+            std::abs(mat.m13) * extents.x + std::abs(mat.m23) * extents.y + std::abs(mat.m33) * extents.z);
+
+         AABB result;
+         result.Min = center - newExtents;
+         result.Max = center + newExtents;
+         return result;
+      }
+   };
+
+   struct MEAPI BoundingSphere
+   {
+      Vector3 Center = Vector3(0.0f, 0.0f, 0.0f);
+      float Radius = 0.0f;
+
+      BoundingSphere Transformed(const Matrix& mat) const
+      {
+         float scaleX = (mat.m11 * mat.m11) + (mat.m12 * mat.m12) + (mat.m13 * mat.m13);
+         float scaleY = (mat.m21 * mat.m21) + (mat.m22 * mat.m22) + (mat.m23 * mat.m23);
+         float scaleZ = (mat.m31 * mat.m31) + (mat.m32 * mat.m32) + (mat.m33 * mat.m33);
+
+         BoundingSphere result;
+         result.Center = Center * mat;
+         result.Radius = Radius * std::sqrt(std::max(scaleX, std::max(scaleY, scaleZ)));
+         return result;
+      }
+   };
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "Math/Frustum.h"
+#include "Math/SIMD.h"
+
+namespace Mile
+{
+   Frustum::Frustum() :
+      Frustum(Matrix::Identity)
+   {
+   }
+
+   Frustum::Frustum(const Matrix& viewProj)
+   {
+      Update(viewProj);
+   }
+
+   void Frustum::Update(const Matrix& viewProj)
+   {
+      const Vector4 column0 = Vector4(viewProj.m11, viewProj.m21, viewProj.m31, viewProj.m41);
+      const Vector4 column1 = Vector4(viewProj.m12, viewProj.m22, viewProj.m32, viewProj.m42);
+      const Vector4 column2 = Vector4(viewProj.m13, viewProj.m23, viewProj.m33, viewProj.m43);
+      const Vector4 column3 = Vector4(viewProj.m14, viewProj.m24, viewProj.m34, viewProj.m44);
+
+      /** Row vector convention; (Clip space z in [0, w]) */
+      const Vector4 planes[PlaneNum] = {
+         column3 + column0,
+         column3 - column0,
+         column3 + column1,
+         column3 - column1,
+         column2,
+         column3 - column2
+      };
+
+      for (size_t idx = 0; idx < PaddedPlaneNum; ++idx)
+      {
+         const Vector4& plane = planes[(idx < PlaneNum) ? idx : Left];
+         float length = std::sqrt((plane.x * plane.x) + (plane.y * plane.y) + (plane.z * plane.z));
+         float invLength = (length > 0.0f) ? (1.0f / length) : 0.0f;
+         m_planeX[idx] = plane.x * invLength;
+         m_planeY[idx] = plane.y * invLength;
+         m_planeZ[idx] = plane.z * invLength;
+         m_planeW[idx] = plane.w * invLength;
+      }
+   }
+
+   Vector4 Frustum::GetPlane(EPlane plane) const
+   {
+      return Vector4(m_planeX[plane], m_planeY[plane], m_planeZ[plane], m_planeW[plane]);
+   }
+
+   bool Frustum::Intersects(const AABB& box) const
+   {
+      const Vector3 center = box.GetCenter();
+      const Vector3 extents = box.GetExtents();
+#if defined(ME_MATH_SSE)
+      const __m128 centerX = _mm_set1_ps(center.x);
+      const __m128 centerY = _mm_set1_ps(center.y);
+      const __m128 centerZ = _mm_set1_ps(center.z);
+      const __m128 extentsX = _mm_set1_ps(extents.x);
+      const __m128 extentsY = _mm_set1_ps(extents.y);
+      const __m128 extentsZ = _mm_set1_ps(extents.z);
+      const __m128 signMask = _mm_set1_ps(-0.0f);
+      const __m128 zero = _mm_setzero_ps();
+
+      for (size_t idx = 0; idx < PaddedPlaneNum; idx += 4)
+      {
+         const __m128 planeX = _mm_load_ps(&m_planeX[idx]);
+         const __m128 planeY = _mm_load_ps(&m_planeY[idx]);
+         const __m128 planeZ = _mm_load_ps(&m_planeZ[idx]);
+         const __m128 planeW = _mm_load_ps(&m_planeW[idx]);
+
+         /** Signed distance from plane to center of box */
+         __m128 distance = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(planeX, centerX), _mm_mul_ps(planeY, centerY)),
+            _mm_add_ps(_mm_mul_ps(planeZ, centerZ), planeW));
+
+         /** Projected radius of box onto plane normal */
+         __m128 radius = _mm_add_ps(
+            _mm_add_ps(
+               _mm_mul_ps(_mm_andnot_ps(signMask, planeX), extentsX),
+               _mm_mul_ps(_mm_andnot_ps(signMask, planeY), extentsY)),
+            _mm_mul_ps(_mm_andnot_ps(signMask, planeZ), extentsZ));
+
+         if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), zero)) != 0)
+         {
+            return false;
+         }
+      }
+#else
+      for (size_t idx = 0; idx < PlaneNum; ++idx)
+      {
+         float distance = (m_planeX[idx] * center.x) + (m_planeY[idx] * center.y) + (m_planeZ[idx] * center.z) + m_planeW[idx];
+         float radius = (std::abs(m_planeX[idx]) * extents.x) + (std::abs(m_planeY[idx]) * extents.y) + (std::abs(m_planeZ[idx]) * extents.z);
+         if ((distance + radius) < 0.0f)
+         {
+            return false;
+         }
+      }
+#endif
+
+      return true;
+   }
+
+   bool Frustum::Intersects(const BoundingSphere& sphere) const
+   {
+#if defined(ME_MATH_SSE)
+      const __m128 centerX = _mm_set1_ps(sphere.Center.x);
+      const __m128 centerY = _mm_set1_ps(sphere.Center.y);
+      const __m128 centerZ = _mm_set1_ps(sphere.Center.z);
+      const __m128 radius = _mm_set1_ps(sphere.Radius);
+      const __m128 zero = _mm_setzero_ps();
+
+      for (size_t idx = 0; idx < PaddedPlaneNum; idx += 4)
+      {
+         __m128 distance = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_load_ps(&m_planeX[idx]), centerX), _mm_mul_ps(_mm_load_ps(&m_planeY[idx]), centerY)),
+            _mm_add_ps(_mm_mul_ps(_mm_load_ps(&m_planeZ[idx]), centerZ), _mm_load_ps(&m_planeW[idx])));
+
+         if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), zero)) != 0)
+         {
+            return false;
+         }
+      }
+#else
+      for (size_t idx = 0; idx < PlaneNum; ++idx)
+      {
+         float distance = (m_planeX[idx] * sphere.Center.x) + (m_planeY[idx] * sphere.Center.y) + (m_planeZ[idx] * sphere.Center.z) + m_planeW[idx];
+         if ((distance + sphere.Radius) < 0.0f)
+         {
+            return false;
+         }
+      }
+#endif
+
+      return true;
+   }
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#include "Math/BoundingVolume.h"
+
+namespace Mile
+{
+   /**
+   * @brief   View frustum which is extracted from (View * Projection) matrix.
+   *          Planes are stored as structure of arrays, so that a bounding volume can be tested against four planes at once.
+   */
+   class MEAPI Frustum
+   {
+   public:
+      enum EPlane
+      {
+         Left = 0,
+         Right,
+         Bottom,
+         Top,
+         Near,
+         Far,
+         PlaneNum
+      };
+
+   public:
+      Frustum();
+      Frustum(const Matrix& viewProj);
+
+      void Update(const Matrix& viewProj);
+
+      /** Plane as (Normal, Distance). Normal points inside of frustum. */
+      Vector4 GetPlane(EPlane plane) const;
+
+      bool Intersects(const AABB& box) const;
+      bool Intersects(const BoundingSphere& sphere) const;
+
+   private:
+      /** Two SIMD lanes of four planes; Last two slots are duplicates of Left plane. Scalar fallback only reads first PlaneNum slots. */
+      static constexpr size_t PaddedPlaneNum = 8;
+      alignas(16) float m_planeX[PaddedPlaneNum];
+      alignas(16) float m_planeY[PaddedPlaneNum];
+      alignas(16) float m_planeZ[PaddedPlaneNum];
+      alignas(16) float m_planeW[PaddedPlaneNum];
+
+   };
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Math/Vector4.h"
 #include "Math/Quaternion.h"
+#include "Math/SIMD.h"
 
 namespace Mile
 {
@@ -70,22 +71,9 @@ namespace Mile
 
       Matrix operator*( const Matrix& mat ) const
       {
-         return Matrix( ( m11 * mat.m11 + m12 * mat.m21 + m13 * mat.m31 + m14 * mat.m41 ),
-                        ( m11 * mat.m12 + m12 * mat.m22 + m13 * mat.m32 + m14 * mat.m42 ),
-                        ( m11 * mat.m13 + m12 * mat.m23 + m13 * mat.m33 + m14 * mat.m43 ),
-                        ( m11 * mat.m14 + m12 * mat.m24 + m13 * mat.m34 + m14 * mat.m44 ),
-                        ( m21 * mat.m11 + m22 * mat.m21 + m23 * mat.m31 + m24 * mat.m41 ),
-                        ( m21 * mat.m12 + m22 * mat.m22 + m23 * mat.m32 + m24 * mat.m42 ),
-                        ( m21 * mat.m13 + m22 * mat.m23 + m23 * mat.m33 + m24 * mat.m43 ),
-                        ( m21 * mat.m14 + m22 * mat.m24 + m23 * mat.m34 + m24 * mat.m44 ),
-                        ( m31 * mat.m11 + m32 * mat.m21 + m33 * mat.m31 + m34 * mat.m41 ),
-                        ( m31 * mat.m12 + m32 * mat.m22 + m33 * mat.m32 + m34 * mat.m42 ),
-                        ( m31 * mat.m13 + m32 * mat.m23 + m33 * mat.m33 + m34 * mat.m43 ),
-                        ( m31 * mat.m14 + m32 * mat.m24 + m33 * mat.m34 + m34 * mat.m44 ),
-                        ( m41 * mat.m11 + m42 * mat.m21 + m43 * mat.m31 + m44 * mat.m41 ),
-                        ( m41 * mat.m12 + m42 * mat.m22 + m43 * mat.m32 + m44 * mat.m42 ),
-                        ( m41 * mat.m13 + m42 * mat.m23 + m43 * mat.m33 + m44 * mat.m43 ),
-                        ( m41 * mat.m14 + m42 * mat.m24 + m43 * mat.m34 + m44 * mat.m44 ) );
+         Matrix res{ 0.0f };
+         SIMD::MatrixMultiply( Data( ), mat.Data( ), res.Data( ) );
+         return res;
       }
 
       Matrix operator*( float factor ) const
@@ -98,22 +86,7 @@ namespace Mile
 
       Matrix& operator*=( const Matrix& mat )
       {
-         m11 = ( m11 * mat.m11 + m12 * mat.m21 + m13 * mat.m31 + m14 * mat.m41 );
-         m12 = ( m11 * mat.m12 + m12 * mat.m22 + m13 * mat.m32 + m14 * mat.m42 );
-         m13 = ( m11 * mat.m13 + m12 * mat.m23 + m13 * mat.m33 + m14 * mat.m43 );
-         m14 = ( m11 * mat.m14 + m12 * mat.m24 + m13 * mat.m34 + m14 * mat.m44 );
-         m21 = ( m21 * mat.m11 + m22 * mat.m21 + m23 * mat.m31 + m24 * mat.m41 );
-         m22 = ( m21 * mat.m12 + m22 * mat.m22 + m23 * mat.m32 + m24 * mat.m42 );
-         m23 = ( m21 * mat.m13 + m22 * mat.m23 + m23 * mat.m33 + m24 * mat.m43 );
-         m24 = ( m21 * mat.m14 + m22 * mat.m24 + m23 * mat.m34 + m24 * mat.m44 );
-         m31 = ( m31 * mat.m11 + m32 * mat.m21 + m33 * mat.m31 + m34 * mat.m41 );
-         m32 = ( m31 * mat.m12 + m32 * mat.m22 + m33 * mat.m32 + m34 * mat.m42 );
-         m33 = ( m31 * mat.m13 + m32 * mat.m23 + m33 * mat.m33 + m34 * mat.m43 );
-         m34 = ( m31 * mat.m14 + m32 * mat.m24 + m33 * mat.m34 + m34 * mat.m44 );
-         m41 = ( m41 * mat.m11 + m42 * mat.m21 + m43 * mat.m31 + m44 * mat.m41 );
-         m42 = ( m41 * mat.m12 + m42 * mat.m22 + m43 * mat.m32 + m44 * mat.m42 );
-         m43 = ( m41 * mat.m13 + m42 * mat.m23 + m43 * mat.m33 + m44 * mat.m43 );
-         m44 = ( m41 * mat.m14 + m42 * mat.m24 + m43 * mat.m34 + m44 * mat.m44 );
+         SIMD::MatrixMultiply( Data( ), mat.Data( ), Data( ) );
          return ( *this );
       }
 
@@ -172,26 +145,21 @@ namespace Mile
 
       float Determinant( ) const
       {
-         float res = 0.0f;
-
-         if ( m11 != 0.0f )
-         {
-            res += ( m11 * ( m22 * ( m33 * m44 - m34 * m43 ) - m23 * ( m32 * m44 - m34 * m43 ) + m24 * ( m32 * m43 - m33 * m42 ) ) );
-         }
-         if ( m12 != 0.0f )
-         {
-            res -= ( m12 * ( m21 * ( m33 * m44 - m34 * m43 ) - m23 * ( m31 * m44 - m34 * m41 ) + m24 * ( m31 * m44 - m34 * m41 ) ) );
-         }
-         if ( m13 != 0.0f )
-         {
-            res += ( m13 * ( m21 *( m32 * m44 - m34 * m42 ) - m22 * ( m31 * m44 - m34 * m41 ) + m24 * ( m31 * m42 - m32 * m41 ) ) );
-         }
-         if ( m14 != 0.0f )
-         {
-            res -= ( m14 * ( m21 * ( m32 * m43 - m33 * m42 ) - m22 * ( m31 * m43 - m33 * m41 ) + m23 * ( m21 * m42 - m32 * m41 ) ) );
-         }
+         float s0 = m11 * m22 - m21 * m12;
+         float s1 = m11 * m23 - m21 * m13;
+         float s2 = m11 * m24 - m21 * m14;
+         float s3 = m12 * m23 - m22 * m13;
+         float s4 = m12 * m24 - m22 * m14;
+         float s5 = m13 * m24 - m23 * m14;
 
-         return res;
+         float c5 = m33 * m44 - m43 * m34;
+         float c4 = m32 * m44 - m42 * m34;
+         float c3 = m32 * m43 - m42 * m33;
+         float c2 = m31 * m44 - m41 * m34;
+         float c1 = m31 * m43 - m41 * m33;
+         float c0 = m31 * m42 - m41 * m32;
+
+         return ( s0 * c5 ) - ( s1 * c4 ) + ( s2 * c3 ) + ( s3 * c2 ) - ( s4 * c1 ) + ( s5 * c0 );
       }
 
       Matrix Adjugate( ) const
@@ -219,16 +187,10 @@ namespace Mile
                         b41, b42, b43, b44 );
       }
 
+      /** Singular matrix will not be changed. */
       Matrix& Inverse( )
       {
-         float determinant = Determinant( );
-         if ( determinant == 0.0f )
-         {
-            return ( *this );
-         }
-
-         auto adjugate = Adjugate( );
-         ( *this ) = adjugate * ( 1.0f / determinant );
+         SIMD::MatrixInverse( Data( ), Data( ) );
          return ( *this );
       }
 
@@ -248,11 +210,7 @@ namespace Mile
 
       Matrix& Transpose( )
       {
-         Matrix mat{ ( *this ) };
-         m12 = mat.m21; m13 = mat.m31; m14 = mat.m41;
-         m21 = mat.m12; m23 = mat.m32; m24 = mat.m42;
-         m31 = mat.m13; m32 = mat.m23; m34 = mat.m43;
-         m41 = mat.m14; m42 = mat.m24; m43 = mat.m34;
+         SIMD::MatrixTranspose( Data( ), Data( ) );
          return ( *this );
       }
 
@@ -366,6 +324,9 @@ namespace Mile
             0.0f, 0.0f, -range * nearPlane,  0.0f };
       }
 
+      float* Data( ) { return &m11; }
+      const float* Data( ) const { return &m11; }
+
    public:
       float m11, m12, m13, m14;
       float m21, m22, m23, m24;
@@ -379,10 +340,9 @@ namespace Mile
 
    static Vector4 operator*( const Vector4& vec, const Matrix& mat )
    {
-      return Vector4( vec.x * mat.m11 + vec.y * mat.m21 + vec.z * mat.m31 + vec.w * mat.m41,
-                      vec.x * mat.m12 + vec.y * mat.m22 + vec.z * mat.m32 + vec.w * mat.m42,
-                      vec.x * mat.m13 + vec.y * mat.m23 + vec.z * mat.m33 + vec.w * mat.m43,
-                      vec.x * mat.m14 + vec.y * mat.m24 + vec.z * mat.m34 + vec.w * mat.m44 );
+      Vector4 res;
+      SIMD::VectorTransform( vec.elements, mat.Data( ), res.elements );
+      return res;
    }
 
    static Vector3 operator*( const Vector3& vec, const Matrix& mat )
@@ -1,5 +1,6 @@
 #pragma once
 #include "Math/Vector3.h"
+#include "Math/SIMD.h"
 
 namespace Mile
 {
@@ -85,11 +86,9 @@ namespace Mile
 
       Quaternion operator*( const Quaternion& quat ) const
       {
-         return Quaternion(
-            ( w * quat.w - ( x * quat.x + y * quat.y + z * quat.z ) ),
-            ( x * quat.w + y * quat.z - z * quat.y + w * quat.x ),
-            ( -x * quat.z + y * quat.w + z * quat.x + w * quat.y ),
-            ( x * quat.y - y * quat.x + z * quat.w + w * quat.z ) );
+         Quaternion res;
+         SIMD::QuaternionMultiply( elements, quat.elements, res.elements );
+         return res;
       }
 
       Vector3 operator*( const Vector3& rhs ) const
@@ -103,10 +102,7 @@ namespace Mile
 
       Quaternion& operator*=( const Quaternion& quat )
       {
-         w = ( w * quat.w - ( x*quat.x + y*quat.y + z*quat.z ) );
-         x = ( w * quat.x + quat.w * x ) + ( y * quat.z - z * quat.y );
-         y = ( w * quat.y + quat.w * y ) + ( z * quat.x - x * quat.z );
-         z = ( w * quat.z + quat.w * z ) + ( x * quat.y - y * quat.x );
+         SIMD::QuaternionMultiply( elements, quat.elements, elements );
          return ( *this );
       }
 
@@ -265,6 +261,33 @@ namespace Mile
          return result;
       }
 
+      /** Spherical linear interpolation through shortest arc. */
+      static Quaternion Slerp( const Quaternion& from, const Quaternion& to, float t )
+      {
+         float cosTheta = from.Dot( to );
+         float toFactor = 1.0f;
+         if ( cosTheta < 0.0f )
+         {
+            cosTheta = -cosTheta;
+            toFactor = -1.0f;
+         }
+
+         float fromWeight = 1.0f - t;
+         float toWeight = t;
+         /** Nearly parallel, fallback to linear interpolation to avoid division by zero. */
+         if ( cosTheta < 0.9995f )
+         {
+            float theta = std::acos( cosTheta );
+            float sinThetaInv = 1.0f / std::sin( theta );
+            fromWeight = std::sin( fromWeight * theta ) * sinThetaInv;
+            toWeight = std::sin( toWeight * theta ) * sinThetaInv;
+         }
+
+         Quaternion res;
+         SIMD::Blend4( from.elements, fromWeight, to.elements, toWeight * toFactor, res.elements );
+         return res.Normalize( );
+      }
+
    public:
       union
       {
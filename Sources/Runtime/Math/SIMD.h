@@ -0,0 +1,367 @@
+#pragma once
+#include "Math/MathCore.h"
+#include <cstring>
+
+/**
+* Vector instruction set used by math kernels, selected at compile time.
+* Define ME_MATH_NO_SIMD to force scalar kernels.
+*/
+#if !defined(ME_MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ME_MATH_SSE 1
+#include <emmintrin.h>
+#if defined(__AVX__)
+#define ME_MATH_AVX 1
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Mile
+{
+   /**
+   * @brief    Kernels over raw row-major 4x4 matrices and 4 component vectors.(Row vector convention, v' = v * M)
+   *           Pointers does not need to be aligned. Output may alias inputs.
+   */
+   namespace SIMD
+   {
+#if defined(ME_MATH_SSE)
+      /** ( x * r0 ) + ( y * r1 ) + ( z * r2 ) + ( w * r3 ) */
+      inline __m128 LinearCombine(__m128 vec, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+      {
+         __m128 res = _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+         res = _mm_add_ps(res, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+         res = _mm_add_ps(res, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+         res = _mm_add_ps(res, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+         return res;
+      }
+#endif
+
+      /**
+      * @brief    Scalar kernels. Used when no vector instruction set is available,
+      *           and always compiled as reference of vector kernels.
+      */
+      namespace Scalar
+      {
+         inline void MatrixMultiply(const float* lhs, const float* rhs, float* out)
+         {
+            float res[16];
+            for (int row = 0; row < 4; ++row)
+            {
+               for (int col = 0; col < 4; ++col)
+               {
+                  res[(row * 4) + col] =
+                     lhs[(row * 4) + 0] * rhs[col] +
+                     lhs[(row * 4) + 1] * rhs[4 + col] +
+                     lhs[(row * 4) + 2] * rhs[8 + col] +
+                     lhs[(row * 4) + 3] * rhs[12 + col];
+               }
+            }
+            std::memcpy(out, res, sizeof(res));
+         }
+
+         inline void MatrixTranspose(const float* mat, float* out)
+         {
+            float res[16];
+            for (int row = 0; row < 4; ++row)
+            {
+               for (int col = 0; col < 4; ++col)
+               {
+                  res[(col * 4) + row] = mat[(row * 4) + col];
+               }
+            }
+            std::memcpy(out, res, sizeof(res));
+         }
+
+         /**
+         * @brief    2x2 determinants of upper(s) and lower(c) row pairs.
+         * @return   Determinant of matrix.
+         */
+         inline float MatrixSubDeterminants(const float* mat, float* s, float* c)
+         {
+            s[0] = mat[0] * mat[5] - mat[4] * mat[1];
+            s[1] = mat[0] * mat[6] - mat[4] * mat[2];
+            s[2] = mat[0] * mat[7] - mat[4] * mat[3];
+            s[3] = mat[1] * mat[6] - mat[5] * mat[2];
+            s[4] = mat[1] * mat[7] - mat[5] * mat[3];
+            s[5] = mat[2] * mat[7] - mat[6] * mat[3];
+
+            c[5] = mat[10] * mat[15] - mat[14] * mat[11];
+            c[4] = mat[9] * mat[15] - mat[13] * mat[11];
+            c[3] = mat[9] * mat[14] - mat[13] * mat[10];
+            c[2] = mat[8] * mat[15] - mat[12] * mat[11];
+            c[1] = mat[8] * mat[14] - mat[12] * mat[10];
+            c[0] = mat[8] * mat[13] - mat[12] * mat[9];
+
+            return (s[0] * c[5]) - (s[1] * c[4]) + (s[2] * c[3]) + (s[3] * c[2]) - (s[4] * c[1]) + (s[5] * c[0]);
+         }
+
+         inline bool MatrixInverse(const float* mat, float* out)
+         {
+            float s[6];
+            float c[6];
+            float determinant = MatrixSubDeterminants(mat, s, c);
+            if (determinant == 0.0f)
+            {
+               return false;
+            }
+
+            float invDet = 1.0f / determinant;
+            float res[16] = {
+               (mat[5] * c[5] - mat[6] * c[4] + mat[7] * c[3]) * invDet,
+               (-mat[1] * c[5] + mat[2] * c[4] - mat[3] * c[3]) * invDet,
+               (mat[13] * s[5] - mat[14] * s[4] + mat[15] * s[3]) * invDet,
+               (-mat[9] * s[5] + mat[10] * s[4] - mat[11] * s[3]) * invDet,
+
+               (-mat[4] * c[5] + mat[6] * c[2] - mat[7] * c[1]) * invDet,
+               (mat[0] * c[5] - mat[2] * c[2] + mat[3] * c[1]) * invDet,
+               (-mat[12] * s[5] + mat[14] * s[2] - mat[15] * s[1]) * invDet,
+               (mat[8] * s[5] - mat[10] * s[2] + mat[11] * s[1]) * invDet,
+
+               (mat[4] * c[4] - mat[5] * c[2] + mat[7] * c[0]) * invDet,
+               (-mat[0] * c[4] + mat[1] * c[2] - mat[3] * c[0]) * invDet,
+               (mat[12] * s[4] - mat[13] * s[2] + mat[15] * s[0]) * invDet,
+               (-mat[8] * s[4] + mat[9] * s[2] - mat[11] * s[0]) * invDet,
+
+               (-mat[4] * c[3] + mat[5] * c[1] - mat[6] * c[0]) * invDet,
+               (mat[0] * c[3] - mat[1] * c[1] + mat[2] * c[0]) * invDet,
+               (-mat[12] * s[3] + mat[13] * s[1] - mat[14] * s[0]) * invDet,
+               (mat[8] * s[3] - mat[9] * s[1] + mat[10] * s[0]) * invDet };
+            std::memcpy(out, res, sizeof(res));
+            return true;
+         }
+
+         inline void VectorTransform(const float* vec, const float* mat, float* out)
+         {
+            float res[4];
+            for (int col = 0; col < 4; ++col)
+            {
+               res[col] = vec[0] * mat[col] + vec[1] * mat[4 + col] + vec[2] * mat[8 + col] + vec[3] * mat[12 + col];
+            }
+            std::memcpy(out, res, sizeof(res));
+         }
+
+         inline void TransformPoints(const float* points, size_t count, const float* mat, float* out)
+         {
+            for (size_t idx = 0; idx < count; ++idx)
+            {
+               const float* point = points + (idx * 3);
+               float res[3];
+               for (int col = 0; col < 3; ++col)
+               {
+                  res[col] = point[0] * mat[col] + point[1] * mat[4 + col] + point[2] * mat[8 + col] + mat[12 + col];
+               }
+               std::memcpy(out + (idx * 3), res, sizeof(res));
+            }
+         }
+
+         inline void QuaternionMultiply(const float* lhs, const float* rhs, float* out)
+         {
+            float res[4] = {
+               lhs[3] * rhs[0] + lhs[0] * rhs[3] + lhs[1] * rhs[2] - lhs[2] * rhs[1],
+               lhs[3] * rhs[1] - lhs[0] * rhs[2] + lhs[1] * rhs[3] + lhs[2] * rhs[0],
+               lhs[3] * rhs[2] + lhs[0] * rhs[1] - lhs[1] * rhs[0] + lhs[2] * rhs[3],
+               lhs[3] * rhs[3] - lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2] };
+            std::memcpy(out, res, sizeof(res));
+         }
+
+         inline void Blend4(const float* lhs, float lhsFactor, const float* rhs, float rhsFactor, float* out)
+         {
+            for (int idx = 0; idx < 4; ++idx)
+            {
+               out[idx] = (lhs[idx] * lhsFactor) + (rhs[idx] * rhsFactor);
+            }
+         }
+      }
+
+      inline void MatrixMultiply(const float* lhs, const float* rhs, float* out)
+      {
+#if defined(ME_MATH_AVX)
+         /** Two rows of lhs at once. */
+         __m256 r0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 0));
+         __m256 r1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 4));
+         __m256 r2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 8));
+         __m256 r3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 12));
+         __m256 rows[2];
+         for (int idx = 0; idx < 2; ++idx)
+         {
+            __m256 lhsRows = _mm256_loadu_ps(lhs + (idx * 8));
+            __m256 res = _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+            res = _mm256_add_ps(res, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+            res = _mm256_add_ps(res, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+            res = _mm256_add_ps(res, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+            rows[idx] = res;
+         }
+         _mm256_storeu_ps(out + 0, rows[0]);
+         _mm256_storeu_ps(out + 8, rows[1]);
+#elif defined(ME_MATH_SSE)
+         __m128 r0 = _mm_loadu_ps(rhs + 0);
+         __m128 r1 = _mm_loadu_ps(rhs + 4);
+         __m128 r2 = _mm_loadu_ps(rhs + 8);
+         __m128 r3 = _mm_loadu_ps(rhs + 12);
+         __m128 o0 = LinearCombine(_mm_loadu_ps(lhs + 0), r0, r1, r2, r3);
+         __m128 o1 = LinearCombine(_mm_loadu_ps(lhs + 4), r0, r1, r2, r3);
+         __m128 o2 = LinearCombine(_mm_loadu_ps(lhs + 8), r0, r1, r2, r3);
+         __m128 o3 = LinearCombine(_mm_loadu_ps(lhs + 12), r0, r1, r2, r3);
+         _mm_storeu_ps(out + 0, o0);
+         _mm_storeu_ps(out + 4, o1);
+         _mm_storeu_ps(out + 8, o2);
+         _mm_storeu_ps(out + 12, o3);
+#else
+         Scalar::MatrixMultiply(lhs, rhs, out);
+#endif
+      }
+
+      inline void MatrixTranspose(const float* mat, float* out)
+      {
+#if defined(ME_MATH_SSE)
+         __m128 r0 = _mm_loadu_ps(mat + 0);
+         __m128 r1 = _mm_loadu_ps(mat + 4);
+         __m128 r2 = _mm_loadu_ps(mat + 8);
+         __m128 r3 = _mm_loadu_ps(mat + 12);
+         _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+         _mm_storeu_ps(out + 0, r0);
+         _mm_storeu_ps(out + 4, r1);
+         _mm_storeu_ps(out + 8, r2);
+         _mm_storeu_ps(out + 12, r3);
+#else
+         Scalar::MatrixTranspose(mat, out);
+#endif
+      }
+
+      /**
+      * @brief    General 4x4 inverse by cofactor expansion over 2x2 sub-determinants.
+      * @return   false if matrix is singular. (out will not be written)
+      */
+      inline bool MatrixInverse(const float* mat, float* out)
+      {
+#if defined(ME_MATH_SSE)
+         float s[6];
+         float c[6];
+         float determinant = Scalar::MatrixSubDeterminants(mat, s, c);
+         if (determinant == 0.0f)
+         {
+            return false;
+         }
+
+         /** Columns of adjugate are linear combination of rows with 2x2 determinants. */
+         __m128 r0 = _mm_loadu_ps(mat + 0);
+         __m128 r1 = _mm_loadu_ps(mat + 4);
+         __m128 r2 = _mm_loadu_ps(mat + 8);
+         __m128 r3 = _mm_loadu_ps(mat + 12);
+
+         /** Each lane computes one cofactor of column; (x * cA) - (y * cB) + (z * cC) where x, y, z are permuted row elements. */
+         __m128 r1_1000 = _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(0, 0, 0, 1));
+         __m128 r1_2211 = _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(1, 1, 2, 2));
+         __m128 r1_3332 = _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(2, 3, 3, 3));
+         __m128 r0_1000 = _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(0, 0, 0, 1));
+         __m128 r0_2211 = _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(1, 1, 2, 2));
+         __m128 r0_3332 = _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(2, 3, 3, 3));
+         __m128 r3_1000 = _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(0, 0, 0, 1));
+         __m128 r3_2211 = _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(1, 1, 2, 2));
+         __m128 r3_3332 = _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(2, 3, 3, 3));
+         __m128 r2_1000 = _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(0, 0, 0, 1));
+         __m128 r2_2211 = _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(1, 1, 2, 2));
+         __m128 r2_3332 = _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(2, 3, 3, 3));
+
+         __m128 cA = _mm_setr_ps(c[5], c[5], c[4], c[3]);
+         __m128 cB = _mm_setr_ps(c[4], c[2], c[2], c[1]);
+         __m128 cC = _mm_setr_ps(c[3], c[1], c[0], c[0]);
+         __m128 sA = _mm_setr_ps(s[5], s[5], s[4], s[3]);
+         __m128 sB = _mm_setr_ps(s[4], s[2], s[2], s[1]);
+         __m128 sC = _mm_setr_ps(s[3], s[1], s[0], s[0]);
+
+         const __m128 signPNPN = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+         const __m128 signNPNP = _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+
+         __m128 row0 = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(r1_1000, cA), _mm_mul_ps(r1_3332, cC)), _mm_mul_ps(r1_2211, cB));
+         __m128 row1 = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(r0_1000, cA), _mm_mul_ps(r0_3332, cC)), _mm_mul_ps(r0_2211, cB));
+         __m128 row2 = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(r3_1000, sA), _mm_mul_ps(r3_3332, sC)), _mm_mul_ps(r3_2211, sB));
+         __m128 row3 = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(r2_1000, sA), _mm_mul_ps(r2_3332, sC)), _mm_mul_ps(r2_2211, sB));
+
+         __m128 invDet = _mm_set1_ps(1.0f / determinant);
+         row0 = _mm_mul_ps(_mm_mul_ps(row0, signPNPN), invDet);
+         row1 = _mm_mul_ps(_mm_mul_ps(row1, signNPNP), invDet);
+         row2 = _mm_mul_ps(_mm_mul_ps(row2, signPNPN), invDet);
+         row3 = _mm_mul_ps(_mm_mul_ps(row3, signNPNP), invDet);
+
+         /** Rows above are cofactors of columns; transpose to get inverse. */
+         _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+         _mm_storeu_ps(out + 0, row0);
+         _mm_storeu_ps(out + 4, row1);
+         _mm_storeu_ps(out + 8, row2);
+         _mm_storeu_ps(out + 12, row3);
+         return true;
+#else
+         return Scalar::MatrixInverse(mat, out);
+#endif
+      }
+
+      /** out = vec * mat */
+      inline void VectorTransform(const float* vec, const float* mat, float* out)
+      {
+#if defined(ME_MATH_SSE)
+         __m128 res = LinearCombine(_mm_loadu_ps(vec),
+            _mm_loadu_ps(mat + 0), _mm_loadu_ps(mat + 4), _mm_loadu_ps(mat + 8), _mm_loadu_ps(mat + 12));
+         _mm_storeu_ps(out, res);
+#else
+         Scalar::VectorTransform(vec, mat, out);
+#endif
+      }
+
+      /** Transform 'count' points (x, y, z, 1) by mat. Input and output are tightly packed float3 arrays. */
+      inline void TransformPoints(const float* points, size_t count, const float* mat, float* out)
+      {
+#if defined(ME_MATH_SSE)
+         __m128 r0 = _mm_loadu_ps(mat + 0);
+         __m128 r1 = _mm_loadu_ps(mat + 4);
+         __m128 r2 = _mm_loadu_ps(mat + 8);
+         __m128 r3 = _mm_loadu_ps(mat + 12);
+         for (size_t idx = 0; idx < count; ++idx)
+         {
+            const float* point = points + (idx * 3);
+            __m128 res = _mm_add_ps(r3, _mm_mul_ps(_mm_set1_ps(point[0]), r0));
+            res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(point[1]), r1));
+            res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(point[2]), r2));
+
+            alignas(16) float temp[4];
+            _mm_store_ps(temp, res);
+            std::memcpy(out + (idx * 3), temp, sizeof(float) * 3);
+         }
+#else
+         Scalar::TransformPoints(points, count, mat, out);
+#endif
+      }
+
+      /**
+      * @brief    Hamilton product of quaternions stored as (x, y, z, w).
+      */
+      inline void QuaternionMultiply(const float* lhs, const float* rhs, float* out)
+      {
+#if defined(ME_MATH_SSE)
+         __m128 q1 = _mm_loadu_ps(lhs);
+         __m128 q2 = _mm_loadu_ps(rhs);
+
+         /** x = w1x2 + x1w2 + y1z2 - z1y2, y = w1y2 - x1z2 + y1w2 + z1x2, z = w1z2 + x1y2 - y1x2 + z1w2, w = w1w2 - x1x2 - y1y2 - z1z2 */
+         __m128 res = _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(3, 3, 3, 3)), q2);
+         res = _mm_add_ps(res, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(0, 2, 1, 0)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(0, 3, 3, 3))), _mm_setr_ps(1.0f, 1.0f, 1.0f, -1.0f)));
+         res = _mm_add_ps(res, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(1, 0, 2, 1)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(1, 1, 0, 2))), _mm_setr_ps(1.0f, 1.0f, 1.0f, -1.0f)));
+         res = _mm_sub_ps(res, _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(2, 1, 0, 2)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(2, 0, 2, 1))));
+         _mm_storeu_ps(out, res);
+#else
+         Scalar::QuaternionMultiply(lhs, rhs, out);
+#endif
+      }
+
+      /** out = (lhs * lhsFactor) + (rhs * rhsFactor) */
+      inline void Blend4(const float* lhs, float lhsFactor, const float* rhs, float rhsFactor, float* out)
+      {
+#if defined(ME_MATH_SSE)
+         __m128 res = _mm_add_ps(
+            _mm_mul_ps(_mm_loadu_ps(lhs), _mm_set1_ps(lhsFactor)),
+            _mm_mul_ps(_mm_loadu_ps(rhs), _mm_set1_ps(rhsFactor)));
+         _mm_storeu_ps(out, res);
+#else
+         Scalar::Blend4(lhs, lhsFactor, rhs, rhsFactor, out);
+#endif
+      }
+   }
+}
\ No newline at end of file
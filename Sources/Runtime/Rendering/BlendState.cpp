@@ -50,7 +50,7 @@ namespace Mile
       return true;
    }
 
-   bool BlendState::Bind(ID3D11DeviceContext& deviceContext)
+   bool BlendState::Bind(RenderContext& deviceContext)
    {
       if (IsBindable())
       {
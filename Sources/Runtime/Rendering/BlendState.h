@@ -12,7 +12,7 @@ namespace Mile
       virtual ~BlendState();
 
       bool Init();
-      bool Bind(ID3D11DeviceContext& deviceContext);
+      bool Bind(RenderContext& deviceContext);
 
       void SetRenderTargetBlendState(RenderTargetBlendDesc desc, size_t renderTargetIndex = 0);
       RenderTargetBlendDesc GetRenderTargetBlendState(size_t renderTargetIndex) const { return m_blendDescs[renderTargetIndex]; }
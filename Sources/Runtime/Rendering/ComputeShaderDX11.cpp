@@ -38,7 +38,7 @@ namespace Mile
       return false;
    }
 
-   bool ComputeShaderDX11::Bind(ID3D11DeviceContext& deviceContext)
+   bool ComputeShaderDX11::Bind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -52,7 +52,7 @@ namespace Mile
       return false;
    }
 
-   void ComputeShaderDX11::Unbind(ID3D11DeviceContext& deviceContext)
+   void ComputeShaderDX11::Unbind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
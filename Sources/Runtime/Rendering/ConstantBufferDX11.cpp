@@ -34,7 +34,7 @@ namespace Mile
       return false;
    }
 
-   bool ConstantBufferDX11::Bind(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
+   bool ConstantBufferDX11::Bind(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
    {
       if (RenderObject::IsBindable())
       {
@@ -66,7 +66,7 @@ namespace Mile
       return false;
    }
 
-   void ConstantBufferDX11::Unbind(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType boundShader)
+   void ConstantBufferDX11::Unbind(RenderContext& deviceContext, unsigned int boundSlot, EShaderType boundShader)
    {
       if (RenderObject::IsBindable())
       {
@@ -18,7 +18,7 @@ namespace Mile
       virtual ERenderResourceType GetResourceType() const override { return ERenderResourceType::ConstantBuffer; }
 
       template <typename BufferType>
-      bool Update(ID3D11DeviceContext& deviceContext, BufferType buffer)
+      bool Update(RenderContext& deviceContext, BufferType buffer)
       {
          auto mappedBuffer = Map<BufferType>(deviceContext);
          if (mappedBuffer != nullptr)
@@ -30,8 +30,8 @@ namespace Mile
          return false;
       }
 
-      bool Bind(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader);
-      void Unbind(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType boundShader);
+      bool Bind(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader);
+      void Unbind(RenderContext& deviceContext, unsigned int boundSlot, EShaderType boundShader);
 
    };
 }
\ No newline at end of file
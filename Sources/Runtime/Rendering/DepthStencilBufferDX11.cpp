@@ -79,7 +79,7 @@ namespace Mile
       return false;
    }
 
-   void DepthStencilBufferDX11::Clear(ID3D11DeviceContext& deviceContext, float depth, UINT8 stencil)
+   void DepthStencilBufferDX11::Clear(RenderContext& deviceContext, float depth, UINT8 stencil)
    {
       auto flags = D3D11_CLEAR_DEPTH | (m_bStencilEnabled ? D3D11_CLEAR_STENCIL : 0);
       deviceContext.ClearDepthStencilView(m_depthStencilView, flags, depth, stencil);
@@ -35,7 +35,7 @@ namespace Mile
        */
       bool IsStencilEnabled() const { return m_bStencilEnabled; }
 
-      void Clear(ID3D11DeviceContext& deviceContext, float depth, UINT8 stencil);
+      void Clear(RenderContext& deviceContext, float depth, UINT8 stencil);
 
    private:
       ID3D11DepthStencilView* m_depthStencilView;
@@ -37,7 +37,7 @@ namespace Mile
       return false;
    }
 
-   bool DepthStencilState::Bind(ID3D11DeviceContext& deviceContext)
+   bool DepthStencilState::Bind(RenderContext& deviceContext)
    {
       if (IsBindable())
       {
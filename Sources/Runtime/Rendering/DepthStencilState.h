@@ -11,7 +11,7 @@ namespace Mile
       virtual ~DepthStencilState();
 
       bool Init();
-      bool Bind(ID3D11DeviceContext& deviceContext);
+      bool Bind(RenderContext& deviceContext);
 
       void SetDesc(D3D11_DEPTH_STENCIL_DESC desc) { m_desc = desc; m_bIsDirty = true; }
       D3D11_DEPTH_STENCIL_DESC GetDesc() const { return m_desc; }
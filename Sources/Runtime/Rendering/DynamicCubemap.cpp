@@ -82,7 +82,7 @@ namespace Mile
       return false;
    }
 
-   bool DynamicCubemap::BindRenderTargetView(ID3D11DeviceContext& deviceContext, unsigned int faceIdx, unsigned int mipLevel)
+   bool DynamicCubemap::BindRenderTargetView(RenderContext& deviceContext, unsigned int faceIdx, unsigned int mipLevel)
    {
       if (RenderObject::IsBindable())
       {
@@ -96,7 +96,7 @@ namespace Mile
       return false;
    }
 
-   void DynamicCubemap::UnbindRenderTargetView(ID3D11DeviceContext& deviceContext)
+   void DynamicCubemap::UnbindRenderTargetView(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -104,7 +104,7 @@ namespace Mile
       }
    }
 
-   void DynamicCubemap::Clear(ID3D11DeviceContext& context, unsigned int faceIdx, unsigned int mipLevel, const Vector4& clearColor)
+   void DynamicCubemap::Clear(RenderContext& context, unsigned int faceIdx, unsigned int mipLevel, const Vector4& clearColor)
    {
       if (RenderObject::IsBindable())
       {
@@ -112,7 +112,7 @@ namespace Mile
       }
    }
 
-   void DynamicCubemap::ClearAll(ID3D11DeviceContext& context, const Vector4& clearColor)
+   void DynamicCubemap::ClearAll(RenderContext& context, const Vector4& clearColor)
    {
       for (unsigned int cubeFace = 0; cubeFace < 6; ++cubeFace)
       {
@@ -19,16 +19,16 @@ namespace Mile
       bool Init(unsigned int size);
       virtual ERenderResourceType GetResourceType() const override { return ERenderResourceType::DynamicCubemap; }
 
-      bool BindRenderTargetView(ID3D11DeviceContext& deviceContext, unsigned int faceIdx, unsigned int mipLevel = 0);
+      bool BindRenderTargetView(RenderContext& deviceContext, unsigned int faceIdx, unsigned int mipLevel = 0);
       /* 
       * @warn   Cubemap  Ÿ ε Ǿִ θ  ʰ  unbind մϴ.
       **/
-      void UnbindRenderTargetView(ID3D11DeviceContext& deviceContext);
+      void UnbindRenderTargetView(RenderContext& deviceContext);
 
       unsigned int GetMaxMipLevels() const { return m_maxMipLevels; }
 
-      void Clear(ID3D11DeviceContext& context, unsigned int faceIdx, unsigned int mipLevel, const Vector4& clearColor);
-      void ClearAll(ID3D11DeviceContext& context, const Vector4& clearColor);
+      void Clear(RenderContext& context, unsigned int faceIdx, unsigned int mipLevel, const Vector4& clearColor);
+      void ClearAll(RenderContext& context, const Vector4& clearColor);
 
    private:
       std::array<std::vector<ID3D11RenderTargetView*>, CUBE_FACES> m_rtvs;
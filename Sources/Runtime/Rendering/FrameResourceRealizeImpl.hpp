@@ -34,6 +34,71 @@
 namespace Elaina
 {
    using namespace Mile;
+
+   static void ResolveRenderTargetDescriptor(const RenderTargetDescriptor& descriptor, unsigned int& width, unsigned int& height, EColorFormat& format)
+   {
+      width = descriptor.Width;
+      height = descriptor.Height;
+      format = descriptor.Format;
+
+      if (descriptor.ResolutionReference != nullptr)
+      {
+         if ((*descriptor.ResolutionReference != nullptr))
+         {
+            width = (*descriptor.ResolutionReference)->GetWidth();
+            height = (*descriptor.ResolutionReference)->GetHeight();
+         }
+      }
+
+      if (descriptor.FormatReference != nullptr)
+      {
+         if ((*descriptor.FormatReference != nullptr))
+         {
+            format = (*descriptor.FormatReference)->GetFormat();
+         }
+      }
+   }
+
+   /** @return false if output render target reference is not ready yet. */
+   static bool ResolveGBufferDescriptor(const GBufferDescriptor& desc, unsigned int& width, unsigned int& height)
+   {
+      if (desc.OutputRenderTargetReference == nullptr)
+      {
+         width = desc.Width;
+         height = desc.Height;
+         return true;
+      }
+      else if ((*desc.OutputRenderTargetReference) != nullptr)
+      {
+         width = (*desc.OutputRenderTargetReference)->GetWidth();
+         height = (*desc.OutputRenderTargetReference)->GetHeight();
+         return true;
+      }
+
+      return false;
+   }
+
+   static void ApplyViewportDescriptor(Viewport& viewport, const ViewportDescriptor& desc)
+   {
+      if (desc.OutputRenderTargetReference != nullptr)
+      {
+         if ((*desc.OutputRenderTargetReference) != nullptr)
+         {
+            viewport.SetWidth((float)(*desc.OutputRenderTargetReference)->GetWidth());
+            viewport.SetHeight((float)(*desc.OutputRenderTargetReference)->GetHeight());
+         }
+      }
+      else
+      {
+         viewport.SetWidth(desc.Width);
+         viewport.SetHeight(desc.Height);
+      }
+      viewport.SetMinDepth(desc.MinDepth);
+      viewport.SetMaxDepth(desc.MaxDepth);
+      viewport.SetTopLeftX(desc.TopLeftX);
+      viewport.SetTopLeftY(desc.TopLeftY);
+   }
+
    template<>
    CameraRef* Realize(const CameraRefDescriptor& descriptor)
    {
@@ -98,26 +163,10 @@ namespace Elaina
       }
       else
       {
-         unsigned int targetWidth = descriptor.Width;
-         unsigned int targetHeight = descriptor.Height;
-         EColorFormat targetFormat = descriptor.Format;
-
-         if (descriptor.ResolutionReference != nullptr)
-         {
-            if ((*descriptor.ResolutionReference != nullptr))
-            {
-               targetWidth = (*descriptor.ResolutionReference)->GetWidth();
-               targetHeight = (*descriptor.ResolutionReference)->GetHeight();
-            }
-         }
-
-         if (descriptor.FormatReference != nullptr)
-         {
-            if ((*descriptor.FormatReference != nullptr))
-            {
-               targetFormat = (*descriptor.FormatReference)->GetFormat();
-            }
-         }
+         unsigned int targetWidth = 0;
+         unsigned int targetHeight = 0;
+         EColorFormat targetFormat = EColorFormat::UNKNOWN;
+         ResolveRenderTargetDescriptor(descriptor, targetWidth, targetHeight, targetFormat);
 
          bInitialized = renderTarget->Init(targetWidth, targetHeight, targetFormat, descriptor.DepthStencilBuffer);
       }
@@ -243,21 +292,11 @@ namespace Elaina
    {
       bool bInitialized = false;
       GBuffer* gBuffer = new GBuffer(desc.Renderer);
-      if (desc.OutputRenderTargetReference == nullptr)
-      {
-         if (gBuffer->Init(desc.Width, desc.Height))
-         {
-            bInitialized = true;
-         }
-      }
-      else if ((*desc.OutputRenderTargetReference) != nullptr)
+      unsigned int width = 0;
+      unsigned int height = 0;
+      if (ResolveGBufferDescriptor(desc, width, height))
       {
-         if (gBuffer->Init(
-            (*desc.OutputRenderTargetReference)->GetWidth(),
-            (*desc.OutputRenderTargetReference)->GetHeight()))
-         {
-            bInitialized = true;
-         }
+         bInitialized = gBuffer->Init(width, height);
       }
 
       if (!bInitialized)
@@ -278,23 +317,7 @@ namespace Elaina
    Viewport* Realize(const ViewportDescriptor& desc)
    {
       Viewport* viewport = new Viewport(desc.Renderer);
-      if (desc.OutputRenderTargetReference != nullptr)
-      {
-         if ((*desc.OutputRenderTargetReference) != nullptr)
-         {
-            viewport->SetWidth((float)(*desc.OutputRenderTargetReference)->GetWidth());
-            viewport->SetHeight((float)(*desc.OutputRenderTargetReference)->GetHeight());
-         }
-      }
-      else
-      {
-         viewport->SetWidth(desc.Width);
-         viewport->SetHeight(desc.Height);
-      }
-      viewport->SetMinDepth(desc.MinDepth);
-      viewport->SetMaxDepth(desc.MaxDepth);
-      viewport->SetTopLeftX(desc.TopLeftX);
-      viewport->SetTopLeftY(desc.TopLeftY);
+      ApplyViewportDescriptor(*viewport, desc);
       return viewport;
    }
 
@@ -449,4 +472,352 @@ namespace Elaina
    {
       return new VoidRef(desc.Reference);
    }
+
+   /** Transient resource pooling */
+   template<>
+   struct PoolingTraits<RenderTargetDescriptor, RenderTargetDX11>
+   {
+      static constexpr bool bPoolable = true;
+
+      /** Render target which wraps external render target view can't be shared, so it is deleted right after its last user. */
+      static bool IsPoolable(const RenderTargetDescriptor& desc) { return (desc.RenderTargetView == nullptr); }
+
+      static size_t Hash(const RenderTargetDescriptor& desc)
+      {
+         unsigned int width = 0;
+         unsigned int height = 0;
+         EColorFormat format = EColorFormat::UNKNOWN;
+         ResolveRenderTargetDescriptor(desc, width, height, format);
+
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, width);
+         hash = HashCombine(hash, height);
+         hash = HashCombine(hash, static_cast<size_t>(format));
+         return HashCombine(hash, std::hash<const void*>()(desc.DepthStencilBuffer));
+      }
+
+      static bool IsReusable(const RenderTargetDescriptor& pooledDesc, const RenderTargetDX11& pooled, const RenderTargetDescriptor& desc)
+      {
+         unsigned int width = 0;
+         unsigned int height = 0;
+         EColorFormat format = EColorFormat::UNKNOWN;
+         ResolveRenderTargetDescriptor(desc, width, height, format);
+         return (pooledDesc.Renderer == desc.Renderer) &&
+            (pooledDesc.DepthStencilBuffer == desc.DepthStencilBuffer) &&
+            (pooled.GetWidth() == width) &&
+            (pooled.GetHeight() == height) &&
+            (pooled.GetFormat() == format);
+      }
+
+      static void Recycle(const RenderTargetDescriptor& desc, RenderTargetDX11& actual) { }
+
+      static size_t SizeOf(const RenderTargetDescriptor& desc, const RenderTargetDX11& actual)
+      {
+         return (size_t)actual.GetWidth() * actual.GetHeight() * ColorFormatToBytesPerPixel(actual.GetFormat());
+      }
+   };
+
+   template<>
+   struct PoolingTraits<DepthStencilBufferDescriptor, DepthStencilBufferDX11>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const DepthStencilBufferDescriptor& desc) { return true; }
+
+      static size_t Hash(const DepthStencilBufferDescriptor& desc)
+      {
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, desc.Width);
+         hash = HashCombine(hash, desc.Height);
+         return HashCombine(hash, desc.bStencilEnable);
+      }
+
+      static bool IsReusable(const DepthStencilBufferDescriptor& pooledDesc, const DepthStencilBufferDX11& pooled, const DepthStencilBufferDescriptor& desc)
+      {
+         return (pooledDesc.Renderer == desc.Renderer) &&
+            (pooledDesc.Width == desc.Width) &&
+            (pooledDesc.Height == desc.Height) &&
+            (pooledDesc.bStencilEnable == desc.bStencilEnable);
+      }
+
+      static void Recycle(const DepthStencilBufferDescriptor& desc, DepthStencilBufferDX11& actual) { }
+
+      static size_t SizeOf(const DepthStencilBufferDescriptor& desc, const DepthStencilBufferDX11& actual)
+      {
+         /** D24S8 or D32 */
+         return (size_t)desc.Width * desc.Height * 4;
+      }
+   };
+
+   template<>
+   struct PoolingTraits<GBufferDescriptor, GBuffer>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const GBufferDescriptor& desc) { return true; }
+
+      static size_t Hash(const GBufferDescriptor& desc)
+      {
+         unsigned int width = 0;
+         unsigned int height = 0;
+         ResolveGBufferDescriptor(desc, width, height);
+
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, width);
+         return HashCombine(hash, height);
+      }
+
+      static bool IsReusable(const GBufferDescriptor& pooledDesc, const GBuffer& pooled, const GBufferDescriptor& desc)
+      {
+         unsigned int width = 0;
+         unsigned int height = 0;
+         return ResolveGBufferDescriptor(desc, width, height) &&
+            (pooledDesc.Renderer == desc.Renderer) &&
+            (pooled.GetPositionBuffer()->GetWidth() == width) &&
+            (pooled.GetPositionBuffer()->GetHeight() == height);
+      }
+
+      static void Recycle(const GBufferDescriptor& desc, GBuffer& actual) { }
+
+      static size_t SizeOf(const GBufferDescriptor& desc, const GBuffer& actual)
+      {
+         /** Position(RGBA32F) + 4 * RGBA16F + Depth stencil */
+         size_t pixels = (size_t)actual.GetPositionBuffer()->GetWidth() * actual.GetPositionBuffer()->GetHeight();
+         return pixels * (16 + (4 * 8) + 4);
+      }
+   };
+
+   template<>
+   struct PoolingTraits<ConstantBufferDescriptor, ConstantBufferDX11>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const ConstantBufferDescriptor& desc) { return true; }
+
+      static size_t Hash(const ConstantBufferDescriptor& desc)
+      {
+         return HashCombine(std::hash<const void*>()(desc.Renderer), desc.Size);
+      }
+
+      static bool IsReusable(const ConstantBufferDescriptor& pooledDesc, const ConstantBufferDX11& pooled, const ConstantBufferDescriptor& desc)
+      {
+         return (pooledDesc.Renderer == desc.Renderer) && (pooledDesc.Size == desc.Size);
+      }
+
+      static void Recycle(const ConstantBufferDescriptor& desc, ConstantBufferDX11& actual) { }
+
+      static size_t SizeOf(const ConstantBufferDescriptor& desc, const ConstantBufferDX11& actual)
+      {
+         return desc.Size;
+      }
+   };
+
+   template<>
+   struct PoolingTraits<StructuredBufferDescriptor, StructuredBufferDX11>
+   {
+      static constexpr bool bPoolable = true;
+
+      /** Buffer which has initial data must be created with its data, so it is deleted right after its last user. */
+      static bool IsPoolable(const StructuredBufferDescriptor& desc) { return (desc.Data.pSysMem == nullptr); }
+
+      static size_t Hash(const StructuredBufferDescriptor& desc)
+      {
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, desc.Count);
+         hash = HashCombine(hash, desc.StructSize);
+         hash = HashCombine(hash, desc.bCPUWritable);
+         return HashCombine(hash, desc.bGPUWritable);
+      }
+
+      static bool IsReusable(const StructuredBufferDescriptor& pooledDesc, const StructuredBufferDX11& pooled, const StructuredBufferDescriptor& desc)
+      {
+         return (pooledDesc.Renderer == desc.Renderer) &&
+            (pooledDesc.Count == desc.Count) &&
+            (pooledDesc.StructSize == desc.StructSize) &&
+            (pooledDesc.bCPUWritable == desc.bCPUWritable) &&
+            (pooledDesc.bGPUWritable == desc.bGPUWritable);
+      }
+
+      static void Recycle(const StructuredBufferDescriptor& desc, StructuredBufferDX11& actual) { }
+
+      static size_t SizeOf(const StructuredBufferDescriptor& desc, const StructuredBufferDX11& actual)
+      {
+         return (size_t)desc.Count * desc.StructSize;
+      }
+   };
+
+   template<>
+   struct PoolingTraits<SamplerDescriptor, SamplerDX11>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const SamplerDescriptor& desc) { return true; }
+
+      static size_t Hash(const SamplerDescriptor& desc)
+      {
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, desc.Filter);
+         hash = HashCombine(hash, desc.AddressModeU);
+         hash = HashCombine(hash, desc.AddressModeV);
+         hash = HashCombine(hash, desc.AddressModeW);
+         return HashCombine(hash, desc.CompFunc);
+      }
+
+      static bool IsReusable(const SamplerDescriptor& pooledDesc, const SamplerDX11& pooled, const SamplerDescriptor& desc)
+      {
+         return (pooledDesc.Renderer == desc.Renderer) &&
+            (pooledDesc.Filter == desc.Filter) &&
+            (pooledDesc.AddressModeU == desc.AddressModeU) &&
+            (pooledDesc.AddressModeV == desc.AddressModeV) &&
+            (pooledDesc.AddressModeW == desc.AddressModeW) &&
+            (pooledDesc.CompFunc == desc.CompFunc);
+      }
+
+      static void Recycle(const SamplerDescriptor& desc, SamplerDX11& actual) { }
+
+      static size_t SizeOf(const SamplerDescriptor& desc, const SamplerDX11& actual) { return sizeof(SamplerDX11); }
+   };
+
+   template<>
+   struct PoolingTraits<ViewportDescriptor, Viewport>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const ViewportDescriptor& desc) { return true; }
+
+      static size_t Hash(const ViewportDescriptor& desc)
+      {
+         return std::hash<const void*>()(desc.Renderer);
+      }
+
+      /** Viewport is just a set of values, re-apply descriptor on recycle. */
+      static bool IsReusable(const ViewportDescriptor& pooledDesc, const Viewport& pooled, const ViewportDescriptor& desc)
+      {
+         return (pooledDesc.Renderer == desc.Renderer);
+      }
+
+      static void Recycle(const ViewportDescriptor& desc, Viewport& actual)
+      {
+         ApplyViewportDescriptor(actual, desc);
+      }
+
+      static size_t SizeOf(const ViewportDescriptor& desc, const Viewport& actual) { return sizeof(Viewport); }
+   };
+
+   template<>
+   struct PoolingTraits<RasterizerStateDescriptor, RasterizerState>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const RasterizerStateDescriptor& desc) { return true; }
+
+      static size_t Hash(const RasterizerStateDescriptor& desc)
+      {
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, desc.bIsWireframe);
+         hash = HashCombine(hash, static_cast<size_t>(desc.CullMode));
+         hash = HashCombine(hash, static_cast<size_t>(desc.WindingOrder));
+         return HashCombine(hash, desc.bIsDepthClipEnable);
+      }
+
+      static bool IsReusable(const RasterizerStateDescriptor& pooledDesc, const RasterizerState& pooled, const RasterizerStateDescriptor& desc)
+      {
+         return (pooledDesc.Renderer == desc.Renderer) &&
+            (pooledDesc.bIsWireframe == desc.bIsWireframe) &&
+            (pooledDesc.CullMode == desc.CullMode) &&
+            (pooledDesc.WindingOrder == desc.WindingOrder) &&
+            (pooledDesc.DepthBias == desc.DepthBias) &&
+            (pooledDesc.SlopeScaledDepthBias == desc.SlopeScaledDepthBias) &&
+            (pooledDesc.DepthBiasClamp == desc.DepthBiasClamp) &&
+            (pooledDesc.bIsDepthClipEnable == desc.bIsDepthClipEnable);
+      }
+
+      static void Recycle(const RasterizerStateDescriptor& desc, RasterizerState& actual) { }
+
+      static size_t SizeOf(const RasterizerStateDescriptor& desc, const RasterizerState& actual) { return sizeof(RasterizerState); }
+   };
+
+   static bool IsEqualDepthStencilOpDesc(const D3D11_DEPTH_STENCILOP_DESC& lhs, const D3D11_DEPTH_STENCILOP_DESC& rhs)
+   {
+      return (lhs.StencilFailOp == rhs.StencilFailOp) &&
+         (lhs.StencilDepthFailOp == rhs.StencilDepthFailOp) &&
+         (lhs.StencilPassOp == rhs.StencilPassOp) &&
+         (lhs.StencilFunc == rhs.StencilFunc);
+   }
+
+   template<>
+   struct PoolingTraits<DepthStencilStateDescriptor, DepthStencilState>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const DepthStencilStateDescriptor& desc) { return true; }
+
+      static size_t Hash(const DepthStencilStateDescriptor& desc)
+      {
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, desc.bDepthEnable);
+         hash = HashCombine(hash, desc.DepthWriteMask);
+         hash = HashCombine(hash, desc.DepthFunc);
+         return HashCombine(hash, desc.bStencilEnable);
+      }
+
+      static bool IsReusable(const DepthStencilStateDescriptor& pooledDesc, const DepthStencilState& pooled, const DepthStencilStateDescriptor& desc)
+      {
+         return (pooledDesc.Renderer == desc.Renderer) &&
+            (pooledDesc.bDepthEnable == desc.bDepthEnable) &&
+            (pooledDesc.DepthWriteMask == desc.DepthWriteMask) &&
+            (pooledDesc.DepthFunc == desc.DepthFunc) &&
+            (pooledDesc.bStencilEnable == desc.bStencilEnable) &&
+            (pooledDesc.StencilReadMask == desc.StencilReadMask) &&
+            (pooledDesc.StencilWriteMask == desc.StencilWriteMask) &&
+            IsEqualDepthStencilOpDesc(pooledDesc.FrontFace, desc.FrontFace) &&
+            IsEqualDepthStencilOpDesc(pooledDesc.BackFace, desc.BackFace);
+      }
+
+      static void Recycle(const DepthStencilStateDescriptor& desc, DepthStencilState& actual) { }
+
+      static size_t SizeOf(const DepthStencilStateDescriptor& desc, const DepthStencilState& actual) { return sizeof(DepthStencilState); }
+   };
+
+   template<>
+   struct PoolingTraits<BlendStateDescriptor, BlendState>
+   {
+      static constexpr bool bPoolable = true;
+
+      static bool IsPoolable(const BlendStateDescriptor& desc) { return true; }
+
+      static size_t Hash(const BlendStateDescriptor& desc)
+      {
+         size_t hash = std::hash<const void*>()(desc.Renderer);
+         hash = HashCombine(hash, desc.bAlphaToConverageEnable);
+         hash = HashCombine(hash, desc.bIndependentBlendEnable);
+         return HashCombine(hash, desc.BlendDescs[0].BlendEnable);
+      }
+
+      static bool IsReusable(const BlendStateDescriptor& pooledDesc, const BlendState& pooled, const BlendStateDescriptor& desc)
+      {
+         if ((pooledDesc.Renderer != desc.Renderer) ||
+            (pooledDesc.bAlphaToConverageEnable != desc.bAlphaToConverageEnable) ||
+            (pooledDesc.bIndependentBlendEnable != desc.bIndependentBlendEnable) ||
+            (pooledDesc.BlendFactor != desc.BlendFactor) ||
+            (pooledDesc.SampleMask != desc.SampleMask))
+         {
+            return false;
+         }
+
+         for (size_t idx = 0; idx < MAXIMUM_RENDER_TARGETS; ++idx)
+         {
+            if (pooledDesc.BlendDescs[idx] != desc.BlendDescs[idx])
+            {
+               return false;
+            }
+         }
+
+         return true;
+      }
+
+      static void Recycle(const BlendStateDescriptor& desc, BlendState& actual) { }
+
+      static size_t SizeOf(const BlendStateDescriptor& desc, const BlendState& actual) { return sizeof(BlendState); }
+   };
 }
\ No newline at end of file
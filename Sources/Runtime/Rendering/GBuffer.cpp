@@ -64,7 +64,7 @@ namespace Mile
       return false;
    }
 
-   bool GBuffer::BindRenderTargetView(ID3D11DeviceContext& deviceContext, bool clearRenderTargets, bool clearDepthStencil)
+   bool GBuffer::BindRenderTargetView(RenderContext& deviceContext, bool clearRenderTargets, bool clearDepthStencil)
    {
       if (RenderObject::IsBindable())
       {
@@ -112,7 +112,7 @@ namespace Mile
       return false;
    }
 
-   bool GBuffer::BindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader, bool bBindDepthStencil)
+   bool GBuffer::BindShaderResourceView(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader, bool bBindDepthStencil)
    {
       if (RenderObject::IsBindable())
       {
@@ -142,7 +142,7 @@ namespace Mile
       return false;
    }
 
-   void GBuffer::UnbindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType boundShader, bool bBoundDepthStencil)
+   void GBuffer::UnbindShaderResourceView(RenderContext& deviceContext, unsigned int boundSlot, EShaderType boundShader, bool bBoundDepthStencil)
    {
       if (RenderObject::IsBindable())
       {
@@ -159,7 +159,7 @@ namespace Mile
       }
    }
 
-   /*bool GBuffer::BindDepthBufferWithExternalTarget(ID3D11DeviceContext& deviceContext, RenderTargetDX11* renderTarget, bool clearTarget, bool clearDepthStencil)
+   /*bool GBuffer::BindDepthBufferWithExternalTarget(RenderContext& deviceContext, RenderTargetDX11* renderTarget, bool clearTarget, bool clearDepthStencil)
    {
       bool bValidRenderTarget = renderTarget != nullptr && renderTarget->IsBindable();
       if (RenderObject::IsBindable() && bValidRenderTarget && m_tempRenderTarget == nullptr)
@@ -195,7 +195,7 @@ namespace Mile
       return false;
    }*/
 
-   void GBuffer::UnbindDepthBuffer(ID3D11DeviceContext& deviceContext)
+   void GBuffer::UnbindDepthBuffer(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -207,7 +207,7 @@ namespace Mile
       }
    }
 
-   void GBuffer::UnbindRenderTargetView(ID3D11DeviceContext& deviceContext)
+   void GBuffer::UnbindRenderTargetView(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
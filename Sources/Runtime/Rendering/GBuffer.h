@@ -19,12 +19,12 @@ namespace Mile
 
       DepthStencilBufferDX11* GetDepthStencilBufferDX11() const { return this->m_depthStencilBuffer; }
 
-      bool BindRenderTargetView(ID3D11DeviceContext& deviceContext, bool clearRenderTargets = true, bool clearDepthStencil = true);
-      bool BindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader, bool bBindDepthStencil = false);
-      void UnbindRenderTargetView(ID3D11DeviceContext& deviceContext);
-      void UnbindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType boundShader, bool bBoundDepthStencil = false);
+      bool BindRenderTargetView(RenderContext& deviceContext, bool clearRenderTargets = true, bool clearDepthStencil = true);
+      bool BindShaderResourceView(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader, bool bBindDepthStencil = false);
+      void UnbindRenderTargetView(RenderContext& deviceContext);
+      void UnbindShaderResourceView(RenderContext& deviceContext, unsigned int boundSlot, EShaderType boundShader, bool bBoundDepthStencil = false);
 
-      void UnbindDepthBuffer(ID3D11DeviceContext& deviceContext);
+      void UnbindDepthBuffer(RenderContext& deviceContext);
 
       RenderTargetDX11* GetPositionBuffer() const { return m_positionBuffer; }
       RenderTargetDX11* GetAlbedoBuffer() const { return m_albedoBuffer; }
@@ -1,125 +1,254 @@
 #include "Rendering/GPUProfiler.h"
 #include "Rendering/RendererDX11.h"
+#include "Rendering/GPUTimestampSource.h"
+#include "Core/Engine.h"
+#include "Core/FrameTimeline.h"
 
 namespace Mile
 {
-   std::mutex ScopedDeferredGPUProfile::m_globalMutex;
-
    GPUProfiler::GPUProfiler(RendererDX11* renderer) :
-      m_renderer(renderer),
+      GPUProfiler(std::make_unique<GPUTimestampSourceDX11>(renderer), renderer->GetMaximumThreads())
+   {
+   }
+
+   GPUProfiler::GPUProfiler(std::unique_ptr<GPUTimestampSource> timestampSource, size_t maximumThreads) :
+      m_timestampSource(std::move(timestampSource)),
+      m_currentSlot(0),
+      m_bIsFrameBegan(false),
       m_currentFrame(0),
-      m_queryLatency(30),
+      m_queryLatency(DEFAULT_GPU_PROFILE_QUERY_LATENCY),
+      m_droppedFrames(0),
       m_latestDrawCalls(0),
       m_latestDrawVertices(0),
-      m_latestDrawTriangles(0)
+      m_latestDrawTriangles(0),
+      m_latestDrawInstances(0),
+      m_visibleMeshes(0),
+      m_culledMeshes(0),
+      m_latestVisibleMeshes(0),
+      m_latestCulledMeshes(0)
    {
-      size_t maximumThraeds = m_renderer->GetMaximumThreads() + 1; // Include Main thread
+      size_t maximumThraeds = maximumThreads + 1; // Include Main thread
       m_drawCalls.resize(maximumThraeds);
       m_vertices.resize(maximumThraeds);
       m_triangles.resize(maximumThraeds);
+      m_instances.resize(maximumThraeds);
    }
 
    GPUProfiler::~GPUProfiler()
    {
-      m_profiles.clear();
-      m_profileTimes.clear();
+      m_frames.clear();
+      m_scopes.clear();
    }
 
-   void GPUProfiler::Begin(const std::string& name)
+   GPUProfileScopeID GPUProfiler::RegisterScope(const std::string& name)
    {
-      ID3D11DeviceContext& context = m_renderer->GetImmediateContext();
-      Begin(name, context);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto foundItr = m_scopeIDs.find(name);
+      if (foundItr != m_scopeIDs.end())
+      {
+         return foundItr->second;
+      }
+
+      GPUProfileScopeID scope = static_cast<GPUProfileScopeID>(m_scopes.size());
+      m_scopeIDs.emplace(name, scope);
+      m_scopes.emplace_back();
+      m_scopes.back().Name = name;
+      m_activeQueries.push_back(INVALID_GPU_PROFILE_SCOPE);
+      return scope;
    }
 
-   void GPUProfiler::End(const std::string& name)
+   void GPUProfiler::BeginFrame()
    {
-      ID3D11DeviceContext& context = m_renderer->GetImmediateContext();
-      End(name, context);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      size_t frameSlots = static_cast<size_t>(m_queryLatency) + 1;
+      if (m_frames.size() != frameSlots)
+      {
+         /** Results of pending frames are discarded when latency has been changed. */
+         m_frames.clear();
+         m_frames.resize(frameSlots);
+         m_currentSlot = 0;
+         m_timestampSource->Reserve(frameSlots, DEFAULT_GPU_PROFILE_TIMESTAMPS_PER_FRAME);
+      }
+
+      FrameQueries& frame = m_frames[m_currentSlot];
+      if (frame.bIsPending)
+      {
+         ++m_droppedFrames;
+      }
+
+      frame.bIsPending = false;
+      frame.Queries.clear();
+      FrameTimeline* timeline = Engine::GetFrameTimeline();
+      if (timeline != nullptr)
+      {
+         frame.TimelineFrame = timeline->GetCurrentFrame();
+         frame.TimelineBeginNS = timeline->Now();
+      }
+
+      std::fill(m_activeQueries.begin(), m_activeQueries.end(), INVALID_GPU_PROFILE_SCOPE);
+      m_timestampSource->BeginFrame(m_currentSlot);
+      m_bIsFrameBegan = true;
    }
 
-   void GPUProfiler::Begin(const std::string& name, ID3D11DeviceContext& context, bool bIsDeferred)
+   void GPUProfiler::Begin(GPUProfileScopeID scope, RenderContext* context, bool bIsDeferred)
    {
-      auto& data = m_profiles[name];
-      if (!data.bIsOnQuery)
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_bIsFrameBegan || scope >= m_scopes.size() || m_activeQueries[scope] != INVALID_GPU_PROFILE_SCOPE)
       {
-         ID3D11Device& device = m_renderer->GetDevice();
-         D3D11_QUERY_DESC queryDesc;
-         ZeroMemory(&queryDesc, sizeof(D3D11_QUERY_DESC));
-         queryDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
-         device.CreateQuery(&queryDesc, &data.Disjoint);
-
-         queryDesc.Query = D3D11_QUERY_TIMESTAMP;
-         device.CreateQuery(&queryDesc, &data.Begin);
-         device.CreateQuery(&queryDesc, &data.End);
+         return;
+      }
 
-         if (data.Disjoint != nullptr && data.Begin != nullptr)
-         {
-            context.Begin(data.Disjoint);
-            context.End(data.Begin);
-            data.QueryBeginFrame = m_currentFrame;
-            data.bIsDeferred = bIsDeferred;
-            data.bIsOnQuery = true;
-         }
-         else
+      FrameQueries& frame = m_frames[m_currentSlot];
+      UINT32 beginTimestamp = static_cast<UINT32>(frame.Queries.size() * 2);
+      size_t timestampsPerFrame = m_timestampSource->GetTimestampsPerFrame();
+      if ((beginTimestamp + 2) > timestampsPerFrame)
+      {
+         if (!m_timestampSource->Reserve(m_frames.size(), timestampsPerFrame * 2))
          {
-            data.Reset();
+            return;
          }
       }
+
+      m_activeQueries[scope] = static_cast<UINT32>(frame.Queries.size());
+      frame.Queries.push_back({ scope, beginTimestamp, false });
+      m_scopes[scope].bIsDeferred = bIsDeferred;
+      m_timestampSource->WriteTimestamp(m_currentSlot, beginTimestamp, context);
    }
 
-   void GPUProfiler::End(const std::string& name, ID3D11DeviceContext& context)
+   void GPUProfiler::End(GPUProfileScopeID scope, RenderContext* context)
    {
-      auto& data = m_profiles[name];
-      if (data.bIsOnQuery && data.QueryBeginFrame == m_currentFrame)
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_bIsFrameBegan || scope >= m_scopes.size() || m_activeQueries[scope] == INVALID_GPU_PROFILE_SCOPE)
+      {
+         return;
+      }
+
+      ScopeQuery& query = m_frames[m_currentSlot].Queries[m_activeQueries[scope]];
+      if (!query.bIsEnded)
       {
-         context.End(data.End);
-         context.End(data.Disjoint);
+         m_timestampSource->WriteTimestamp(m_currentSlot, query.BeginTimestamp + 1, context);
+         query.bIsEnded = true;
       }
    }
 
    void GPUProfiler::EndFrame()
    {
       m_latestDrawCalls = std::accumulate<std::vector<UINT64>::iterator, UINT64>(m_drawCalls.begin(), m_drawCalls.end(), 0);
-      m_latestDrawTriangles = std::accumulate<std::vector<UINT64>::iterator, UINT64>(m_vertices.begin(), m_vertices.end(), 0);
-      m_latestDrawVertices = std::accumulate<std::vector<UINT64>::iterator, UINT64>(m_triangles.begin(), m_triangles.end(), 0);
+      m_latestDrawTriangles = std::accumulate<std::vector<UINT64>::iterator, UINT64>(m_triangles.begin(), m_triangles.end(), 0);
+      m_latestDrawVertices = std::accumulate<std::vector<UINT64>::iterator, UINT64>(m_vertices.begin(), m_vertices.end(), 0);
+      m_latestDrawInstances = std::accumulate<std::vector<UINT64>::iterator, UINT64>(m_instances.begin(), m_instances.end(), 0);
       std::fill(m_drawCalls.begin(), m_drawCalls.end(), 0);
       std::fill(m_vertices.begin(), m_vertices.end(), 0);
       std::fill(m_triangles.begin(), m_triangles.end(), 0);
+      std::fill(m_instances.begin(), m_instances.end(), 0);
+      m_latestVisibleMeshes = m_visibleMeshes;
+      m_latestCulledMeshes = m_culledMeshes;
+      m_visibleMeshes = 0;
+      m_culledMeshes = 0;
       ++m_currentFrame;
 
-      ID3D11DeviceContext& context = m_renderer->GetImmediateContext();
-      for (auto dataItr = m_profiles.begin(); dataItr != m_profiles.end(); ++dataItr)
       {
-         auto& data = (*dataItr).second;
-         if (data.bIsOnQuery && (data.QueryBeginFrame + m_queryLatency) < m_currentFrame)
+         std::lock_guard<std::mutex> lock(m_mutex);
+         if (m_bIsFrameBegan)
          {
-            UINT64 beginTime = 0;
-            while (context.GetData(data.Begin, &beginTime, sizeof(UINT64), 0) != S_OK);
-            UINT64 endTime = 0;
-            while (context.GetData(data.End, &endTime, sizeof(UINT64), 0) != S_OK);
-            D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
-            while (context.GetData(data.Disjoint, &disjointData, sizeof(disjointData), 0) != S_OK);
-            
-            if (!disjointData.Disjoint)
-            {
-               data.ElapsedTimeHz = endTime - beginTime;
-
-               double frequency = static_cast<double>(disjointData.Frequency);
-               data.ElapsedTime = ((data.ElapsedTimeHz / frequency) * 1000.0);
-            }
-
-            auto& accData = m_profileTimes[(*dataItr).first];
-            accData.RecentElapsed = data.ElapsedTime;
-            accData.AccumulatedTime += data.ElapsedTime;
-            accData.MaxTime = std::max(accData.MaxTime, data.ElapsedTime);
-            accData.MinTime = std::min(accData.MinTime, data.ElapsedTime);
+            m_timestampSource->EndFrame(m_currentSlot);
+            m_frames[m_currentSlot].bIsPending = true;
+            m_currentSlot = (m_currentSlot + 1) % m_frames.size();
+            m_bIsFrameBegan = false;
+         }
+
+         ResolveFrames();
+      }
+   }
+
+   void GPUProfiler::ResolveFrames()
+   {
+      /** Oldest frame is placed at current slot. */
+      for (size_t offset = 0; offset < m_frames.size(); ++offset)
+      {
+         size_t frameSlot = (m_currentSlot + offset) % m_frames.size();
+         if (m_frames[frameSlot].bIsPending)
+         {
+            ResolveFrame(frameSlot);
+         }
+      }
+   }
+
+   bool GPUProfiler::ResolveFrame(size_t frameSlot)
+   {
+      UINT64 frequency = 0;
+      bool bIsDisjoint = false;
+      if (!m_timestampSource->ReadFrame(frameSlot, frequency, bIsDisjoint))
+      {
+         return false;
+      }
+
+      FrameQueries& frame = m_frames[frameSlot];
+      frame.bIsPending = false;
+      if (bIsDisjoint || frequency == 0)
+      {
+         return true;
+      }
+
+      for (auto& scope : m_scopes)
+      {
+         scope.Times.RecentElapsed = 0.0;
+      }
+
+      m_resolvedTimestamps.assign(frame.Queries.size(), ResolvedTimestamps());
+      for (size_t queryIdx = 0; queryIdx < frame.Queries.size(); ++queryIdx)
+      {
+         const ScopeQuery& query = frame.Queries[queryIdx];
+         UINT64 beginTime = 0;
+         UINT64 endTime = 0;
+         bool bIsReady = query.bIsEnded &&
+            m_timestampSource->ReadTimestamp(frameSlot, query.BeginTimestamp, beginTime) &&
+            m_timestampSource->ReadTimestamp(frameSlot, query.BeginTimestamp + 1, endTime);
+         if (bIsReady && endTime >= beginTime)
+         {
+            m_resolvedTimestamps[queryIdx] = { true, beginTime, endTime };
+            double elapsedTime = (static_cast<double>(endTime - beginTime) / static_cast<double>(frequency)) * 1000.0;
+            auto& accData = m_scopes[query.Scope].Times;
+            accData.RecentElapsed = elapsedTime;
+            accData.AccumulatedTime += elapsedTime;
+            accData.MaxTime = std::max(accData.MaxTime, elapsedTime);
+            accData.MinTime = std::min(accData.MinTime, elapsedTime);
             accData.Samples += 1.0;
             accData.AvgTime = accData.AccumulatedTime / accData.Samples;
-            data.Reset();
          }
-         else if (!data.bIsOnQuery)
+      }
+
+      RecordTimeline(frame, frequency);
+      return true;
+   }
+
+   void GPUProfiler::RecordTimeline(const FrameQueries& frame, UINT64 frequency)
+   {
+      FrameTimeline* timeline = Engine::GetFrameTimeline();
+      if (timeline == nullptr || !timeline->IsEnabled())
+      {
+         return;
+      }
+
+      UINT64 firstTimestamp = std::numeric_limits<UINT64>::max();
+      for (const auto& timestamps : m_resolvedTimestamps)
+      {
+         if (timestamps.bIsReady)
+         {
+            firstTimestamp = std::min(firstTimestamp, timestamps.Begin);
+         }
+      }
+
+      double nanosecondsPerTick = 1000000000.0 / static_cast<double>(frequency);
+      for (size_t queryIdx = 0; queryIdx < frame.Queries.size(); ++queryIdx)
+      {
+         const auto& timestamps = m_resolvedTimestamps[queryIdx];
+         if (timestamps.bIsReady)
          {
-            m_profileTimes[dataItr->first].RecentElapsed = 0.0;
+            long long beginNS = frame.TimelineBeginNS + static_cast<long long>((timestamps.Begin - firstTimestamp) * nanosecondsPerTick);
+            long long endNS = frame.TimelineBeginNS + static_cast<long long>((timestamps.End - firstTimestamp) * nanosecondsPerTick);
+            const GPUProfileScope& scope = m_scopes[frame.Queries[queryIdx].Scope];
+            timeline->RecordGPUEvent(timeline->InternName(scope.Name), frame.TimelineFrame, beginNS, endNS);
          }
       }
    }
@@ -4,6 +4,22 @@
 namespace Mile
 {
    class RendererDX11;
+   class GPUTimestampSource;
+   class FrameTimeline;
+
+   /** Interned name of profile scope. */
+   using GPUProfileScopeID = UINT32;
+   constexpr GPUProfileScopeID INVALID_GPU_PROFILE_SCOPE = 0xffffffff;
+   constexpr size_t DEFAULT_GPU_PROFILE_TIMESTAMPS_PER_FRAME = 64;
+   /** Results are read as soon as they are ready, so latency only has to cover how far GPU can run behind CPU. */
+   constexpr UINT64 DEFAULT_GPU_PROFILE_QUERY_LATENCY = 5;
+
+   /**
+    * @brief   Measures elapsed GPU time of scopes with timestamps. Timestamps are recorded into a ring of frame slots,
+    *          and results are read back without blocking once GPU has finished the frame.
+    *          Frame slot which is not ready yet when it has to be reused is dropped.
+    *          Resolved scopes are also recorded into frame timeline of engine, if there is.
+    */
    class MEAPI GPUProfiler
    {
    public:
@@ -17,75 +33,88 @@ namespace Mile
          double MinTime = DBL_MAX;
       };
 
-      struct MEAPI GPUProfileData
+      struct MEAPI GPUProfileScope
       {
-         bool bIsOnQuery = false;
+         std::string Name;
          bool bIsDeferred = false;
-         ID3D11Query* Disjoint = nullptr;
-         ID3D11Query* Begin = nullptr;
-         ID3D11Query* End = nullptr;
-         double ElapsedTime = 0.0;
-         UINT64 ElapsedTimeHz = 0;
-         UINT64 QueryBeginFrame = 0;
-
-         ~GPUProfileData()
-         {
-            Reset();
-         }
-
-         void Reset()
-         {
-            bIsOnQuery = false;
-            bIsDeferred = false;
-            SafeRelease(Disjoint);
-            SafeRelease(Begin);
-            SafeRelease(End);
-            ElapsedTime = 0;
-            QueryBeginFrame = 0;
-         }
+         GPUProfilDataeAccumulation Times;
       };
 
    public:
       GPUProfiler(RendererDX11* renderer);
+      GPUProfiler(std::unique_ptr<GPUTimestampSource> timestampSource, size_t maximumThreads);
       ~GPUProfiler();
 
       GPUProfiler() = delete;
       GPUProfiler(const GPUProfiler&) = delete;
       GPUProfiler(GPUProfiler&&) = delete;
 
-      void Begin(const std::string& name);
-      void End(const std::string& name);
+      /** @return   Same id for same name. Thread-safe. */
+      GPUProfileScopeID RegisterScope(const std::string& name);
+      /** @return   Copy of name, since scopes can be registered from other threads meanwhile. Thread-safe. */
+      std::string GetScopeName(GPUProfileScopeID scope) const
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         return (scope < m_scopes.size()) ? m_scopes[scope].Name : std::string();
+      }
+
+      /** Main thread only */
+      void BeginFrame();
+      /** Main thread only */
       void EndFrame();
 
-      void Begin(const std::string& name, ID3D11DeviceContext& context, bool bIsDeferred = false);
-      void End(const std::string& name, ID3D11DeviceContext& context);
+      /**
+       * @brief   Begin/End can be called from any thread between BeginFrame and EndFrame.
+       *          Scope can be measured once per frame, following Begin of same scope is ignored.
+       * @param   context  nullptr for immediate context
+       */
+      void Begin(GPUProfileScopeID scope, RenderContext* context = nullptr, bool bIsDeferred = false);
+      void End(GPUProfileScopeID scope, RenderContext* context = nullptr);
+
+      void Begin(const std::string& name) { Begin(RegisterScope(name)); }
+      void End(const std::string& name) { End(RegisterScope(name)); }
 
       /** Thread-safe draw call count increment, Thread0 == Main Thread */
-      void DrawCall(UINT64 vertices, UINT64 triangles, size_t threadIdx = 0)
+      void DrawCall(UINT64 vertices, UINT64 triangles, size_t threadIdx = 0, UINT64 instances = 1)
       {
          ++m_drawCalls[threadIdx];
          m_vertices[threadIdx] += vertices;
          m_triangles[threadIdx] += triangles;
+         m_instances[threadIdx] += instances;
+      }
+
+      /** Frustum culling result, Main thread only */
+      void CullingResult(UINT64 visibleMeshes, UINT64 culledMeshes)
+      {
+         m_visibleMeshes += visibleMeshes;
+         m_culledMeshes += culledMeshes;
       }
 
       UINT64 GetLatestDrawCalls() const { return m_latestDrawCalls; }
       UINT64 GetLatestVertices() const { return m_latestDrawVertices; }
       UINT64 GetLatestTriangles() const { return m_latestDrawTriangles; }
+      /** Number of drawn instances; Same as draw calls if there was no instanced draw. */
+      UINT64 GetLatestInstances() const { return m_latestDrawInstances; }
+      UINT64 GetLatestVisibleMeshes() const { return m_latestVisibleMeshes; }
+      UINT64 GetLatestCulledMeshes() const { return m_latestCulledMeshes; }
 
       UINT64 GetCurrentFrame() const { return m_currentFrame; }
+      /** Number of frames which results were not ready until their frame slot had to be reused. */
+      UINT64 GetDroppedFrames() const { return m_droppedFrames; }
 
+      /** Number of frames which results can be waited for. Ring of (latency + 1) frame slots is used. */
       void SetQueryLatency(UINT64 queryLatency) { m_queryLatency = queryLatency; }
       UINT64 GetQueryLatency() const { return m_queryLatency; }
 
-      const auto& GetProfileTimes() const { return m_profileTimes; }
+      const std::vector<GPUProfileScope>& GetScopes() const { return m_scopes; }
       double GetProfileOverallTime() const
       {
          double sum = 0.0;
-         for (const auto& data : m_profileTimes)
+         for (const auto& scope : m_scopes)
          {
-            if (!(*m_profiles.find(data.first)).second.bIsDeferred)
+            if (!scope.bIsDeferred)
             {
-               sum += data.second.RecentElapsed;
+               sum += scope.Times.RecentElapsed;
             }
          }
 
@@ -94,42 +123,100 @@ namespace Mile
 
       void ClearDatas() 
       {
-         m_profileTimes.clear();
+         for (auto& scope : m_scopes)
+         {
+            scope.Times = GPUProfilDataeAccumulation();
+         }
          std::fill(m_drawCalls.begin(), m_drawCalls.end(), 0);
          std::fill(m_vertices.begin(), m_vertices.end(), 0);
          std::fill(m_triangles.begin(), m_triangles.end(), 0);
+         std::fill(m_instances.begin(), m_instances.end(), 0);
+         m_visibleMeshes = 0;
+         m_culledMeshes = 0;
       }
 
    private:
-      RendererDX11* m_renderer;
-      std::unordered_map<std::string, GPUProfileData> m_profiles;
-      std::map<std::string, GPUProfilDataeAccumulation> m_profileTimes;
+      struct ScopeQuery
+      {
+         GPUProfileScopeID Scope = INVALID_GPU_PROFILE_SCOPE;
+         UINT32 BeginTimestamp = 0;
+         bool bIsEnded = false;
+      };
+
+      struct FrameQueries
+      {
+         bool bIsPending = false;
+         std::vector<ScopeQuery> Queries;
+         /** GPU timestamps are placed on timeline relative to CPU time when frame has been began. */
+         UINT64 TimelineFrame = 0;
+         long long TimelineBeginNS = 0;
+      };
+
+      struct ResolvedTimestamps
+      {
+         bool bIsReady = false;
+         UINT64 Begin = 0;
+         UINT64 End = 0;
+      };
+
+      void ResolveFrames();
+      bool ResolveFrame(size_t frameSlot);
+      void RecordTimeline(const FrameQueries& frame, UINT64 frequency);
+
+   private:
+      std::unique_ptr<GPUTimestampSource> m_timestampSource;
+      mutable std::mutex m_mutex;
+
+      std::unordered_map<std::string, GPUProfileScopeID> m_scopeIDs;
+      std::vector<GPUProfileScope> m_scopes;
+      /** Index of query of each scope in current frame, INVALID_GPU_PROFILE_SCOPE if it has not been began. */
+      std::vector<UINT32> m_activeQueries;
+
+      std::vector<FrameQueries> m_frames;
+      /** Timestamps of each query in resolving frame */
+      std::vector<ResolvedTimestamps> m_resolvedTimestamps;
+      size_t m_currentSlot;
+      bool m_bIsFrameBegan;
       UINT64 m_currentFrame;
       UINT64 m_queryLatency;
+      UINT64 m_droppedFrames;
 
       /** Drawcall profile */
       std::vector<UINT64> m_drawCalls;
       std::vector<UINT64> m_vertices;
       std::vector<UINT64> m_triangles;
+      std::vector<UINT64> m_instances;
       UINT64 m_latestDrawCalls;
       UINT64 m_latestDrawVertices;
       UINT64 m_latestDrawTriangles;
+      UINT64 m_latestDrawInstances;
+
+      /** Culling profile */
+      UINT64 m_visibleMeshes;
+      UINT64 m_culledMeshes;
+      UINT64 m_latestVisibleMeshes;
+      UINT64 m_latestCulledMeshes;
       
    };
 
    class MEAPI ScopedGPUProfile
    {
    public:
-      ScopedGPUProfile(GPUProfiler& profiler, const std::string& profileName) :
+      ScopedGPUProfile(GPUProfiler& profiler, GPUProfileScopeID scope) :
          m_profiler(profiler),
-         m_profileName(profileName)
+         m_scope(scope)
+      {
+         m_profiler.Begin(scope);
+      }
+
+      ScopedGPUProfile(GPUProfiler& profiler, const std::string& profileName) :
+         ScopedGPUProfile(profiler, profiler.RegisterScope(profileName))
       {
-         m_profiler.Begin(profileName);
       }
 
       ~ScopedGPUProfile()
       {
-         m_profiler.End(m_profileName);
+         m_profiler.End(m_scope);
       }
 
       ScopedGPUProfile() = delete;
@@ -138,28 +225,29 @@ namespace Mile
 
    private:
       GPUProfiler& m_profiler;
-      std::string m_profileName;
+      GPUProfileScopeID m_scope;
 
    };
 
    class MEAPI ScopedDeferredGPUProfile
    {
    public:
-      ScopedDeferredGPUProfile(GPUProfiler& profiler, const std::string& profileName, ID3D11DeviceContext& deferredContext) :
+      ScopedDeferredGPUProfile(GPUProfiler& profiler, GPUProfileScopeID scope, RenderContext& deferredContext) :
          m_profiler(profiler),
          m_context(deferredContext),
-         m_profileName(profileName)
+         m_scope(scope)
+      {
+         m_profiler.Begin(scope, &m_context, true);
+      }
+
+      ScopedDeferredGPUProfile(GPUProfiler& profiler, const std::string& profileName, RenderContext& deferredContext) :
+         ScopedDeferredGPUProfile(profiler, profiler.RegisterScope(profileName), deferredContext)
       {
-         m_globalMutex.lock();
-         m_profiler.Begin(profileName, m_context, true);
-         m_globalMutex.unlock();
       }
 
       ~ScopedDeferredGPUProfile()
       {
-         m_globalMutex.lock();
-         m_profiler.End(m_profileName, m_context);
-         m_globalMutex.unlock();
+         m_profiler.End(m_scope, &m_context);
       }
 
       ScopedDeferredGPUProfile() = delete;
@@ -167,10 +255,9 @@ namespace Mile
       ScopedDeferredGPUProfile(ScopedDeferredGPUProfile&&) = delete;
 
    private:
-      static std::mutex m_globalMutex;
       GPUProfiler& m_profiler;
-      std::string m_profileName;
-      ID3D11DeviceContext& m_context;
+      RenderContext& m_context;
+      GPUProfileScopeID m_scope;
 
    };
 }
\ No newline at end of file
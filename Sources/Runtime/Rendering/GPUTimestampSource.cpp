@@ -0,0 +1,167 @@
+#include "Rendering/GPUTimestampSource.h"
+#include "Rendering/RendererDX11.h"
+
+namespace Mile
+{
+   GPUTimestampSourceDX11::GPUTimestampSourceDX11(RendererDX11* renderer) :
+      m_renderer(renderer),
+      m_timestampsPerFrame(0)
+   {
+   }
+
+   GPUTimestampSourceDX11::~GPUTimestampSourceDX11()
+   {
+      for (auto& frame : m_frames)
+      {
+         SafeRelease(frame.Disjoint);
+         for (auto& timestamp : frame.Timestamps)
+         {
+            SafeRelease(timestamp);
+         }
+      }
+   }
+
+   bool GPUTimestampSourceDX11::Reserve(size_t frameSlots, size_t timestampsPerFrame)
+   {
+      RenderDevice& device = m_renderer->GetDevice();
+      frameSlots = std::max(frameSlots, m_frames.size());
+      timestampsPerFrame = std::max(timestampsPerFrame, m_timestampsPerFrame);
+      m_frames.resize(frameSlots);
+
+      D3D11_QUERY_DESC queryDesc;
+      ZeroMemory(&queryDesc, sizeof(D3D11_QUERY_DESC));
+      for (auto& frame : m_frames)
+      {
+         if (frame.Disjoint == nullptr)
+         {
+            queryDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+            if (FAILED(device.CreateQuery(&queryDesc, &frame.Disjoint)))
+            {
+               return false;
+            }
+         }
+
+         queryDesc.Query = D3D11_QUERY_TIMESTAMP;
+         frame.Timestamps.reserve(timestampsPerFrame);
+         while (frame.Timestamps.size() < timestampsPerFrame)
+         {
+            ID3D11Query* timestamp = nullptr;
+            if (FAILED(device.CreateQuery(&queryDesc, &timestamp)))
+            {
+               return false;
+            }
+
+            frame.Timestamps.push_back(timestamp);
+         }
+      }
+
+      m_timestampsPerFrame = timestampsPerFrame;
+      return true;
+   }
+
+   void GPUTimestampSourceDX11::BeginFrame(size_t frameSlot)
+   {
+      m_renderer->GetImmediateContext().Begin(m_frames[frameSlot].Disjoint);
+   }
+
+   void GPUTimestampSourceDX11::EndFrame(size_t frameSlot)
+   {
+      m_renderer->GetImmediateContext().End(m_frames[frameSlot].Disjoint);
+   }
+
+   void GPUTimestampSourceDX11::WriteTimestamp(size_t frameSlot, size_t timestampSlot, RenderContext* context)
+   {
+      RenderContext& targetContext = (context != nullptr) ? *context : m_renderer->GetImmediateContext();
+      targetContext.End(m_frames[frameSlot].Timestamps[timestampSlot]);
+   }
+
+   bool GPUTimestampSourceDX11::ReadFrame(size_t frameSlot, UINT64& outFrequency, bool& bOutIsDisjoint)
+   {
+      D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+      RenderContext& context = m_renderer->GetImmediateContext();
+      if (context.GetData(m_frames[frameSlot].Disjoint, &disjointData, sizeof(disjointData), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+      {
+         return false;
+      }
+
+      outFrequency = disjointData.Frequency;
+      bOutIsDisjoint = (disjointData.Disjoint != FALSE);
+      return true;
+   }
+
+   bool GPUTimestampSourceDX11::ReadTimestamp(size_t frameSlot, size_t timestampSlot, UINT64& outTimestamp)
+   {
+      RenderContext& context = m_renderer->GetImmediateContext();
+      return context.GetData(m_frames[frameSlot].Timestamps[timestampSlot], &outTimestamp, sizeof(UINT64), D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK;
+   }
+
+   FakeGPUTimestampSource::FakeGPUTimestampSource(UINT64 frequency) :
+      m_frequency(frequency),
+      m_time(0),
+      m_readyLatency(0),
+      m_bIsDisjoint(false),
+      m_endedFrames(0),
+      m_timestampsPerFrame(0)
+   {
+   }
+
+   bool FakeGPUTimestampSource::Reserve(size_t frameSlots, size_t timestampsPerFrame)
+   {
+      m_frames.resize(std::max(frameSlots, m_frames.size()));
+      m_timestampsPerFrame = std::max(timestampsPerFrame, m_timestampsPerFrame);
+      for (auto& frame : m_frames)
+      {
+         frame.Timestamps.resize(m_timestampsPerFrame, 0);
+      }
+
+      return true;
+   }
+
+   void FakeGPUTimestampSource::BeginFrame(size_t frameSlot)
+   {
+      FrameRecord& frame = m_frames[frameSlot];
+      frame.bIsEnded = false;
+      frame.bIsDisjoint = m_bIsDisjoint;
+   }
+
+   void FakeGPUTimestampSource::EndFrame(size_t frameSlot)
+   {
+      FrameRecord& frame = m_frames[frameSlot];
+      frame.bIsEnded = true;
+      frame.EndedFrame = ++m_endedFrames;
+   }
+
+   void FakeGPUTimestampSource::WriteTimestamp(size_t frameSlot, size_t timestampSlot, RenderContext* context)
+   {
+      m_frames[frameSlot].Timestamps[timestampSlot] = m_time;
+   }
+
+   bool FakeGPUTimestampSource::ReadFrame(size_t frameSlot, UINT64& outFrequency, bool& bOutIsDisjoint)
+   {
+      if (!IsFrameReady(frameSlot))
+      {
+         return false;
+      }
+
+      outFrequency = m_frequency;
+      bOutIsDisjoint = m_frames[frameSlot].bIsDisjoint;
+      return true;
+   }
+
+   bool FakeGPUTimestampSource::ReadTimestamp(size_t frameSlot, size_t timestampSlot, UINT64& outTimestamp)
+   {
+      if (!IsFrameReady(frameSlot))
+      {
+         return false;
+      }
+
+      outTimestamp = m_frames[frameSlot].Timestamps[timestampSlot];
+      return true;
+   }
+
+   bool FakeGPUTimestampSource::IsFrameReady(size_t frameSlot) const
+   {
+      const FrameRecord& frame = m_frames[frameSlot];
+      return frame.bIsEnded && (m_endedFrames >= (frame.EndedFrame + m_readyLatency));
+   }
+}
\ No newline at end of file
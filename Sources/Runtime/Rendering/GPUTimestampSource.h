@@ -0,0 +1,115 @@
+#pragma once
+#include "Rendering/RenderingCore.h"
+
+namespace Mile
+{
+   class RendererDX11;
+
+   /**
+    * @brief   Source of GPU timestamps for GPUProfiler. Timestamps are addressed by (frame slot, query slot)
+    *          and each slot is reused once its frame has been read back. Read functions must not block.
+    */
+   class MEAPI GPUTimestampSource
+   {
+   public:
+      virtual ~GPUTimestampSource() = default;
+
+      /** Grow to at least given number of frame slots and timestamps per frame. Issued timestamps are kept. */
+      virtual bool Reserve(size_t frameSlots, size_t timestampsPerFrame) = 0;
+      virtual size_t GetFrameSlots() const = 0;
+      virtual size_t GetTimestampsPerFrame() const = 0;
+
+      /** Must be called on the thread which owns immediate context. */
+      virtual void BeginFrame(size_t frameSlot) = 0;
+      virtual void EndFrame(size_t frameSlot) = 0;
+      /** @param context   Device context to record timestamp, nullptr for immediate context. */
+      virtual void WriteTimestamp(size_t frameSlot, size_t timestampSlot, RenderContext* context) = 0;
+
+      /** @return   false if results of frame are not ready yet. */
+      virtual bool ReadFrame(size_t frameSlot, UINT64& outFrequency, bool& bOutIsDisjoint) = 0;
+      /** @return   false if timestamp is not ready yet. */
+      virtual bool ReadTimestamp(size_t frameSlot, size_t timestampSlot, UINT64& outTimestamp) = 0;
+   };
+
+   /** Timestamp source based on D3D11 queries. Queries are created once and reused. */
+   class MEAPI GPUTimestampSourceDX11 : public GPUTimestampSource
+   {
+   public:
+      GPUTimestampSourceDX11(RendererDX11* renderer);
+      virtual ~GPUTimestampSourceDX11();
+
+      virtual bool Reserve(size_t frameSlots, size_t timestampsPerFrame) override;
+      virtual size_t GetFrameSlots() const override { return m_frames.size(); }
+      virtual size_t GetTimestampsPerFrame() const override { return m_timestampsPerFrame; }
+
+      virtual void BeginFrame(size_t frameSlot) override;
+      virtual void EndFrame(size_t frameSlot) override;
+      virtual void WriteTimestamp(size_t frameSlot, size_t timestampSlot, RenderContext* context) override;
+
+      virtual bool ReadFrame(size_t frameSlot, UINT64& outFrequency, bool& bOutIsDisjoint) override;
+      virtual bool ReadTimestamp(size_t frameSlot, size_t timestampSlot, UINT64& outTimestamp) override;
+
+   private:
+      struct FrameQueries
+      {
+         ID3D11Query* Disjoint = nullptr;
+         std::vector<ID3D11Query*> Timestamps;
+      };
+
+   private:
+      RendererDX11* m_renderer;
+      std::vector<FrameQueries> m_frames;
+      size_t m_timestampsPerFrame;
+
+   };
+
+   /**
+    * @brief   Timestamp source without GPU. Timestamps are taken from a manually advanced clock,
+    *          and results of a frame become readable after given number of frames have been ended.
+    */
+   class MEAPI FakeGPUTimestampSource : public GPUTimestampSource
+   {
+   public:
+      FakeGPUTimestampSource(UINT64 frequency = 1000000);
+      virtual ~FakeGPUTimestampSource() = default;
+
+      void Advance(UINT64 ticks) { m_time += ticks; }
+      UINT64 GetTime() const { return m_time; }
+      void SetReadyLatency(size_t frames) { m_readyLatency = frames; }
+      /** Frames which begin after this call will be reported as disjoint. */
+      void SetDisjoint(bool bIsDisjoint) { m_bIsDisjoint = bIsDisjoint; }
+
+      virtual bool Reserve(size_t frameSlots, size_t timestampsPerFrame) override;
+      virtual size_t GetFrameSlots() const override { return m_frames.size(); }
+      virtual size_t GetTimestampsPerFrame() const override { return m_timestampsPerFrame; }
+
+      virtual void BeginFrame(size_t frameSlot) override;
+      virtual void EndFrame(size_t frameSlot) override;
+      virtual void WriteTimestamp(size_t frameSlot, size_t timestampSlot, RenderContext* context) override;
+
+      virtual bool ReadFrame(size_t frameSlot, UINT64& outFrequency, bool& bOutIsDisjoint) override;
+      virtual bool ReadTimestamp(size_t frameSlot, size_t timestampSlot, UINT64& outTimestamp) override;
+
+   private:
+      bool IsFrameReady(size_t frameSlot) const;
+
+   private:
+      struct FrameRecord
+      {
+         bool bIsEnded = false;
+         bool bIsDisjoint = false;
+         UINT64 EndedFrame = 0;
+         std::vector<UINT64> Timestamps;
+      };
+
+   private:
+      UINT64 m_frequency;
+      UINT64 m_time;
+      size_t m_readyLatency;
+      bool m_bIsDisjoint;
+      UINT64 m_endedFrames;
+      std::vector<FrameRecord> m_frames;
+      size_t m_timestampsPerFrame;
+
+   };
+}
\ No newline at end of file
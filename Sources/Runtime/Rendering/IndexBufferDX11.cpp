@@ -4,17 +4,28 @@
 namespace Mile
 {
    IndexBufferDX11::IndexBufferDX11(RendererDX11* renderer) :
+      m_format(DXGI_FORMAT_R32_UINT),
       BufferDX11(renderer)
    {
    }
 
    bool IndexBufferDX11::Init(const std::vector<unsigned int>& indicies)
+   {
+      return Init(indicies.data(), indicies.size(), DXGI_FORMAT_R32_UINT);
+   }
+
+   bool IndexBufferDX11::Init(const std::vector<UINT16>& indicies)
+   {
+      return Init(indicies.data(), indicies.size(), DXGI_FORMAT_R16_UINT);
+   }
+
+   bool IndexBufferDX11::Init(const void* indicies, size_t indexNum, DXGI_FORMAT format)
    {
       if (RenderObject::IsInitializable())
       {
          D3D11_BUFFER_DESC desc;
          ZeroMemory(&desc, sizeof(desc));
-         desc.ByteWidth = static_cast<unsigned int>(sizeof(unsigned int) * indicies.size());
+         desc.ByteWidth = static_cast<unsigned int>((format == DXGI_FORMAT_R16_UINT ? sizeof(UINT16) : sizeof(unsigned int)) * indexNum);
          desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
          desc.StructureByteStride = 0;
          desc.MiscFlags = 0;
@@ -23,13 +34,14 @@ namespace Mile
 
          D3D11_SUBRESOURCE_DATA subResource;
          ZeroMemory(&subResource, sizeof(subResource));
-         subResource.pSysMem = indicies.data();
+         subResource.pSysMem = indicies;
 
          RendererDX11* renderer = GetRenderer();
          auto result = renderer->GetDevice().CreateBuffer(&desc, &subResource, reinterpret_cast<ID3D11Buffer**>(&m_resource));
          if (!FAILED(result))
          {
             m_desc = desc;
+            m_format = format;
             RenderObject::ConfirmInit();
             return true;
          }
@@ -38,11 +50,11 @@ namespace Mile
       return false;
    }
 
-   bool IndexBufferDX11::Bind(ID3D11DeviceContext& deviceContext)
+   bool IndexBufferDX11::Bind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
-         deviceContext.IASetIndexBuffer(reinterpret_cast<ID3D11Buffer*>(m_resource), DXGI_FORMAT_R32_UINT, 0);
+         deviceContext.IASetIndexBuffer(reinterpret_cast<ID3D11Buffer*>(m_resource), m_format, 0);
          return true;
       }
 
@@ -42,7 +42,7 @@ namespace Mile
       return false;
    }
 
-   bool InputLayoutDX11::Bind(ID3D11DeviceContext& deviceContext)
+   bool InputLayoutDX11::Bind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
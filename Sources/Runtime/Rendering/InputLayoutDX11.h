@@ -12,7 +12,7 @@ namespace Mile
       virtual ~InputLayoutDX11();
 
       bool Init(InputLayoutElementList&& intputLayoutDescs, VertexShaderDX11* shader);
-      bool Bind(ID3D11DeviceContext& deviceContext);
+      bool Bind(RenderContext& deviceContext);
 
       InputLayoutElementList GetElementDescs() const { return m_elementDescs; }
 
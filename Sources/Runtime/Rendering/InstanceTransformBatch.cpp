@@ -0,0 +1,36 @@
+#include "Rendering/InstanceTransformBatch.h"
+#include "Component/MeshRenderComponent.h"
+#include "GameFramework/Transform.h"
+
+namespace Mile
+{
+   void InstanceTransformBatch::Reset(const Matrix& viewMatrix, const Matrix& projMatrix)
+   {
+      m_viewMatrix = viewMatrix;
+      m_viewProjMatrix = viewMatrix * projMatrix;
+      m_transforms.resize(0);
+   }
+
+   size_t InstanceTransformBatch::Allocate(size_t num)
+   {
+      size_t firstDrawID = m_transforms.size();
+      m_transforms.resize(firstDrawID + num);
+      return firstDrawID;
+   }
+
+   void InstanceTransformBatch::Pack(size_t drawID, const Matrix& worldMatrix)
+   {
+      InstanceTransform& transform = m_transforms[drawID];
+      transform.WorldMatrix = worldMatrix;
+      transform.WorldViewMatrix = worldMatrix * m_viewMatrix;
+      transform.WorldViewProjMatrix = worldMatrix * m_viewProjMatrix;
+   }
+
+   void InstanceTransformBatch::Pack(size_t firstDrawID, MeshRenderComponent* const* meshes, size_t num)
+   {
+      for (size_t idx = 0; idx < num; ++idx)
+      {
+         Pack(firstDrawID + idx, meshes[idx]->GetTransform()->GetWorldMatrix());
+      }
+   }
+}
\ No newline at end of file
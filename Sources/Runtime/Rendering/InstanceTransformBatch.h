@@ -0,0 +1,51 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+#include "Math/Matrix.h"
+
+namespace Mile
+{
+   /** Layout of one element of instance transform structured buffer. (GeometryPass.hlsl) */
+   struct MEAPI alignas(16) InstanceTransform
+   {
+      Matrix WorldMatrix = Matrix::Identity;
+      Matrix WorldViewMatrix = Matrix::Identity;
+      Matrix WorldViewProjMatrix = Matrix::Identity;
+   };
+
+   class MeshRenderComponent;
+
+   /**
+   * @brief    CPU side packing of per draw transforms of a frame.
+   *           Each draw owns one slot(draw id) and shader fetches its transforms by draw id,
+   *           so transforms of every draws are uploaded by single map/unmap.
+   *           It does not touch any GPU resource; packing can be recorded and measured without device.
+   */
+   class MEAPI InstanceTransformBatch
+   {
+   public:
+      InstanceTransformBatch() = default;
+
+      /** Discard every slots and set view/projection matrix of upcoming draws. */
+      void Reset(const Matrix& viewMatrix, const Matrix& projMatrix);
+
+      /**
+      * @brief    Reserve contiguous slots. Slots of different allocations can be packed concurrently.
+      * @return   Draw id of first slot.
+      */
+      size_t Allocate(size_t num);
+
+      void Pack(size_t drawID, const Matrix& worldMatrix);
+      /** Pack world transforms of meshes into [firstDrawID, firstDrawID + num) */
+      void Pack(size_t firstDrawID, MeshRenderComponent* const* meshes, size_t num);
+
+      const InstanceTransform* GetData() const { return m_transforms.data(); }
+      size_t GetSize() const { return m_transforms.size(); }
+      size_t GetSizeInBytes() const { return m_transforms.size() * sizeof(InstanceTransform); }
+
+   private:
+      Matrix m_viewMatrix;
+      Matrix m_viewProjMatrix;
+      std::vector<InstanceTransform> m_transforms;
+
+   };
+}
\ No newline at end of file
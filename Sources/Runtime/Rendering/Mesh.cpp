@@ -2,7 +2,7 @@
 
 namespace Mile
 {
-   bool Mesh::Bind(ID3D11DeviceContext& deviceContext, unsigned int startSlot)
+   bool Mesh::Bind(RenderContext& deviceContext, unsigned int startSlot)
    {
       if (RenderObject::IsBindable())
       {
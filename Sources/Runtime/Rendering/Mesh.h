@@ -3,6 +3,7 @@
 #include "Rendering/RendererDX11.h"
 #include "Rendering/VertexBufferDX11.h"
 #include "Rendering/IndexBufferDX11.h"
+#include "Math/BoundingVolume.h"
 
 namespace Mile
 {
@@ -28,11 +29,14 @@ namespace Mile
          SafeDelete(m_indexBuffer);
       }
 
-      template <typename Vertex>
-      bool Init(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
+      /** Index type can be unsigned int or UINT16. */
+      template <typename Vertex, typename Index>
+      bool Init(const std::vector<Vertex>& vertices, const std::vector<Index>& indices)
       {
          if (RenderObject::IsInitializable())
          {
+            ComputeBounds(vertices);
+
             RendererDX11* renderer = GetRenderer();
             m_indexBuffer = new IndexBufferDX11(renderer);
             m_indexNum = static_cast<unsigned int>(indices.size());
@@ -57,7 +61,7 @@ namespace Mile
          return false;
       }
 
-      bool Bind(ID3D11DeviceContext& deviceContext, unsigned int startSlot);
+      bool Bind(RenderContext& deviceContext, unsigned int startSlot);
 
       IndexBufferDX11* GetIndexBuffer() { return m_indexBuffer; }
       VertexBufferDX11* GetVertexBuffer() { return m_vertexBuffer; }
@@ -70,6 +74,35 @@ namespace Mile
 
       EStaticMeshType GetMeshType() const { return m_type; }
 
+      /** Local space bounds which have been computed at initialization. */
+      const AABB& GetBounds() const { return m_bounds; }
+      const BoundingSphere& GetBoundingSphere() const { return m_boundingSphere; }
+
+   private:
+      template <typename Vertex>
+      void ComputeBounds(const std::vector<Vertex>& vertices)
+      {
+         m_bounds = AABB();
+         for (const auto& vertex : vertices)
+         {
+            m_bounds.Encapsulate(Vector3(vertex.Position.x, vertex.Position.y, vertex.Position.z));
+         }
+
+         m_boundingSphere = BoundingSphere();
+         if (m_bounds.IsValid())
+         {
+            m_boundingSphere.Center = m_bounds.GetCenter();
+            float radiusSquared = 0.0f;
+            for (const auto& vertex : vertices)
+            {
+               Vector3 offset = Vector3(vertex.Position.x, vertex.Position.y, vertex.Position.z) - m_boundingSphere.Center;
+               radiusSquared = std::max(radiusSquared, offset.SizeSquared());
+            }
+
+            m_boundingSphere.Radius = std::sqrt(radiusSquared);
+         }
+      }
+
    private:
       EStaticMeshType   m_type;
       IndexBufferDX11*  m_indexBuffer;
@@ -81,5 +114,8 @@ namespace Mile
       unsigned int      m_vertexNum;
       unsigned int      m_indexNum;
 
+      AABB              m_bounds;
+      BoundingSphere    m_boundingSphere;
+
    };
 }
\ No newline at end of file
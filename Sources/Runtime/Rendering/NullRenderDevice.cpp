@@ -0,0 +1,1084 @@
+#include "Rendering/NullRenderDevice.h"
+
+namespace Mile
+{
+   /** Private data guid which is used to identify null objects through D3D11 interfaces. */
+   static const GUID NULL_RENDER_OBJECT_ID_GUID = { 0x6d1f3a52, 0x94b7, 0x4c1e, { 0x8a, 0x3d, 0x51, 0x0e, 0x7b, 0x2c, 0x96, 0xf4 } };
+
+   /** Implements IUnknown and ID3D11DeviceChild part of D3D11 interfaces. */
+   template <typename Interface>
+   class NullDeviceChild : public Interface
+   {
+   public:
+      NullDeviceChild(UINT64 id) :
+         m_id(id),
+         m_refCount(1)
+      {
+      }
+
+      virtual ~NullDeviceChild() = default;
+
+      virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** object) override
+      {
+         if (object == nullptr)
+         {
+            return E_POINTER;
+         }
+
+         if (riid == __uuidof(Interface) || riid == __uuidof(ID3D11DeviceChild) || riid == __uuidof(IUnknown))
+         {
+            AddRef();
+            (*object) = static_cast<Interface*>(this);
+            return S_OK;
+         }
+
+         (*object) = nullptr;
+         return E_NOINTERFACE;
+      }
+
+      virtual ULONG STDMETHODCALLTYPE AddRef() override
+      {
+         return ++m_refCount;
+      }
+
+      virtual ULONG STDMETHODCALLTYPE Release() override
+      {
+         ULONG refCount = --m_refCount;
+         if (refCount == 0)
+         {
+            delete this;
+         }
+
+         return refCount;
+      }
+
+      virtual void STDMETHODCALLTYPE GetDevice(ID3D11Device** device) override
+      {
+         if (device != nullptr)
+         {
+            (*device) = nullptr;
+         }
+      }
+
+      virtual HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid, UINT* dataSize, void* data) override
+      {
+         if (dataSize == nullptr || guid != NULL_RENDER_OBJECT_ID_GUID)
+         {
+            return DXGI_ERROR_NOT_FOUND;
+         }
+
+         if (data == nullptr)
+         {
+            (*dataSize) = sizeof(UINT64);
+            return S_OK;
+         }
+
+         if ((*dataSize) < sizeof(UINT64))
+         {
+            return DXGI_ERROR_MORE_DATA;
+         }
+
+         std::memcpy(data, &m_id, sizeof(UINT64));
+         (*dataSize) = sizeof(UINT64);
+         return S_OK;
+      }
+
+      virtual HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid, UINT dataSize, const void* data) override
+      {
+         return S_OK;
+      }
+
+      virtual HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID guid, const IUnknown* data) override
+      {
+         return S_OK;
+      }
+
+   private:
+      UINT64 m_id;
+      std::atomic<ULONG> m_refCount;
+
+   };
+
+   /** Resource keeps its descriptor and lazily allocated system memory for Map. */
+   template <typename Interface, typename Desc, D3D11_RESOURCE_DIMENSION Dimension>
+   class NullResource : public NullDeviceChild<Interface>
+   {
+   public:
+      NullResource(UINT64 id, const Desc& desc, UINT rowPitch, size_t sizeInBytes) :
+         NullDeviceChild<Interface>(id),
+         m_desc(desc),
+         m_evictionPriority(0),
+         m_rowPitch(rowPitch),
+         m_sizeInBytes(sizeInBytes)
+      {
+      }
+
+      virtual void STDMETHODCALLTYPE GetType(D3D11_RESOURCE_DIMENSION* dimension) override
+      {
+         if (dimension != nullptr)
+         {
+            (*dimension) = Dimension;
+         }
+      }
+
+      virtual void STDMETHODCALLTYPE SetEvictionPriority(UINT evictionPriority) override { m_evictionPriority = evictionPriority; }
+      virtual UINT STDMETHODCALLTYPE GetEvictionPriority() override { return m_evictionPriority; }
+
+      virtual void STDMETHODCALLTYPE GetDesc(Desc* desc) override
+      {
+         if (desc != nullptr)
+         {
+            (*desc) = m_desc;
+         }
+      }
+
+      UINT GetRowPitch() const { return m_rowPitch; }
+      size_t GetSizeInBytes() const { return m_sizeInBytes; }
+
+      void* GetMemory()
+      {
+         if (m_memory.size() != m_sizeInBytes)
+         {
+            m_memory.resize(m_sizeInBytes);
+         }
+
+         return m_memory.data();
+      }
+
+   private:
+      Desc m_desc;
+      UINT m_evictionPriority;
+      UINT m_rowPitch;
+      size_t m_sizeInBytes;
+      std::vector<unsigned char> m_memory;
+
+   };
+
+   using NullBuffer = NullResource<ID3D11Buffer, D3D11_BUFFER_DESC, D3D11_RESOURCE_DIMENSION_BUFFER>;
+   using NullTexture2D = NullResource<ID3D11Texture2D, D3D11_TEXTURE2D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE2D>;
+
+   /** View holds reference of its resource as same as D3D11. */
+   template <typename Interface, typename Desc>
+   class NullView : public NullDeviceChild<Interface>
+   {
+   public:
+      NullView(UINT64 id, ID3D11Resource* resource, const Desc& desc) :
+         NullDeviceChild<Interface>(id),
+         m_resource(resource),
+         m_desc(desc)
+      {
+         m_resource->AddRef();
+      }
+
+      virtual ~NullView()
+      {
+         SafeRelease(m_resource);
+      }
+
+      virtual void STDMETHODCALLTYPE GetResource(ID3D11Resource** resource) override
+      {
+         if (resource != nullptr)
+         {
+            m_resource->AddRef();
+            (*resource) = m_resource;
+         }
+      }
+
+      virtual void STDMETHODCALLTYPE GetDesc(Desc* desc) override
+      {
+         if (desc != nullptr)
+         {
+            (*desc) = m_desc;
+         }
+      }
+
+   private:
+      ID3D11Resource* m_resource;
+      Desc m_desc;
+
+   };
+
+   template <typename Interface, typename Desc>
+   class NullState : public NullDeviceChild<Interface>
+   {
+   public:
+      NullState(UINT64 id, const Desc& desc) :
+         NullDeviceChild<Interface>(id),
+         m_desc(desc)
+      {
+      }
+
+      virtual void STDMETHODCALLTYPE GetDesc(Desc* desc) override
+      {
+         if (desc != nullptr)
+         {
+            (*desc) = m_desc;
+         }
+      }
+
+   private:
+      Desc m_desc;
+
+   };
+
+   class NullQuery : public NullDeviceChild<ID3D11Query>
+   {
+   public:
+      NullQuery(UINT64 id, const D3D11_QUERY_DESC& desc) :
+         NullDeviceChild<ID3D11Query>(id),
+         m_desc(desc)
+      {
+      }
+
+      virtual UINT STDMETHODCALLTYPE GetDataSize() override
+      {
+         switch (m_desc.Query)
+         {
+         case D3D11_QUERY_EVENT:
+            return sizeof(BOOL);
+         case D3D11_QUERY_OCCLUSION:
+         case D3D11_QUERY_TIMESTAMP:
+            return sizeof(UINT64);
+         case D3D11_QUERY_TIMESTAMP_DISJOINT:
+            return sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT);
+         default:
+            return 0;
+         }
+      }
+
+      virtual void STDMETHODCALLTYPE GetDesc(D3D11_QUERY_DESC* desc) override
+      {
+         if (desc != nullptr)
+         {
+            (*desc) = m_desc;
+         }
+      }
+
+   private:
+      D3D11_QUERY_DESC m_desc;
+
+   };
+
+   class NullCommandList : public NullDeviceChild<ID3D11CommandList>
+   {
+   public:
+      NullCommandList(UINT64 id) :
+         NullDeviceChild<ID3D11CommandList>(id)
+      {
+      }
+
+      virtual UINT STDMETHODCALLTYPE GetContextFlags() override { return 0; }
+
+      RenderCommandBuffer& GetCommandBuffer() { return m_commands; }
+
+   private:
+      RenderCommandBuffer m_commands;
+
+   };
+
+   static const char* ShaderStageToString(EShaderType stage)
+   {
+      switch (stage)
+      {
+      case EShaderType::VertexShader:
+         return "VS";
+      case EShaderType::HullShader:
+         return "HS";
+      case EShaderType::DomainShader:
+         return "DS";
+      case EShaderType::GeometryShader:
+         return "GS";
+      case EShaderType::PixelShader:
+         return "PS";
+      case EShaderType::ComputeShader:
+         return "CS";
+      default:
+         return "";
+      }
+   }
+
+   RenderCommand& RenderCommandBuffer::Add(ERenderCommand type, EShaderType stage, std::initializer_list<INT64> args, std::initializer_list<float> values)
+   {
+      m_commands.emplace_back();
+      RenderCommand& command = m_commands.back();
+      command.Type = type;
+      command.Stage = stage;
+      command.FirstObject = static_cast<UINT32>(m_objects.size());
+      for (INT64 arg : args)
+      {
+         if (command.NumArgs < MAXIMUM_RENDER_COMMAND_ARGS)
+         {
+            command.Args[command.NumArgs++] = arg;
+         }
+      }
+
+      for (float value : values)
+      {
+         if (command.NumValues < MAXIMUM_RENDER_COMMAND_VALUES)
+         {
+            command.Values[command.NumValues++] = value;
+         }
+      }
+
+      return command;
+   }
+
+   void RenderCommandBuffer::AddObject(UINT64 objectID)
+   {
+      if (!m_commands.empty())
+      {
+         m_objects.push_back(objectID);
+         ++m_commands.back().NumObjects;
+      }
+   }
+
+   void RenderCommandBuffer::Append(const RenderCommandBuffer& other)
+   {
+      UINT32 objectOffset = static_cast<UINT32>(m_objects.size());
+      m_commands.reserve(m_commands.size() + other.m_commands.size());
+      for (RenderCommand command : other.m_commands)
+      {
+         command.FirstObject += objectOffset;
+         m_commands.push_back(command);
+      }
+
+      m_objects.insert(m_objects.end(), other.m_objects.begin(), other.m_objects.end());
+   }
+
+   void RenderCommandBuffer::Clear()
+   {
+      m_commands.clear();
+      m_objects.clear();
+   }
+
+   size_t RenderCommandBuffer::CountCommands(ERenderCommand type) const
+   {
+      return std::count_if(m_commands.begin(), m_commands.end(),
+         [type](const RenderCommand& command)
+         {
+            return command.Type == type;
+         });
+   }
+
+   std::string RenderCommandBuffer::Serialize() const
+   {
+      std::string serialized;
+      serialized.reserve(m_commands.size() * 48);
+
+      char buffer[64];
+      for (const RenderCommand& command : m_commands)
+      {
+         serialized += CommandToString(command.Type);
+         if (command.Stage != EShaderType::EnumSize)
+         {
+            serialized += ' ';
+            serialized += ShaderStageToString(command.Stage);
+         }
+
+         for (UINT8 idx = 0; idx < command.NumArgs; ++idx)
+         {
+            std::snprintf(buffer, sizeof(buffer), " %lld", static_cast<long long>(command.Args[idx]));
+            serialized += buffer;
+         }
+
+         for (UINT8 idx = 0; idx < command.NumValues; ++idx)
+         {
+            std::snprintf(buffer, sizeof(buffer), " %g", command.Values[idx]);
+            serialized += buffer;
+         }
+
+         if (command.NumObjects > 0)
+         {
+            serialized += " [";
+            for (UINT32 idx = 0; idx < command.NumObjects; ++idx)
+            {
+               UINT64 objectID = GetObjectID(command, idx);
+               if (idx > 0)
+               {
+                  serialized += ' ';
+               }
+
+               if (objectID == 0)
+               {
+                  serialized += "null";
+               }
+               else
+               {
+                  std::snprintf(buffer, sizeof(buffer), "#%llu", static_cast<unsigned long long>(objectID));
+                  serialized += buffer;
+               }
+            }
+            serialized += ']';
+         }
+
+         serialized += '\n';
+      }
+
+      return serialized;
+   }
+
+   bool RenderCommandBuffer::WriteToFile(const String& filePath) const
+   {
+      std::ofstream stream(std::filesystem::path(filePath), std::ios::out | std::ios::trunc);
+      if (!stream.is_open())
+      {
+         return false;
+      }
+
+      stream << Serialize();
+      return stream.good();
+   }
+
+   const char* RenderCommandBuffer::CommandToString(ERenderCommand type)
+   {
+      switch (type)
+      {
+      case ERenderCommand::ClearState:
+         return "ClearState";
+      case ERenderCommand::SetPrimitiveTopology:
+         return "SetPrimitiveTopology";
+      case ERenderCommand::SetInputLayout:
+         return "SetInputLayout";
+      case ERenderCommand::SetVertexBuffers:
+         return "SetVertexBuffers";
+      case ERenderCommand::SetIndexBuffer:
+         return "SetIndexBuffer";
+      case ERenderCommand::SetShader:
+         return "SetShader";
+      case ERenderCommand::SetShaderResources:
+         return "SetShaderResources";
+      case ERenderCommand::SetSamplers:
+         return "SetSamplers";
+      case ERenderCommand::SetConstantBuffers:
+         return "SetConstantBuffers";
+      case ERenderCommand::SetUnorderedAccessViews:
+         return "SetUnorderedAccessViews";
+      case ERenderCommand::SetViewports:
+         return "SetViewports";
+      case ERenderCommand::SetRasterizerState:
+         return "SetRasterizerState";
+      case ERenderCommand::SetRenderTargets:
+         return "SetRenderTargets";
+      case ERenderCommand::SetDepthStencilState:
+         return "SetDepthStencilState";
+      case ERenderCommand::SetBlendState:
+         return "SetBlendState";
+      case ERenderCommand::ClearRenderTarget:
+         return "ClearRenderTarget";
+      case ERenderCommand::ClearDepthStencil:
+         return "ClearDepthStencil";
+      case ERenderCommand::DrawIndexed:
+         return "DrawIndexed";
+      case ERenderCommand::DrawIndexedInstanced:
+         return "DrawIndexedInstanced";
+      case ERenderCommand::Dispatch:
+         return "Dispatch";
+      case ERenderCommand::Map:
+         return "Map";
+      case ERenderCommand::Unmap:
+         return "Unmap";
+      case ERenderCommand::BeginQuery:
+         return "BeginQuery";
+      case ERenderCommand::EndQuery:
+         return "EndQuery";
+      case ERenderCommand::GenerateMips:
+         return "GenerateMips";
+      case ERenderCommand::ExecuteCommandList:
+         return "ExecuteCommandList";
+      default:
+         return "Unknown";
+      }
+   }
+
+   NullRenderContext::NullRenderContext(bool bIsDeferred) :
+      m_bIsDeferred(bIsDeferred),
+      m_bIsRecordingEnabled(true)
+   {
+   }
+
+   template <typename Ty>
+   void NullRenderContext::RecordObjects(Ty* const* objects, UINT numObjects)
+   {
+      for (UINT idx = 0; idx < numObjects; ++idx)
+      {
+         m_commands.AddObject((objects != nullptr) ? NullRenderDevice::GetObjectID(objects[idx]) : 0);
+      }
+   }
+
+   void NullRenderContext::ClearState()
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::ClearState);
+      }
+   }
+
+   void NullRenderContext::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetPrimitiveTopology, EShaderType::EnumSize, { static_cast<INT64>(topology) });
+      }
+   }
+
+   void NullRenderContext::IASetInputLayout(ID3D11InputLayout* inputLayout)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetInputLayout);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(inputLayout));
+      }
+   }
+
+   void NullRenderContext::IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         INT64 stride = (strides != nullptr && numBuffers > 0) ? strides[0] : 0;
+         INT64 offset = (offsets != nullptr && numBuffers > 0) ? offsets[0] : 0;
+         m_commands.Add(ERenderCommand::SetVertexBuffers, EShaderType::EnumSize, { startSlot, numBuffers, stride, offset });
+         RecordObjects(vertexBuffers, numBuffers);
+      }
+   }
+
+   void NullRenderContext::IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetIndexBuffer, EShaderType::EnumSize, { static_cast<INT64>(format), offset });
+         m_commands.AddObject(NullRenderDevice::GetObjectID(indexBuffer));
+      }
+   }
+
+   void NullRenderContext::VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetShader, EShaderType::VertexShader);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(shader));
+      }
+   }
+
+   void NullRenderContext::PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetShader, EShaderType::PixelShader);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(shader));
+      }
+   }
+
+   void NullRenderContext::CSSetShader(ID3D11ComputeShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetShader, EShaderType::ComputeShader);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(shader));
+      }
+   }
+
+   void NullRenderContext::SetShaderResources(EShaderType stage, UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetShaderResources, stage, { startSlot, numViews });
+         RecordObjects(views, numViews);
+      }
+   }
+
+   void NullRenderContext::SetSamplers(EShaderType stage, UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetSamplers, stage, { startSlot, numSamplers });
+         RecordObjects(samplers, numSamplers);
+      }
+   }
+
+   void NullRenderContext::SetConstantBuffers(EShaderType stage, UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetConstantBuffers, stage, { startSlot, numBuffers });
+         RecordObjects(buffers, numBuffers);
+      }
+   }
+
+   void NullRenderContext::CSSetUnorderedAccessViews(UINT startSlot, UINT numUAVs, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetUnorderedAccessViews, EShaderType::ComputeShader, { startSlot, numUAVs });
+         RecordObjects(views, numUAVs);
+      }
+   }
+
+   void NullRenderContext::RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         if (numViewports > 0 && viewports != nullptr)
+         {
+            m_commands.Add(ERenderCommand::SetViewports, EShaderType::EnumSize, { numViewports },
+               { viewports[0].TopLeftX, viewports[0].TopLeftY, viewports[0].Width, viewports[0].Height });
+         }
+         else
+         {
+            m_commands.Add(ERenderCommand::SetViewports, EShaderType::EnumSize, { numViewports });
+         }
+      }
+   }
+
+   void NullRenderContext::RSSetState(ID3D11RasterizerState* state)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetRasterizerState);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(state));
+      }
+   }
+
+   void NullRenderContext::OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         /** Depth-stencil view is recorded as last object. */
+         m_commands.Add(ERenderCommand::SetRenderTargets, EShaderType::EnumSize, { numViews });
+         RecordObjects(renderTargetViews, numViews);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(depthStencilView));
+      }
+   }
+
+   void NullRenderContext::OMSetDepthStencilState(ID3D11DepthStencilState* state, UINT stencilRef)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::SetDepthStencilState, EShaderType::EnumSize, { stencilRef });
+         m_commands.AddObject(NullRenderDevice::GetObjectID(state));
+      }
+   }
+
+   void NullRenderContext::OMSetBlendState(ID3D11BlendState* state, const FLOAT blendFactor[4], UINT sampleMask)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         if (blendFactor != nullptr)
+         {
+            m_commands.Add(ERenderCommand::SetBlendState, EShaderType::EnumSize, { sampleMask },
+               { blendFactor[0], blendFactor[1], blendFactor[2], blendFactor[3] });
+         }
+         else
+         {
+            m_commands.Add(ERenderCommand::SetBlendState, EShaderType::EnumSize, { sampleMask });
+         }
+
+         m_commands.AddObject(NullRenderDevice::GetObjectID(state));
+      }
+   }
+
+   void NullRenderContext::ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4])
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::ClearRenderTarget, EShaderType::EnumSize, { },
+            { colorRGBA[0], colorRGBA[1], colorRGBA[2], colorRGBA[3] });
+         m_commands.AddObject(NullRenderDevice::GetObjectID(renderTargetView));
+      }
+   }
+
+   void NullRenderContext::ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::ClearDepthStencil, EShaderType::EnumSize, { clearFlags, stencil }, { depth });
+         m_commands.AddObject(NullRenderDevice::GetObjectID(depthStencilView));
+      }
+   }
+
+   void NullRenderContext::DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::DrawIndexed, EShaderType::EnumSize, { indexCount, startIndexLocation, baseVertexLocation });
+      }
+   }
+
+   void NullRenderContext::DrawIndexedInstanced(UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT baseVertexLocation, UINT startInstanceLocation)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::DrawIndexedInstanced, EShaderType::EnumSize,
+            { indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation });
+      }
+   }
+
+   void NullRenderContext::Dispatch(UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::Dispatch, EShaderType::EnumSize, { threadGroupCountX, threadGroupCountY, threadGroupCountZ });
+      }
+   }
+
+   HRESULT NullRenderContext::Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource)
+   {
+      if (resource == nullptr || mappedResource == nullptr || NullRenderDevice::GetObjectID(resource) == 0)
+      {
+         return E_INVALIDARG;
+      }
+
+      D3D11_RESOURCE_DIMENSION dimension = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+      resource->GetType(&dimension);
+      switch (dimension)
+      {
+      case D3D11_RESOURCE_DIMENSION_BUFFER:
+      {
+         auto buffer = static_cast<NullBuffer*>(static_cast<ID3D11Buffer*>(resource));
+         mappedResource->pData = buffer->GetMemory();
+         mappedResource->RowPitch = buffer->GetRowPitch();
+         mappedResource->DepthPitch = buffer->GetRowPitch();
+      }
+      break;
+      case D3D11_RESOURCE_DIMENSION_TEXTURE2D:
+      {
+         /** Only top level of first array slice is backed by memory. */
+         if (subresource != 0)
+         {
+            return E_INVALIDARG;
+         }
+
+         auto texture = static_cast<NullTexture2D*>(static_cast<ID3D11Texture2D*>(resource));
+         mappedResource->pData = texture->GetMemory();
+         mappedResource->RowPitch = texture->GetRowPitch();
+         mappedResource->DepthPitch = static_cast<UINT>(texture->GetSizeInBytes());
+      }
+      break;
+      default:
+         return E_INVALIDARG;
+      }
+
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::Map, EShaderType::EnumSize, { subresource, static_cast<INT64>(mapType) });
+         m_commands.AddObject(NullRenderDevice::GetObjectID(resource));
+      }
+
+      return S_OK;
+   }
+
+   void NullRenderContext::Unmap(ID3D11Resource* resource, UINT subresource)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::Unmap, EShaderType::EnumSize, { subresource });
+         m_commands.AddObject(NullRenderDevice::GetObjectID(resource));
+      }
+   }
+
+   void NullRenderContext::Begin(ID3D11Asynchronous* async)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::BeginQuery);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(async));
+      }
+   }
+
+   void NullRenderContext::End(ID3D11Asynchronous* async)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::EndQuery);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(async));
+      }
+   }
+
+   HRESULT NullRenderContext::GetData(ID3D11Asynchronous* async, void* data, UINT dataSize, UINT getDataFlags)
+   {
+      if (async == nullptr)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (data != nullptr && dataSize > 0)
+      {
+         if (dataSize < async->GetDataSize())
+         {
+            return E_INVALIDARG;
+         }
+
+         std::memset(data, 0, dataSize);
+         if (dataSize == sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT))
+         {
+            D3D11_QUERY_DESC desc;
+            static_cast<ID3D11Query*>(async)->GetDesc(&desc);
+            if (desc.Query == D3D11_QUERY_TIMESTAMP_DISJOINT)
+            {
+               auto disjointData = reinterpret_cast<D3D11_QUERY_DATA_TIMESTAMP_DISJOINT*>(data);
+               disjointData->Frequency = 1;
+               disjointData->Disjoint = TRUE;
+            }
+         }
+      }
+
+      return S_OK;
+   }
+
+   void NullRenderContext::GenerateMips(ID3D11ShaderResourceView* shaderResourceView)
+   {
+      if (m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::GenerateMips);
+         m_commands.AddObject(NullRenderDevice::GetObjectID(shaderResourceView));
+      }
+   }
+
+   HRESULT NullRenderContext::FinishCommandList(BOOL bRestoreDeferredContextState, ID3D11CommandList** commandList)
+   {
+      if (!m_bIsDeferred || commandList == nullptr)
+      {
+         return DXGI_ERROR_INVALID_CALL;
+      }
+
+      /** Command lists are not part of object ids of device, so golden streams do not depend on thread scheduling. */
+      auto nullCommandList = new NullCommandList(0);
+      std::swap(nullCommandList->GetCommandBuffer(), m_commands);
+      (*commandList) = nullCommandList;
+      return S_OK;
+   }
+
+   void NullRenderContext::ExecuteCommandList(ID3D11CommandList* commandList, BOOL bRestoreContextState)
+   {
+      if (commandList != nullptr && m_bIsRecordingEnabled)
+      {
+         m_commands.Add(ERenderCommand::ExecuteCommandList);
+         m_commands.Append(static_cast<NullCommandList*>(commandList)->GetCommandBuffer());
+      }
+   }
+
+   NullRenderDevice::NullRenderDevice() :
+      m_latestObjectID(0),
+      m_immediateContext(new NullRenderContext(false)),
+      m_maximumBufferSize(0)
+   {
+   }
+
+   NullRenderDevice::~NullRenderDevice()
+   {
+      SafeDelete(m_immediateContext);
+   }
+
+   RenderContext* NullRenderDevice::CreateDeferredContext()
+   {
+      auto deferredContext = new NullRenderContext(true);
+      deferredContext->SetRecordingEnabled(m_immediateContext->IsRecordingEnabled());
+      return deferredContext;
+   }
+
+   HRESULT NullRenderDevice::CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Buffer** buffer)
+   {
+      if (desc == nullptr || desc->ByteWidth == 0)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (m_maximumBufferSize > 0 && desc->ByteWidth > m_maximumBufferSize)
+      {
+         return E_OUTOFMEMORY;
+      }
+
+      if (buffer == nullptr)
+      {
+         return S_FALSE;
+      }
+
+      auto nullBuffer = new NullBuffer(NextObjectID(), *desc, desc->ByteWidth, desc->ByteWidth);
+      if (initialData != nullptr && initialData->pSysMem != nullptr)
+      {
+         std::memcpy(nullBuffer->GetMemory(), initialData->pSysMem, desc->ByteWidth);
+      }
+
+      (*buffer) = nullBuffer;
+      return S_OK;
+   }
+
+   HRESULT NullRenderDevice::CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture2D** texture2D)
+   {
+      if (desc == nullptr || desc->Width == 0 || desc->Height == 0)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (texture2D == nullptr)
+      {
+         return S_FALSE;
+      }
+
+      UINT rowPitch = desc->Width * ColorFormatToBytesPerPixel(static_cast<EColorFormat>(desc->Format));
+      (*texture2D) = new NullTexture2D(NextObjectID(), *desc, rowPitch, static_cast<size_t>(rowPitch) * desc->Height);
+      return S_OK;
+   }
+
+   template <typename Interface, typename Desc>
+   static HRESULT CreateNullView(UINT64 id, ID3D11Resource* resource, const Desc* desc, Interface** view)
+   {
+      if (resource == nullptr)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (view == nullptr)
+      {
+         return S_FALSE;
+      }
+
+      Desc viewDesc;
+      if (desc != nullptr)
+      {
+         viewDesc = (*desc);
+      }
+      else
+      {
+         ZeroMemory(&viewDesc, sizeof(Desc));
+      }
+
+      (*view) = new NullView<Interface, Desc>(id, resource, viewDesc);
+      return S_OK;
+   }
+
+   HRESULT NullRenderDevice::CreateShaderResourceView(ID3D11Resource* resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* desc, ID3D11ShaderResourceView** view)
+   {
+      return CreateNullView(NextObjectID(), resource, desc, view);
+   }
+
+   HRESULT NullRenderDevice::CreateUnorderedAccessView(ID3D11Resource* resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* desc, ID3D11UnorderedAccessView** view)
+   {
+      return CreateNullView(NextObjectID(), resource, desc, view);
+   }
+
+   HRESULT NullRenderDevice::CreateRenderTargetView(ID3D11Resource* resource, const D3D11_RENDER_TARGET_VIEW_DESC* desc, ID3D11RenderTargetView** view)
+   {
+      return CreateNullView(NextObjectID(), resource, desc, view);
+   }
+
+   HRESULT NullRenderDevice::CreateDepthStencilView(ID3D11Resource* resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* desc, ID3D11DepthStencilView** view)
+   {
+      return CreateNullView(NextObjectID(), resource, desc, view);
+   }
+
+   HRESULT NullRenderDevice::CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* inputElementDescs, UINT numElements, const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11InputLayout** inputLayout)
+   {
+      if (inputElementDescs == nullptr || numElements == 0)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (inputLayout == nullptr)
+      {
+         return S_FALSE;
+      }
+
+      (*inputLayout) = new NullDeviceChild<ID3D11InputLayout>(NextObjectID());
+      return S_OK;
+   }
+
+   template <typename Interface>
+   static HRESULT CreateNullShader(UINT64 id, const void* shaderBytecode, SIZE_T bytecodeLength, Interface** shader)
+   {
+      if (shaderBytecode == nullptr || bytecodeLength == 0)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (shader == nullptr)
+      {
+         return S_FALSE;
+      }
+
+      (*shader) = new NullDeviceChild<Interface>(id);
+      return S_OK;
+   }
+
+   HRESULT NullRenderDevice::CreateVertexShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11VertexShader** shader)
+   {
+      return CreateNullShader(NextObjectID(), shaderBytecode, bytecodeLength, shader);
+   }
+
+   HRESULT NullRenderDevice::CreatePixelShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11PixelShader** shader)
+   {
+      return CreateNullShader(NextObjectID(), shaderBytecode, bytecodeLength, shader);
+   }
+
+   HRESULT NullRenderDevice::CreateComputeShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11ComputeShader** shader)
+   {
+      return CreateNullShader(NextObjectID(), shaderBytecode, bytecodeLength, shader);
+   }
+
+   template <typename Interface, typename Desc>
+   static HRESULT CreateNullState(UINT64 id, const Desc* desc, Interface** state)
+   {
+      if (desc == nullptr)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (state == nullptr)
+      {
+         return S_FALSE;
+      }
+
+      (*state) = new NullState<Interface, Desc>(id, *desc);
+      return S_OK;
+   }
+
+   HRESULT NullRenderDevice::CreateBlendState(const D3D11_BLEND_DESC* desc, ID3D11BlendState** state)
+   {
+      return CreateNullState(NextObjectID(), desc, state);
+   }
+
+   HRESULT NullRenderDevice::CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* desc, ID3D11DepthStencilState** state)
+   {
+      return CreateNullState(NextObjectID(), desc, state);
+   }
+
+   HRESULT NullRenderDevice::CreateRasterizerState(const D3D11_RASTERIZER_DESC* desc, ID3D11RasterizerState** state)
+   {
+      return CreateNullState(NextObjectID(), desc, state);
+   }
+
+   HRESULT NullRenderDevice::CreateSamplerState(const D3D11_SAMPLER_DESC* desc, ID3D11SamplerState** state)
+   {
+      return CreateNullState(NextObjectID(), desc, state);
+   }
+
+   HRESULT NullRenderDevice::CreateQuery(const D3D11_QUERY_DESC* desc, ID3D11Query** query)
+   {
+      if (desc == nullptr)
+      {
+         return E_INVALIDARG;
+      }
+
+      if (query == nullptr)
+      {
+         return S_FALSE;
+      }
+
+      (*query) = new NullQuery(NextObjectID(), *desc);
+      return S_OK;
+   }
+
+   UINT64 NullRenderDevice::GetObjectID(ID3D11DeviceChild* object)
+   {
+      UINT64 objectID = 0;
+      if (object != nullptr)
+      {
+         UINT dataSize = sizeof(UINT64);
+         if (FAILED(object->GetPrivateData(NULL_RENDER_OBJECT_ID_GUID, &dataSize, &objectID)))
+         {
+            objectID = 0;
+         }
+      }
+
+      return objectID;
+   }
+}
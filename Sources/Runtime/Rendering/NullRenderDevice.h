@@ -0,0 +1,235 @@
+#pragma once
+#include "Rendering/RenderDevice.h"
+
+namespace Mile
+{
+   enum class MEAPI ERenderCommand : UINT8
+   {
+      ClearState,
+      SetPrimitiveTopology,
+      SetInputLayout,
+      SetVertexBuffers,
+      SetIndexBuffer,
+      SetShader,
+      SetShaderResources,
+      SetSamplers,
+      SetConstantBuffers,
+      SetUnorderedAccessViews,
+      SetViewports,
+      SetRasterizerState,
+      SetRenderTargets,
+      SetDepthStencilState,
+      SetBlendState,
+      ClearRenderTarget,
+      ClearDepthStencil,
+      DrawIndexed,
+      DrawIndexedInstanced,
+      Dispatch,
+      Map,
+      Unmap,
+      BeginQuery,
+      EndQuery,
+      GenerateMips,
+      ExecuteCommandList,
+      EnumSize
+   };
+
+   constexpr size_t MAXIMUM_RENDER_COMMAND_ARGS = 5;
+   constexpr size_t MAXIMUM_RENDER_COMMAND_VALUES = 4;
+
+   struct MEAPI RenderCommand
+   {
+      ERenderCommand Type = ERenderCommand::ClearState;
+      /** Shader stage of per-stage commands, EnumSize if command does not belong to stage. */
+      EShaderType Stage = EShaderType::EnumSize;
+      UINT8 NumArgs = 0;
+      UINT8 NumValues = 0;
+      /** Integral arguments. (ex. Start slot, Index count) */
+      INT64 Args[MAXIMUM_RENDER_COMMAND_ARGS] = { 0, };
+      /** Floating point arguments. (ex. Clear color, Viewport) */
+      float Values[MAXIMUM_RENDER_COMMAND_VALUES] = { 0.0f, };
+      /** Range of object ids inside of command buffer. */
+      UINT32 FirstObject = 0;
+      UINT32 NumObjects = 0;
+   };
+
+   /**
+    * @brief   Sequence of commands which have been recorded by null render context.
+    *          Objects are referenced by id which is given in creation order (0 = nullptr),
+    *          so serialized command stream is deterministic and can be compared against golden files.
+    */
+   class MEAPI RenderCommandBuffer
+   {
+   public:
+      RenderCommand& Add(ERenderCommand type, EShaderType stage = EShaderType::EnumSize, std::initializer_list<INT64> args = { }, std::initializer_list<float> values = { });
+      /** Append object id to latest command. */
+      void AddObject(UINT64 objectID);
+      void Append(const RenderCommandBuffer& other);
+      void Clear();
+
+      bool IsEmpty() const { return m_commands.empty(); }
+      size_t GetCommandCount() const { return m_commands.size(); }
+      const std::vector<RenderCommand>& GetCommands() const { return m_commands; }
+      UINT64 GetObjectID(const RenderCommand& command, size_t idx) const { return m_objects[command.FirstObject + idx]; }
+      size_t CountCommands(ERenderCommand type) const;
+
+      /** One command per line. (ex. "SetShaderResources PS 0 2 [#12 null]") */
+      std::string Serialize() const;
+      bool WriteToFile(const String& filePath) const;
+
+      static const char* CommandToString(ERenderCommand type);
+
+   private:
+      std::vector<RenderCommand> m_commands;
+      std::vector<UINT64> m_objects;
+
+   };
+
+   /**
+    * @brief   Render context which does not touch GPU. Commands are recorded into command buffer instead.
+    *          Deferred context moves its commands into command list on FinishCommandList,
+    *          and executing the command list appends them to immediate context in submission order.
+    */
+   class MEAPI NullRenderContext : public RenderContext
+   {
+   public:
+      NullRenderContext(bool bIsDeferred);
+      virtual ~NullRenderContext() = default;
+
+      bool IsDeferred() const { return m_bIsDeferred; }
+
+      RenderCommandBuffer& GetCommandBuffer() { return m_commands; }
+      const RenderCommandBuffer& GetCommandBuffer() const { return m_commands; }
+
+      /** If recording is disabled, commands are validated and discarded. (ex. Measure CPU cost of renderer without memory growth) */
+      void SetRecordingEnabled(bool bEnabled) { m_bIsRecordingEnabled = bEnabled; }
+      bool IsRecordingEnabled() const { return m_bIsRecordingEnabled; }
+
+      virtual void ClearState() override;
+
+      virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) override;
+      virtual void IASetInputLayout(ID3D11InputLayout* inputLayout) override;
+      virtual void IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets) override;
+      virtual void IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset) override;
+
+      virtual void VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override;
+      virtual void PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override;
+      virtual void CSSetShader(ID3D11ComputeShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override;
+
+      virtual void VSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { SetShaderResources(EShaderType::VertexShader, startSlot, numViews, views); }
+      virtual void HSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { SetShaderResources(EShaderType::HullShader, startSlot, numViews, views); }
+      virtual void DSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { SetShaderResources(EShaderType::DomainShader, startSlot, numViews, views); }
+      virtual void GSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { SetShaderResources(EShaderType::GeometryShader, startSlot, numViews, views); }
+      virtual void PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { SetShaderResources(EShaderType::PixelShader, startSlot, numViews, views); }
+      virtual void CSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { SetShaderResources(EShaderType::ComputeShader, startSlot, numViews, views); }
+
+      virtual void VSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { SetSamplers(EShaderType::VertexShader, startSlot, numSamplers, samplers); }
+      virtual void HSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { SetSamplers(EShaderType::HullShader, startSlot, numSamplers, samplers); }
+      virtual void DSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { SetSamplers(EShaderType::DomainShader, startSlot, numSamplers, samplers); }
+      virtual void GSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { SetSamplers(EShaderType::GeometryShader, startSlot, numSamplers, samplers); }
+      virtual void PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { SetSamplers(EShaderType::PixelShader, startSlot, numSamplers, samplers); }
+      virtual void CSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { SetSamplers(EShaderType::ComputeShader, startSlot, numSamplers, samplers); }
+
+      virtual void VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { SetConstantBuffers(EShaderType::VertexShader, startSlot, numBuffers, buffers); }
+      virtual void HSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { SetConstantBuffers(EShaderType::HullShader, startSlot, numBuffers, buffers); }
+      virtual void DSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { SetConstantBuffers(EShaderType::DomainShader, startSlot, numBuffers, buffers); }
+      virtual void GSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { SetConstantBuffers(EShaderType::GeometryShader, startSlot, numBuffers, buffers); }
+      virtual void PSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { SetConstantBuffers(EShaderType::PixelShader, startSlot, numBuffers, buffers); }
+      virtual void CSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { SetConstantBuffers(EShaderType::ComputeShader, startSlot, numBuffers, buffers); }
+
+      virtual void CSSetUnorderedAccessViews(UINT startSlot, UINT numUAVs, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts) override;
+
+      virtual void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports) override;
+      virtual void RSSetState(ID3D11RasterizerState* state) override;
+
+      virtual void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView) override;
+      virtual void OMSetDepthStencilState(ID3D11DepthStencilState* state, UINT stencilRef) override;
+      virtual void OMSetBlendState(ID3D11BlendState* state, const FLOAT blendFactor[4], UINT sampleMask) override;
+
+      virtual void ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4]) override;
+      virtual void ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil) override;
+
+      virtual void DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation) override;
+      virtual void DrawIndexedInstanced(UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT baseVertexLocation, UINT startInstanceLocation) override;
+      virtual void Dispatch(UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ) override;
+
+      /** Mapped memory is backed by system memory of null resource. */
+      virtual HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource) override;
+      virtual void Unmap(ID3D11Resource* resource, UINT subresource) override;
+
+      virtual void Begin(ID3D11Asynchronous* async) override;
+      virtual void End(ID3D11Asynchronous* async) override;
+      /** Results are always available and zero filled. Timestamp disjoint query reports disjoint, so GPU profiler discards timings. */
+      virtual HRESULT GetData(ID3D11Asynchronous* async, void* data, UINT dataSize, UINT getDataFlags) override;
+
+      virtual void GenerateMips(ID3D11ShaderResourceView* shaderResourceView) override;
+
+      virtual HRESULT FinishCommandList(BOOL bRestoreDeferredContextState, ID3D11CommandList** commandList) override;
+      virtual void ExecuteCommandList(ID3D11CommandList* commandList, BOOL bRestoreContextState) override;
+
+   private:
+      void SetShaderResources(EShaderType stage, UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views);
+      void SetSamplers(EShaderType stage, UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers);
+      void SetConstantBuffers(EShaderType stage, UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers);
+
+      template <typename Ty>
+      void RecordObjects(Ty* const* objects, UINT numObjects);
+
+   private:
+      bool m_bIsDeferred;
+      bool m_bIsRecordingEnabled;
+      RenderCommandBuffer m_commands;
+
+   };
+
+   /**
+    * @brief   Render device which does not require GPU. Every object is created as null object which only keeps its descriptor,
+    *          so render objects, frame graph and render passes can be executed headless. (ex. CPU timing, golden command stream tests)
+    */
+   class MEAPI NullRenderDevice : public RenderDevice
+   {
+   public:
+      NullRenderDevice();
+      virtual ~NullRenderDevice();
+
+      virtual RenderContext& GetImmediateContext() override { return (*m_immediateContext); }
+      NullRenderContext& GetNullImmediateContext() { return (*m_immediateContext); }
+      virtual RenderContext* CreateDeferredContext() override;
+
+      virtual HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Buffer** buffer) override;
+      virtual HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture2D** texture2D) override;
+
+      virtual HRESULT CreateShaderResourceView(ID3D11Resource* resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* desc, ID3D11ShaderResourceView** view) override;
+      virtual HRESULT CreateUnorderedAccessView(ID3D11Resource* resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* desc, ID3D11UnorderedAccessView** view) override;
+      virtual HRESULT CreateRenderTargetView(ID3D11Resource* resource, const D3D11_RENDER_TARGET_VIEW_DESC* desc, ID3D11RenderTargetView** view) override;
+      virtual HRESULT CreateDepthStencilView(ID3D11Resource* resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* desc, ID3D11DepthStencilView** view) override;
+
+      virtual HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* inputElementDescs, UINT numElements, const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11InputLayout** inputLayout) override;
+      virtual HRESULT CreateVertexShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11VertexShader** shader) override;
+      virtual HRESULT CreatePixelShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11PixelShader** shader) override;
+      virtual HRESULT CreateComputeShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11ComputeShader** shader) override;
+
+      virtual HRESULT CreateBlendState(const D3D11_BLEND_DESC* desc, ID3D11BlendState** state) override;
+      virtual HRESULT CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* desc, ID3D11DepthStencilState** state) override;
+      virtual HRESULT CreateRasterizerState(const D3D11_RASTERIZER_DESC* desc, ID3D11RasterizerState** state) override;
+      virtual HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC* desc, ID3D11SamplerState** state) override;
+
+      virtual HRESULT CreateQuery(const D3D11_QUERY_DESC* desc, ID3D11Query** query) override;
+
+      /** Creating buffer larger than limit fails with E_OUTOFMEMORY, 0 if there is no limit. (ex. Test fallback path of renderer) */
+      void SetMaximumBufferSize(size_t size) { m_maximumBufferSize = size; }
+      size_t GetMaximumBufferSize() const { return m_maximumBufferSize; }
+
+      /** Id of object which has been created by null render device, 0 if object is nullptr or not a null object. */
+      static UINT64 GetObjectID(ID3D11DeviceChild* object);
+
+   private:
+      UINT64 NextObjectID() { return ++m_latestObjectID; }
+
+   private:
+      std::atomic<UINT64> m_latestObjectID;
+      NullRenderContext* m_immediateContext;
+      size_t m_maximumBufferSize;
+
+   };
+}
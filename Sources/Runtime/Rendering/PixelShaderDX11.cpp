@@ -38,7 +38,7 @@ namespace Mile
       return false;
    }
 
-   bool PixelShaderDX11::Bind(ID3D11DeviceContext& deviceContext)
+   bool PixelShaderDX11::Bind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -52,7 +52,7 @@ namespace Mile
       return false;
    }
 
-   void PixelShaderDX11::Unbind(ID3D11DeviceContext& deviceContext)
+   void PixelShaderDX11::Unbind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -11,8 +11,8 @@ namespace Mile
       virtual ~PixelShaderDX11();
 
       virtual bool Init(const String& shaderPath) override;
-      virtual bool Bind(ID3D11DeviceContext& deviceContext) override;
-      virtual void Unbind(ID3D11DeviceContext& deviceContext) override;
+      virtual bool Bind(RenderContext& deviceContext) override;
+      virtual void Unbind(RenderContext& deviceContext) override;
 
       virtual EShaderType GetShaderType() const override { return EShaderType::PixelShader; }
 
@@ -71,7 +71,7 @@ namespace Mile
       return false;
    }
 
-   bool RasterizerState::Bind(ID3D11DeviceContext& deviceContext)
+   bool RasterizerState::Bind(RenderContext& deviceContext)
    {
       if (IsBindable())
       {
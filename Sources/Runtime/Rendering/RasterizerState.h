@@ -14,7 +14,7 @@ namespace Mile
       virtual ~RasterizerState();
 
       bool Init();
-      bool Bind(ID3D11DeviceContext& deviceContext);
+      bool Bind(RenderContext& deviceContext);
 
       /**
        * @brief	Mesh  ü  ̾  · ׸ մϴ.
@@ -0,0 +1,38 @@
+#include "Rendering/RenderDevice.h"
+
+namespace Mile
+{
+   RenderContextDX11::RenderContextDX11(ID3D11DeviceContext* context) :
+      m_context(context)
+   {
+   }
+
+   RenderContextDX11::~RenderContextDX11()
+   {
+      SafeRelease(m_context);
+   }
+
+   RenderDeviceDX11::RenderDeviceDX11(ID3D11Device* device, ID3D11DeviceContext* immediateContext) :
+      m_device(device),
+      m_immediateContext(new RenderContextDX11(immediateContext))
+   {
+   }
+
+   RenderDeviceDX11::~RenderDeviceDX11()
+   {
+      /** Immediate context has to be released before device. */
+      SafeDelete(m_immediateContext);
+      SafeRelease(m_device);
+   }
+
+   RenderContext* RenderDeviceDX11::CreateDeferredContext()
+   {
+      ID3D11DeviceContext* deferredContext = nullptr;
+      if (FAILED(m_device->CreateDeferredContext(0, &deferredContext)))
+      {
+         return nullptr;
+      }
+
+      return new RenderContextDX11(deferredContext);
+   }
+}
@@ -0,0 +1,231 @@
+#pragma once
+#include "Rendering/RenderingCore.h"
+
+namespace Mile
+{
+   /**
+    * @brief   Device context which is used by renderer and every *DX11 render objects.
+    *          Functions are equivalent to subset of ID3D11DeviceContext which is used by engine,
+    *          so the backend can be replaced without touching render passes. (ex. Null backend for headless rendering)
+    */
+   class MEAPI RenderContext
+   {
+   public:
+      virtual ~RenderContext() = default;
+
+      /** @return   nullptr if backend does not use D3D11 device context. */
+      virtual ID3D11DeviceContext* GetNative() const { return nullptr; }
+
+      virtual void ClearState() = 0;
+
+      virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) = 0;
+      virtual void IASetInputLayout(ID3D11InputLayout* inputLayout) = 0;
+      virtual void IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets) = 0;
+      virtual void IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset) = 0;
+
+      virtual void VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) = 0;
+      virtual void PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) = 0;
+      virtual void CSSetShader(ID3D11ComputeShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) = 0;
+
+      virtual void VSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) = 0;
+      virtual void HSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) = 0;
+      virtual void DSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) = 0;
+      virtual void GSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) = 0;
+      virtual void PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) = 0;
+      virtual void CSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) = 0;
+
+      virtual void VSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) = 0;
+      virtual void HSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) = 0;
+      virtual void DSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) = 0;
+      virtual void GSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) = 0;
+      virtual void PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) = 0;
+      virtual void CSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) = 0;
+
+      virtual void VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) = 0;
+      virtual void HSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) = 0;
+      virtual void DSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) = 0;
+      virtual void GSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) = 0;
+      virtual void PSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) = 0;
+      virtual void CSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) = 0;
+
+      virtual void CSSetUnorderedAccessViews(UINT startSlot, UINT numUAVs, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts) = 0;
+
+      virtual void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports) = 0;
+      virtual void RSSetState(ID3D11RasterizerState* state) = 0;
+
+      virtual void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView) = 0;
+      virtual void OMSetDepthStencilState(ID3D11DepthStencilState* state, UINT stencilRef) = 0;
+      virtual void OMSetBlendState(ID3D11BlendState* state, const FLOAT blendFactor[4], UINT sampleMask) = 0;
+
+      virtual void ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4]) = 0;
+      virtual void ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil) = 0;
+
+      virtual void DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation) = 0;
+      virtual void DrawIndexedInstanced(UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT baseVertexLocation, UINT startInstanceLocation) = 0;
+      virtual void Dispatch(UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ) = 0;
+
+      virtual HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource) = 0;
+      virtual void Unmap(ID3D11Resource* resource, UINT subresource) = 0;
+
+      virtual void Begin(ID3D11Asynchronous* async) = 0;
+      virtual void End(ID3D11Asynchronous* async) = 0;
+      virtual HRESULT GetData(ID3D11Asynchronous* async, void* data, UINT dataSize, UINT getDataFlags) = 0;
+
+      virtual void GenerateMips(ID3D11ShaderResourceView* shaderResourceView) = 0;
+
+      virtual HRESULT FinishCommandList(BOOL bRestoreDeferredContextState, ID3D11CommandList** commandList) = 0;
+      virtual void ExecuteCommandList(ID3D11CommandList* commandList, BOOL bRestoreContextState) = 0;
+   };
+
+   /**
+    * @brief   Creates render objects and device contexts. Functions are equivalent to subset of ID3D11Device which is used by engine.
+    *          Created objects are D3D11 interfaces, so the ownership rule is same as D3D11. (Release through SafeRelease)
+    */
+   class MEAPI RenderDevice
+   {
+   public:
+      virtual ~RenderDevice() = default;
+
+      /** @return   nullptr if backend does not use D3D11 device. */
+      virtual ID3D11Device* GetNative() const { return nullptr; }
+
+      /** Immediate context is owned by device. */
+      virtual RenderContext& GetImmediateContext() = 0;
+      /** @return   Deferred context which is owned by caller, nullptr if failed. */
+      virtual RenderContext* CreateDeferredContext() = 0;
+
+      virtual HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Buffer** buffer) = 0;
+      virtual HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture2D** texture2D) = 0;
+
+      virtual HRESULT CreateShaderResourceView(ID3D11Resource* resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* desc, ID3D11ShaderResourceView** view) = 0;
+      virtual HRESULT CreateUnorderedAccessView(ID3D11Resource* resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* desc, ID3D11UnorderedAccessView** view) = 0;
+      virtual HRESULT CreateRenderTargetView(ID3D11Resource* resource, const D3D11_RENDER_TARGET_VIEW_DESC* desc, ID3D11RenderTargetView** view) = 0;
+      virtual HRESULT CreateDepthStencilView(ID3D11Resource* resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* desc, ID3D11DepthStencilView** view) = 0;
+
+      virtual HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* inputElementDescs, UINT numElements, const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11InputLayout** inputLayout) = 0;
+      virtual HRESULT CreateVertexShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11VertexShader** shader) = 0;
+      virtual HRESULT CreatePixelShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11PixelShader** shader) = 0;
+      virtual HRESULT CreateComputeShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11ComputeShader** shader) = 0;
+
+      virtual HRESULT CreateBlendState(const D3D11_BLEND_DESC* desc, ID3D11BlendState** state) = 0;
+      virtual HRESULT CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* desc, ID3D11DepthStencilState** state) = 0;
+      virtual HRESULT CreateRasterizerState(const D3D11_RASTERIZER_DESC* desc, ID3D11RasterizerState** state) = 0;
+      virtual HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC* desc, ID3D11SamplerState** state) = 0;
+
+      virtual HRESULT CreateQuery(const D3D11_QUERY_DESC* desc, ID3D11Query** query) = 0;
+   };
+
+   /** Device context which forwards every call to D3D11 device context. */
+   class MEAPI RenderContextDX11 : public RenderContext
+   {
+   public:
+      /** Takes ownership of given device context. */
+      RenderContextDX11(ID3D11DeviceContext* context);
+      virtual ~RenderContextDX11();
+
+      virtual ID3D11DeviceContext* GetNative() const override { return m_context; }
+
+      virtual void ClearState() override { m_context->ClearState(); }
+
+      virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) override { m_context->IASetPrimitiveTopology(topology); }
+      virtual void IASetInputLayout(ID3D11InputLayout* inputLayout) override { m_context->IASetInputLayout(inputLayout); }
+      virtual void IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets) override { m_context->IASetVertexBuffers(startSlot, numBuffers, vertexBuffers, strides, offsets); }
+      virtual void IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset) override { m_context->IASetIndexBuffer(indexBuffer, format, offset); }
+
+      virtual void VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override { m_context->VSSetShader(shader, classInstances, numClassInstances); }
+      virtual void PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override { m_context->PSSetShader(shader, classInstances, numClassInstances); }
+      virtual void CSSetShader(ID3D11ComputeShader* shader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override { m_context->CSSetShader(shader, classInstances, numClassInstances); }
+
+      virtual void VSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { m_context->VSSetShaderResources(startSlot, numViews, views); }
+      virtual void HSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { m_context->HSSetShaderResources(startSlot, numViews, views); }
+      virtual void DSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { m_context->DSSetShaderResources(startSlot, numViews, views); }
+      virtual void GSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { m_context->GSSetShaderResources(startSlot, numViews, views); }
+      virtual void PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { m_context->PSSetShaderResources(startSlot, numViews, views); }
+      virtual void CSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* views) override { m_context->CSSetShaderResources(startSlot, numViews, views); }
+
+      virtual void VSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { m_context->VSSetSamplers(startSlot, numSamplers, samplers); }
+      virtual void HSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { m_context->HSSetSamplers(startSlot, numSamplers, samplers); }
+      virtual void DSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { m_context->DSSetSamplers(startSlot, numSamplers, samplers); }
+      virtual void GSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { m_context->GSSetSamplers(startSlot, numSamplers, samplers); }
+      virtual void PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { m_context->PSSetSamplers(startSlot, numSamplers, samplers); }
+      virtual void CSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override { m_context->CSSetSamplers(startSlot, numSamplers, samplers); }
+
+      virtual void VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { m_context->VSSetConstantBuffers(startSlot, numBuffers, buffers); }
+      virtual void HSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { m_context->HSSetConstantBuffers(startSlot, numBuffers, buffers); }
+      virtual void DSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { m_context->DSSetConstantBuffers(startSlot, numBuffers, buffers); }
+      virtual void GSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { m_context->GSSetConstantBuffers(startSlot, numBuffers, buffers); }
+      virtual void PSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { m_context->PSSetConstantBuffers(startSlot, numBuffers, buffers); }
+      virtual void CSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* buffers) override { m_context->CSSetConstantBuffers(startSlot, numBuffers, buffers); }
+
+      virtual void CSSetUnorderedAccessViews(UINT startSlot, UINT numUAVs, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts) override { m_context->CSSetUnorderedAccessViews(startSlot, numUAVs, views, initialCounts); }
+
+      virtual void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports) override { m_context->RSSetViewports(numViewports, viewports); }
+      virtual void RSSetState(ID3D11RasterizerState* state) override { m_context->RSSetState(state); }
+
+      virtual void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView) override { m_context->OMSetRenderTargets(numViews, renderTargetViews, depthStencilView); }
+      virtual void OMSetDepthStencilState(ID3D11DepthStencilState* state, UINT stencilRef) override { m_context->OMSetDepthStencilState(state, stencilRef); }
+      virtual void OMSetBlendState(ID3D11BlendState* state, const FLOAT blendFactor[4], UINT sampleMask) override { m_context->OMSetBlendState(state, blendFactor, sampleMask); }
+
+      virtual void ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4]) override { m_context->ClearRenderTargetView(renderTargetView, colorRGBA); }
+      virtual void ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil) override { m_context->ClearDepthStencilView(depthStencilView, clearFlags, depth, stencil); }
+
+      virtual void DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation) override { m_context->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation); }
+      virtual void DrawIndexedInstanced(UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT baseVertexLocation, UINT startInstanceLocation) override { m_context->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation); }
+      virtual void Dispatch(UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ) override { m_context->Dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ); }
+
+      virtual HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource) override { return m_context->Map(resource, subresource, mapType, mapFlags, mappedResource); }
+      virtual void Unmap(ID3D11Resource* resource, UINT subresource) override { m_context->Unmap(resource, subresource); }
+
+      virtual void Begin(ID3D11Asynchronous* async) override { m_context->Begin(async); }
+      virtual void End(ID3D11Asynchronous* async) override { m_context->End(async); }
+      virtual HRESULT GetData(ID3D11Asynchronous* async, void* data, UINT dataSize, UINT getDataFlags) override { return m_context->GetData(async, data, dataSize, getDataFlags); }
+
+      virtual void GenerateMips(ID3D11ShaderResourceView* shaderResourceView) override { m_context->GenerateMips(shaderResourceView); }
+
+      virtual HRESULT FinishCommandList(BOOL bRestoreDeferredContextState, ID3D11CommandList** commandList) override { return m_context->FinishCommandList(bRestoreDeferredContextState, commandList); }
+      virtual void ExecuteCommandList(ID3D11CommandList* commandList, BOOL bRestoreContextState) override { m_context->ExecuteCommandList(commandList, bRestoreContextState); }
+
+   private:
+      ID3D11DeviceContext* m_context;
+
+   };
+
+   /** Device which forwards every call to D3D11 device. */
+   class MEAPI RenderDeviceDX11 : public RenderDevice
+   {
+   public:
+      /** Takes ownership of given device and immediate context. */
+      RenderDeviceDX11(ID3D11Device* device, ID3D11DeviceContext* immediateContext);
+      virtual ~RenderDeviceDX11();
+
+      virtual ID3D11Device* GetNative() const override { return m_device; }
+
+      virtual RenderContext& GetImmediateContext() override { return (*m_immediateContext); }
+      virtual RenderContext* CreateDeferredContext() override;
+
+      virtual HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Buffer** buffer) override { return m_device->CreateBuffer(desc, initialData, buffer); }
+      virtual HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture2D** texture2D) override { return m_device->CreateTexture2D(desc, initialData, texture2D); }
+
+      virtual HRESULT CreateShaderResourceView(ID3D11Resource* resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* desc, ID3D11ShaderResourceView** view) override { return m_device->CreateShaderResourceView(resource, desc, view); }
+      virtual HRESULT CreateUnorderedAccessView(ID3D11Resource* resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* desc, ID3D11UnorderedAccessView** view) override { return m_device->CreateUnorderedAccessView(resource, desc, view); }
+      virtual HRESULT CreateRenderTargetView(ID3D11Resource* resource, const D3D11_RENDER_TARGET_VIEW_DESC* desc, ID3D11RenderTargetView** view) override { return m_device->CreateRenderTargetView(resource, desc, view); }
+      virtual HRESULT CreateDepthStencilView(ID3D11Resource* resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* desc, ID3D11DepthStencilView** view) override { return m_device->CreateDepthStencilView(resource, desc, view); }
+
+      virtual HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* inputElementDescs, UINT numElements, const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11InputLayout** inputLayout) override { return m_device->CreateInputLayout(inputElementDescs, numElements, shaderBytecode, bytecodeLength, inputLayout); }
+      virtual HRESULT CreateVertexShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11VertexShader** shader) override { return m_device->CreateVertexShader(shaderBytecode, bytecodeLength, classLinkage, shader); }
+      virtual HRESULT CreatePixelShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11PixelShader** shader) override { return m_device->CreatePixelShader(shaderBytecode, bytecodeLength, classLinkage, shader); }
+      virtual HRESULT CreateComputeShader(const void* shaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* classLinkage, ID3D11ComputeShader** shader) override { return m_device->CreateComputeShader(shaderBytecode, bytecodeLength, classLinkage, shader); }
+
+      virtual HRESULT CreateBlendState(const D3D11_BLEND_DESC* desc, ID3D11BlendState** state) override { return m_device->CreateBlendState(desc, state); }
+      virtual HRESULT CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* desc, ID3D11DepthStencilState** state) override { return m_device->CreateDepthStencilState(desc, state); }
+      virtual HRESULT CreateRasterizerState(const D3D11_RASTERIZER_DESC* desc, ID3D11RasterizerState** state) override { return m_device->CreateRasterizerState(desc, state); }
+      virtual HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC* desc, ID3D11SamplerState** state) override { return m_device->CreateSamplerState(desc, state); }
+
+      virtual HRESULT CreateQuery(const D3D11_QUERY_DESC* desc, ID3D11Query** query) override { return m_device->CreateQuery(desc, query); }
+
+   private:
+      ID3D11Device* m_device;
+      RenderContextDX11* m_immediateContext;
+
+   };
+}
@@ -17,6 +17,12 @@ namespace Mile
 
    bool RenderObject::HasAvailableRenderer() const
    {
+      /** Renderer which is not owned by engine(ex. Headless renderer of benchmark) outlives its render objects. */
+      if (Engine::GetInstance() == nullptr)
+      {
+         return (m_renderer != nullptr);
+      }
+
       return (m_renderer != nullptr) && (Engine::GetRenderer() == m_renderer);
    }
 }
\ No newline at end of file
@@ -133,7 +133,7 @@ namespace Mile
       }
    }
 
-   bool RenderTargetDX11::BindRenderTargetView(ID3D11DeviceContext& deviceContext)
+   bool RenderTargetDX11::BindRenderTargetView(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -150,7 +150,7 @@ namespace Mile
       return false;
    }
 
-   bool RenderTargetDX11::BindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
+   bool RenderTargetDX11::BindShaderResourceView(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
    {
       if (RenderObject::IsBindable())
       {
@@ -160,7 +160,7 @@ namespace Mile
       return false;
    }
 
-   void RenderTargetDX11::UnbindRenderTargetView(ID3D11DeviceContext& deviceContext)
+   void RenderTargetDX11::UnbindRenderTargetView(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -169,7 +169,7 @@ namespace Mile
       }
    }
 
-   void RenderTargetDX11::UnbindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType boundShader)
+   void RenderTargetDX11::UnbindShaderResourceView(RenderContext& deviceContext, unsigned int boundSlot, EShaderType boundShader)
    {
       if (RenderObject::IsBindable())
       {
@@ -177,7 +177,7 @@ namespace Mile
       }
    }
 
-   void RenderTargetDX11::Clear(ID3D11DeviceContext& deviceContext, const Vector4& clearColor)
+   void RenderTargetDX11::Clear(RenderContext& deviceContext, const Vector4& clearColor)
    {
       deviceContext.ClearRenderTargetView(m_rtv, clearColor.elements);
    }
@@ -26,11 +26,11 @@ namespace Mile
       Texture2dDX11* GetTexture() const { return m_texture; }
       ID3D11RenderTargetView* GetRTV() const { return m_rtv; }
 
-      bool BindRenderTargetView(ID3D11DeviceContext& deviceContext);
-      bool BindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader);
-      void UnbindRenderTargetView(ID3D11DeviceContext& deviceContext);
-      void UnbindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType boundShader);
-      void Clear(ID3D11DeviceContext& deviceContext, const Vector4& clearColor);
+      bool BindRenderTargetView(RenderContext& deviceContext);
+      bool BindShaderResourceView(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader);
+      void UnbindRenderTargetView(RenderContext& deviceContext);
+      void UnbindShaderResourceView(RenderContext& deviceContext, unsigned int boundSlot, EShaderType boundShader);
+      void Clear(RenderContext& deviceContext, const Vector4& clearColor);
 
       void SetDepthStencilBuffer(DepthStencilBufferDX11* buffer) { this->m_depthStencilBuffer = buffer; }
 
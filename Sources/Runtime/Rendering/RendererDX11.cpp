@@ -6,7 +6,9 @@
 #include "Rendering/GPUProfiler.h"
 #include "Core/Engine.h"
 #include "Core/Window.h"
+#include "Core/FrameTimeline.h"
 #include "GameFramework/World.h"
+#include "MT/ThreadPool.h"
 
 namespace Mile
 {
@@ -22,6 +24,7 @@ namespace Mile
       m_backBufferDepthStencil(nullptr),
       m_renderResolution(Vector2(1920.0f, 1080.0f)),
       m_bVsyncEnabled(false),
+      m_bAsyncPresentEnabled(false),
       m_quad(nullptr),
       m_cube(nullptr),
       m_profiler(new GPUProfiler(this)),
@@ -33,6 +36,7 @@ namespace Mile
 
    RendererDX11::~RendererDX11()
    {
+      WaitForPresent();
       SafeDelete(OnWorldLoaded);
       SafeDelete(OnWorldCleared);
       SafeDelete(OnWindowResize);
@@ -46,11 +50,11 @@ namespace Mile
 
       for (auto*& deferredContext : m_deferredContexts)
       {
-         SafeRelease(deferredContext);
+         SafeDelete(deferredContext);
       }
 
-      SafeRelease(m_immediateContext);
-      SafeRelease(m_device);
+      m_immediateContext = nullptr;
+      m_device.reset();
    }
 
    bool RendererDX11::Init(Window& window)
@@ -71,6 +75,46 @@ namespace Mile
       return false;
    }
 
+   bool RendererDX11::InitHeadless(std::unique_ptr<RenderDevice> device, unsigned int width, unsigned int height)
+   {
+      if (device != nullptr && SubSystem::Init())
+      {
+         m_device = std::move(device);
+         m_immediateContext = &m_device->GetImmediateContext();
+
+         D3D11_TEXTURE2D_DESC desc;
+         ZeroMemory(&desc, sizeof(D3D11_TEXTURE2D_DESC));
+         desc.Width = width;
+         desc.Height = height;
+         desc.MipLevels = 1;
+         desc.ArraySize = 1;
+         desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+         desc.SampleDesc.Count = 1;
+         desc.SampleDesc.Quality = 0;
+         desc.Usage = D3D11_USAGE_DEFAULT;
+         desc.BindFlags = D3D11_BIND_RENDER_TARGET;
+
+         ID3D11Texture2D* backBuffer = nullptr;
+         ID3D11RenderTargetView* backBufferRenderTargetView = nullptr;
+         bool bIsBackBufferCreated = SUCCEEDED(m_device->CreateTexture2D(&desc, nullptr, &backBuffer)) &&
+            SUCCEEDED(m_device->CreateRenderTargetView(backBuffer, nullptr, &backBufferRenderTargetView));
+         SafeRelease(backBuffer);
+
+         if (bIsBackBufferCreated &&
+            InitBackBuffer(backBufferRenderTargetView, width, height) &&
+            InitDeferredContexts() &&
+            InitPrimitives())
+         {
+            BindWorldDelegates();
+            ME_LOG(MileRenderer, Log, TEXT("Renderer initialized without window. (%d x %d)"), width, height);
+            return true;
+         }
+      }
+
+      ME_LOG(MileRenderer, Fatal, TEXT("Failed to initialize headless Renderer!"));
+      return false;
+   }
+
    bool RendererDX11::InitLowLevelAPI(Window& window)
    {
       DXGI_SWAP_CHAIN_DESC swDesc;
@@ -96,6 +140,8 @@ namespace Mile
       unsigned int numOfFeatureLevels = ARRAYSIZE(featureLevels);
       D3D_FEATURE_LEVEL featureLevel = D3D_FEATURE_LEVEL::D3D_FEATURE_LEVEL_11_0;
 
+      ID3D11Device* device = nullptr;
+      ID3D11DeviceContext* immediateContext = nullptr;
       auto hr = D3D11CreateDeviceAndSwapChain(
          nullptr,
          D3D_DRIVER_TYPE_HARDWARE,
@@ -106,9 +152,9 @@ namespace Mile
          D3D11_SDK_VERSION,
          &swDesc,
          &m_swapChain,
-         &m_device,
+         &device,
          &featureLevel,
-         &m_immediateContext);
+         &immediateContext);
 
       if (FAILED(hr))
       {
@@ -116,6 +162,9 @@ namespace Mile
          return false;
       }
 
+      m_device = std::make_unique<RenderDeviceDX11>(device, immediateContext);
+      m_immediateContext = &m_device->GetImmediateContext();
+
       /* Create Render target view **/
       ID3D11Texture2D* backBuffer = nullptr;
       hr = m_swapChain->GetBuffer(
@@ -142,29 +191,48 @@ namespace Mile
          return false;
       }
 
+      if (!InitBackBuffer(backBufferRenderTargetView, (unsigned int)clientAreaRes.x, (unsigned int)clientAreaRes.y) ||
+         !InitDeferredContexts())
+      {
+         return false;
+      }
+
+      /** Initialize Delegates */
+      OnWindowResize = new OnWindowResizeDelegate();
+      OnWindowResize->Bind(&RendererDX11::OnWindowReiszeCallback, this);
+      window.OnWindowResize.Add(OnWindowResize);
+
+      BindWorldDelegates();
+      return true;
+   }
+
+   bool RendererDX11::InitBackBuffer(ID3D11RenderTargetView* renderTargetView, unsigned int width, unsigned int height)
+   {
       /** Create Depth-stencil buffer for Backbuffer. */
       m_backBufferDepthStencil = new DepthStencilBufferDX11(this);
-      if (!m_backBufferDepthStencil->Init((unsigned int)clientAreaRes.x, (unsigned int)clientAreaRes.y, true))
+      if (!m_backBufferDepthStencil->Init(width, height, true))
       {
          ME_LOG(MileRenderer, Fatal, TEXT("Failed to create back buffer depth-stencil buffer!"));
          return false;
       }
 
       m_backBuffer = new RenderTargetDX11(this);
-      if (!m_backBuffer->Init(backBufferRenderTargetView, m_backBufferDepthStencil))
+      if (!m_backBuffer->Init(renderTargetView, m_backBufferDepthStencil))
       {
          ME_LOG(MileRenderer, Fatal, TEXT("Failed to create back buffer render target!"));
          return false;
       }
 
-      // Create Deferred Contexts
+      return true;
+   }
+
+   bool RendererDX11::InitDeferredContexts()
+   {
       for (auto idx = 0; idx < m_maximumThreads; ++idx)
       {
-         ID3D11DeviceContext* deferredContext = nullptr;
-         hr = m_device->CreateDeferredContext(0, &deferredContext);
-         if (FAILED(hr))
+         RenderContext* deferredContext = m_device->CreateDeferredContext();
+         if (deferredContext == nullptr)
          {
-            // Failed to create deferred contexts.
             ME_LOG(MileRenderer, Fatal, TEXT("Failed to create deferred context!"));
             return false;
          }
@@ -172,10 +240,16 @@ namespace Mile
          m_deferredContexts.push_back(deferredContext);
       }
 
-      /** Initialize Delegates */
-      OnWindowResize = new OnWindowResizeDelegate();
-      OnWindowResize->Bind(&RendererDX11::OnWindowReiszeCallback, this);
-      window.OnWindowResize.Add(OnWindowResize);
+      return true;
+   }
+
+   void RendererDX11::BindWorldDelegates()
+   {
+      World* world = Engine::GetWorld();
+      if (world == nullptr)
+      {
+         return;
+      }
 
       auto resetProfilerLambda = [&]()
       {
@@ -183,15 +257,13 @@ namespace Mile
          profiler.ClearDatas();
       };
 
-      auto& world = *Engine::GetWorld();
       OnWorldLoaded = new OnWorldLoadedDelegate();
       OnWorldLoaded->BindLambda(resetProfilerLambda);
-      world.OnWorldLoaded.Add(OnWorldLoaded);
+      world->OnWorldLoaded.Add(OnWorldLoaded);
 
       OnWorldCleared = new OnWorldClearedDelegate();
       OnWorldCleared->BindLambda(resetProfilerLambda);
-      world.OnWorldCleared.Add(OnWorldCleared);
-      return true;
+      world->OnWorldCleared.Add(OnWorldCleared);
    }
 
    bool RendererDX11::InitPrimitives()
@@ -213,6 +285,10 @@ namespace Mile
    void RendererDX11::Render(const World& world)
    {
       OPTICK_EVENT();
+      WaitForPresent();
+      /** Culling and render tasks read world matrices from worker threads; Lazy transform caches must be resolved here. */
+      world.UpdateTransforms();
+      m_profiler->BeginFrame();
       RenderImpl(world);
       m_profiler->EndFrame();
    }
@@ -220,6 +296,38 @@ namespace Mile
    void RendererDX11::Present()
    {
       OPTICK_EVENT();
+      WaitForPresent();
+      if (m_swapChain != nullptr)
+      {
+         ThreadPool* threadPool = Engine::GetThreadPool();
+         if (m_bAsyncPresentEnabled && threadPool != nullptr)
+         {
+            m_presentTask = threadPool->AddTask([this]()
+               {
+                  PresentSwapChain();
+               });
+         }
+         else
+         {
+            PresentSwapChain();
+         }
+      }
+   }
+
+   void RendererDX11::WaitForPresent()
+   {
+      if (m_presentTask.valid())
+      {
+         OPTICK_EVENT();
+         ME_TIMELINE_SCOPE("WaitForPresent");
+         m_presentTask.get();
+      }
+   }
+
+   void RendererDX11::PresentSwapChain()
+   {
+      OPTICK_EVENT();
+      ME_TIMELINE_SCOPE("Present");
       if (m_swapChain != nullptr)
       {
          if (m_bVsyncEnabled)
@@ -235,6 +343,7 @@ namespace Mile
 
    void RendererDX11::OnWindowReiszeCallback(unsigned int width, unsigned int height)
    {
+      WaitForPresent();
       SafeDelete(m_backBufferDepthStencil);
       SafeDelete(m_backBuffer);
 
@@ -276,7 +385,7 @@ namespace Mile
       ME_LOG(MileRenderer, Log, TEXT("Back buffer successfully resized to (%d x %d)"), width, height);
    }
 
-   void RendererDX11::SetBackBufferAsRenderTarget(ID3D11DeviceContext& deviceContext)
+   void RendererDX11::SetBackBufferAsRenderTarget(RenderContext& deviceContext)
    {
       m_backBuffer->BindRenderTargetView(deviceContext);
    }
@@ -293,7 +402,7 @@ namespace Mile
 
    void RendererDX11::ThreadSafeDrawIndexed(size_t threadIdx, UINT vertexCount, UINT indexCount, UINT startIndexLocation, UINT basedVertexLocation)
    {
-      ID3D11DeviceContext& context = GetDeviceContext(threadIdx);
+      RenderContext& context = GetDeviceContext(threadIdx);
       context.DrawIndexed(indexCount, startIndexLocation, basedVertexLocation);
       m_profiler->DrawCall(vertexCount, indexCount / 3, threadIdx);
    }
@@ -303,9 +412,16 @@ namespace Mile
       ThreadSafeDrawIndexed(0, vertexCount, indexCount, startIndexLocation, basedVertexLocation);
    }
 
+   void RendererDX11::ThreadSafeDrawIndexedInstanced(size_t threadIdx, UINT vertexCount, UINT indexCount, UINT instanceCount, UINT startIndexLocation, UINT basedVertexLocation, UINT startInstanceLocation)
+   {
+      RenderContext& context = GetDeviceContext(threadIdx);
+      context.DrawIndexedInstanced(indexCount, instanceCount, startIndexLocation, basedVertexLocation, startInstanceLocation);
+      m_profiler->DrawCall(static_cast<UINT64>(vertexCount) * instanceCount, static_cast<UINT64>(indexCount / 3) * instanceCount, threadIdx, instanceCount);
+   }
+
    void RendererDX11::Dispatch(UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ)
    {
-      ID3D11DeviceContext& immeidiateContext = GetImmediateContext();
+      RenderContext& immeidiateContext = GetImmediateContext();
       immeidiateContext.Dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Rendering/RenderingCore.h"
+#include "Rendering/RenderDevice.h"
 #include "Core/Logger.h"
 
 namespace Mile
@@ -26,24 +27,31 @@ namespace Mile
       virtual ~RendererDX11();
 
       virtual bool Init(Window& window);
-
-      ID3D11Device& GetDevice() const 
+      /**
+       * @brief   Initialize renderer on given device without window and swap chain.
+       *          Back buffer is created as offscreen render target. (ex. NullRenderDevice for headless rendering)
+       */
+      virtual bool InitHeadless(std::unique_ptr<RenderDevice> device, unsigned int width, unsigned int height);
+      /** Renderer has no window and swap chain. (Initialized by InitHeadless) */
+      bool IsHeadless() const { return (m_swapChain == nullptr); }
+
+      RenderDevice& GetDevice() const 
       { 
          return (*m_device); 
       }
 
-      ID3D11DeviceContext& GetImmediateContext() const 
+      RenderContext& GetImmediateContext() const 
       {
          return (*m_immediateContext);
       }
 
-      ID3D11DeviceContext& GetDeferredContext(size_t idx) const
+      RenderContext& GetDeferredContext(size_t idx) const
       { 
          return (*m_deferredContexts[idx]); 
       }
 
       /** ThreadIndex 0 = Main Thread(return immeidate device context), else return deferred device context! */
-      ID3D11DeviceContext& GetDeviceContext(size_t threadIdx) const 
+      RenderContext& GetDeviceContext(size_t threadIdx) const 
       {
          if (threadIdx == 0)
          {
@@ -72,6 +80,20 @@ namespace Mile
          return m_bVsyncEnabled;
       }
 
+      /**
+       * @brief   If async present is enabled, swap chain is presented on thread pool,
+       *          so frame pacing and window messages of next frame can be overlapped with presentation of previous frame.
+       *          Every use of immediate context must be preceded by WaitForPresent.
+       */
+      void SetAsyncPresent(bool enable)
+      {
+         m_bAsyncPresentEnabled = enable;
+      }
+      bool IsAsyncPresentEnabled() const
+      {
+         return m_bAsyncPresentEnabled;
+      }
+
       void SetRenderResolution(const Vector2& newResolution)
       {
          bool bIsValidResolution = newResolution.x > 0.0f && newResolution.y > 0.0f;
@@ -93,8 +115,10 @@ namespace Mile
 
       void Render(const World& world);
       void Present();
+      /** Block until previous asynchronous present has been done. */
+      void WaitForPresent();
 
-      void SetBackBufferAsRenderTarget(ID3D11DeviceContext& deviceContext);
+      void SetBackBufferAsRenderTarget(RenderContext& deviceContext);
 
       Quad* GetPrimitiveQuad() const { return m_quad; }
       Cube* GetPrimitiveCube() const { return m_cube; }
@@ -104,6 +128,8 @@ namespace Mile
 
       void ThreadSafeDrawIndexed(size_t threadIdx, UINT vertexCount, UINT indexCount, UINT startIndexLocation = 0, UINT basedVertexLocation = 0);
       void DrawIndexed(UINT vertexCount, UINT indexCount, UINT startIndexLocation = 0, UINT basedVertexLocation = 0);
+      /** startInstanceLocation offsets per-instance vertex streams. (ex. draw id stream) */
+      void ThreadSafeDrawIndexedInstanced(size_t threadIdx, UINT vertexCount, UINT indexCount, UINT instanceCount, UINT startIndexLocation = 0, UINT basedVertexLocation = 0, UINT startInstanceLocation = 0);
       void Dispatch(UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ);
 
       void OnWindowReiszeCallback(unsigned int width, unsigned int height);
@@ -114,7 +140,11 @@ namespace Mile
 
    private:
       bool InitLowLevelAPI(Window& window);
+      bool InitBackBuffer(ID3D11RenderTargetView* renderTargetView, unsigned int width, unsigned int height);
+      bool InitDeferredContexts();
+      void BindWorldDelegates();
       bool InitPrimitives();
+      void PresentSwapChain();
 
    private:
       size_t m_maximumThreads;
@@ -122,9 +152,9 @@ namespace Mile
       GPUProfiler* m_profiler;
 
       /** Low level APIs */
-      ID3D11Device* m_device;
-      ID3D11DeviceContext* m_immediateContext;
-      std::vector<ID3D11DeviceContext*> m_deferredContexts;
+      std::unique_ptr<RenderDevice> m_device;
+      RenderContext* m_immediateContext;
+      std::vector<RenderContext*> m_deferredContexts;
       IDXGISwapChain* m_swapChain;
       RenderTargetDX11* m_backBuffer;
       DepthStencilBufferDX11* m_backBufferDepthStencil;
@@ -133,6 +163,8 @@ namespace Mile
       class OnWindowResizeDelegate* OnWindowResize;
       Vector2 m_renderResolution;
       bool m_bVsyncEnabled;
+      bool m_bAsyncPresentEnabled;
+      std::future<void> m_presentTask;
 
       class OnWorldLoadedDelegate* OnWorldLoaded;
       class OnWorldClearedDelegate* OnWorldCleared;
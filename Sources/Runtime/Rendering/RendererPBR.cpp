@@ -4,6 +4,8 @@
 #include "Rendering/PixelShaderDX11.h"
 #include "Rendering/SamplerDX11.h"
 #include "Rendering/ConstantBufferDX11.h"
+#include "Rendering/StructuredBufferDX11.h"
+#include "Rendering/VertexBufferDX11.h"
 #include "Rendering/GBuffer.h"
 #include "Rendering/Viewport.h"
 #include "Rendering/RasterizerState.h"
@@ -15,9 +17,11 @@
 #include "Rendering/DynamicCubemap.h"
 #include "Rendering/FrameResourceRealizeImpl.hpp"
 #include "Rendering/GPUProfiler.h"
+#include "Math/Frustum.h"
 #include "Core/Context.h"
 #include "Core/Engine.h"
 #include "Core/Timer.h"
+#include "Core/FrameTimeline.h"
 #include "GameFramework/World.h"
 #include "GameFramework/Transform.h"
 #include "Component/CameraComponent.h"
@@ -34,13 +38,6 @@ namespace Mile
 {
    DEFINE_LOG_CATEGORY(MileRendererPBR);
 
-   DEFINE_CONSTANT_BUFFER(GeometryPassTransformBuffer)
-   {
-      Matrix WorldMatrix = Matrix::Identity;
-      Matrix WorldViewMatrix = Matrix::Identity;
-      Matrix WorldViewProjMatrix = Matrix::Identity;
-   };
-
    DEFINE_CONSTANT_BUFFER(OneFloatConstantBuffer)
    {
       float Value = 0.0f;
@@ -138,6 +135,12 @@ namespace Mile
       m_ssaoBlurPassVS(nullptr),
       m_ssaoBlurPassPS(nullptr),
       m_bSSAOEnabled(true),
+      m_bFrustumCullingEnabled(true),
+      m_bInstancingEnabled(true),
+      m_instanceTransformBuffer(nullptr),
+      m_drawIDBuffer(nullptr),
+      m_instanceTransformCapacity(0),
+      m_fallbackDrawIDBuffer(nullptr),
       m_ambientEmissivePassVS(nullptr),
       m_ambientEmissivePassPS(nullptr),
       m_ambientIntensity(1.0f),
@@ -176,6 +179,13 @@ namespace Mile
    RendererPBR::~RendererPBR()
    {
       m_frameGraph.Clear();
+      SafeDelete(m_drawIDBuffer);
+      SafeDelete(m_instanceTransformBuffer);
+      SafeDelete(m_fallbackDrawIDBuffer);
+      for (auto* fallbackTransformBuffer : m_fallbackTransformBuffers)
+      {
+         SafeDelete(fallbackTransformBuffer);
+      }
       SafeDelete(m_downScaleTo1DPassCS);
       SafeDelete(m_downScaleToScalarCS);
       SafeDelete(m_lightingDebugBuffer);
@@ -236,25 +246,41 @@ namespace Mile
    {
       if (RendererDX11::Init(window))
       {
-         m_quadMesh = GetPrimitiveQuad();
-         m_cubeMesh = GetPrimitiveCube();
-         if (InitShader())
-         {
-            if (InitFrameGraph())
-            {
-               ME_LOG(MileRendererPBR, Log, TEXT("PBR Renderer Initialized"));
-               return true;
-            }
+         return InitPipeline();
+      }
 
-            ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to initialize FrameGraph!"));
-            return false;
+      ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to initialize PBR Renderer!"));
+      return false;
+   }
+
+   bool RendererPBR::InitHeadless(std::unique_ptr<RenderDevice> device, unsigned int width, unsigned int height)
+   {
+      if (RendererDX11::InitHeadless(std::move(device), width, height))
+      {
+         return InitPipeline();
+      }
+
+      ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to initialize headless PBR Renderer!"));
+      return false;
+   }
+
+   bool RendererPBR::InitPipeline()
+   {
+      m_quadMesh = GetPrimitiveQuad();
+      m_cubeMesh = GetPrimitiveCube();
+      if (InitShader())
+      {
+         if (InitFrameGraph())
+         {
+            ME_LOG(MileRendererPBR, Log, TEXT("PBR Renderer Initialized"));
+            return true;
          }
 
-         ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to initialize Shaders!"));
+         ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to initialize FrameGraph!"));
          return false;
       }
 
-      ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to initialize PBR Renderer!"));
+      ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to initialize Shaders!"));
       return false;
    }
 
@@ -592,7 +618,6 @@ namespace Mile
          CameraRefResource* TargetCameraRef = nullptr;
          MaterialMapResource* MaterialMap = nullptr;
          SamplerResource* Sampler = nullptr;
-         std::vector<ConstantBufferResource*> TransformBuffers = { nullptr, };
          std::vector<ConstantBufferResource*> MaterialBuffers = { nullptr, };
          ViewportResource* OutputViewport = nullptr;
          ViewportResource* HalfViewport = nullptr;
@@ -616,20 +641,14 @@ namespace Mile
             data.TargetCameraRef = builder.Read(targetCameraRefRes);
             data.MaterialMap = builder.Read(materialMapRes);
 
-            ConstantBufferDescriptor transformBufferDesc;
-            transformBufferDesc.Renderer = this;
-            transformBufferDesc.Size = sizeof(GeometryPassTransformBuffer);
-
             ConstantBufferDescriptor packedMaterialParamsBufferDesc;
             packedMaterialParamsBufferDesc.Renderer = this;
             packedMaterialParamsBufferDesc.Size = sizeof(PackedMaterialParams);
 
             size_t maximumThreadsNum = this->GetMaximumThreads();
-            data.TransformBuffers.resize(maximumThreadsNum);
             data.MaterialBuffers.resize(maximumThreadsNum);
             for (size_t threads = 0; threads < maximumThreadsNum; ++threads)
             {
-               data.TransformBuffers[threads] = builder.Create<ConstantBufferResource>("GeometryPassTransformConstantBuffers", transformBufferDesc);
                data.MaterialBuffers[threads] = builder.Create<ConstantBufferResource>("GeometryPassPackedMaterialParamsConstantBuffers", packedMaterialParamsBufferDesc);
             }
 
@@ -662,11 +681,10 @@ namespace Mile
             halfViewport->SetWidth(halfViewport->GetWidth() / 2);
             halfViewport->SetHeight(halfViewport->GetHeight() / 2);
 
-            auto threadPool = Engine::GetThreadPool();
+            auto threadPool = data.Renderer->GetContext()->GetSubSystem<ThreadPool>();
             size_t maximumThreadsNum = data.Renderer->GetMaximumThreads();
-
-            // @For performance test!
-            //RendererPBR::RenderMeshes(data.Renderer, true, *meshes, 0, meshesNum, data.Renderer->GetImmediateContext(), vertexShader, pixelShader, sampler, gBuffer, data.TransformBuffers[0]->GetActual(), data.MaterialBuffers[0]->GetActual(), rasterizerState, viewport, targetCamera);
+            RendererPBR* renderer = static_cast<RendererPBR*>(data.Renderer);
+            bool bInstancingEnabled = renderer->IsInstancingEnabled();
 
             /** Scheduling */
             /** @todo ӽ ̹Ƿ   memory management  ãƼ ϱ */
@@ -677,7 +695,7 @@ namespace Mile
             size_t threadDrawMeshCounts[UpperBoundOfThreadsNum] = { 0, };
             Meshes renderTasks[UpperBoundOfThreadsNum];
 
-            std::queue<std::future<void>> scheduleTaskQueue;
+            TaskGroup scheduleTaskGroup{ *threadPool };
             std::queue <std::pair<size_t, std::future<void>>> renderTaskQueue;
             for (auto& mapData : materialMap)
             {
@@ -696,6 +714,17 @@ namespace Mile
                         --remain;
                      }
 
+                     if (bInstancingEnabled)
+                     {
+                        /** Meshes are grouped by mesh while culling; Don't split identical (mesh, material) pairs across threads. */
+                        while ((offset + num) < targetMeshes.size() && targetMeshes[offset + num - 1]->GetMesh() == targetMeshes[offset + num]->GetMesh())
+                        {
+                           ++num;
+                        }
+                     }
+
+                     num = std::min(num, targetMeshes.size() - offset);
+
                      size_t minMatSwitchingCount = std::numeric_limits<size_t>::max();
                      size_t minMatSwitchingSubThreadIdx = 0;
                      for (size_t subThreadIdx = 0; subThreadIdx < maximumThreadsNum; ++subThreadIdx)
@@ -723,7 +752,7 @@ namespace Mile
                      ++matSwitchingCounts[minMatSwitchingSubThreadIdx];
                      threadDrawMeshCounts[minMatSwitchingSubThreadIdx] += num;
 
-                     scheduleTaskQueue.push(std::move(threadPool->AddTask([&targetMeshes, &renderTasks, &mutexes, minMatSwitchingSubThreadIdx, offset, num]()
+                     scheduleTaskGroup.Run([&targetMeshes, &renderTasks, &mutexes, minMatSwitchingSubThreadIdx, offset, num]()
                         {
                            OPTICK_EVENT("SchedulingGeometryPassRenderTask");
                            {
@@ -731,51 +760,111 @@ namespace Mile
                               auto& renderTaskMeshes = renderTasks[minMatSwitchingSubThreadIdx];
                               std::copy_n(targetMeshes.begin() + offset, num, std::back_inserter(renderTaskMeshes));
                            }
-                        })));
+                        });
 
                      offset += num;
                   }
                }
             }
 
-            while (!scheduleTaskQueue.empty())
+            scheduleTaskGroup.Wait();
+
+            /** Pack transforms of every draws and upload them at once; draws of each thread own contiguous draw ids. */
+            InstanceTransformBatch& transformBatch = renderer->m_instanceTransformBatch;
+            auto camTransform = targetCamera->GetTransform();
+            transformBatch.Reset(
+               Matrix::CreateView(
+                  camTransform->GetPosition(ETransformSpace::World),
+                  camTransform->GetForward(ETransformSpace::World),
+                  camTransform->GetUp(ETransformSpace::World)),
+               Matrix::CreatePerspectiveProj(
+                  targetCamera->GetFov(),
+                  (viewport->GetWidth() / (float)viewport->GetHeight()),
+                  targetCamera->GetNearPlane(),
+                  targetCamera->GetFarPlane()));
+
+            size_t firstDrawIDs[UpperBoundOfThreadsNum] = { 0, };
+            for (size_t subThreadIdx = 0; subThreadIdx < maximumThreadsNum; ++subThreadIdx)
             {
-               auto task{ std::move(scheduleTaskQueue.front()) };
-               scheduleTaskQueue.pop();
-               task.get();
+               firstDrawIDs[subThreadIdx] = transformBatch.Allocate(renderTasks[subThreadIdx].size());
             }
 
+            {
+               OPTICK_EVENT("PackInstanceTransforms");
+               threadPool->ParallelFor(0, maximumThreadsNum,
+                  [&](size_t begin, size_t end)
+                  {
+                     for (size_t subThreadIdx = begin; subThreadIdx < end; ++subThreadIdx)
+                     {
+                        if (bInstancingEnabled)
+                        {
+                           /** Make identical (mesh, material) pairs adjacent, so they have contiguous draw ids and be drawn as instances. */
+                           std::sort(renderTasks[subThreadIdx].begin(), renderTasks[subThreadIdx].end(),
+                              [](const MeshRenderComponent* lhs, const MeshRenderComponent* rhs)
+                              {
+                                 if (lhs->GetMaterial() != rhs->GetMaterial())
+                                 {
+                                    return std::less<Material*>()(lhs->GetMaterial(), rhs->GetMaterial());
+                                 }
+
+                                 return std::less<Mesh*>()(lhs->GetMesh(), rhs->GetMesh());
+                              });
+                        }
+
+                        transformBatch.Pack(firstDrawIDs[subThreadIdx], renderTasks[subThreadIdx].data(), renderTasks[subThreadIdx].size());
+                     }
+                  }, 1);
+            }
+
+            /** GBuffer is cleared even if meshes can't be drawn, so following passes don't read stale frame. */
+            bool bIsUploaded = renderer->UploadInstanceTransforms(data.Renderer->GetImmediateContext());
+            bool bIsDrawable = bIsUploaded;
+            const InstanceTransform* fallbackTransforms = nullptr;
+            if (!bIsUploaded)
+            {
+               ME_LOG(MileRendererPBR, Error, TEXT("Failed to upload %zu instance transforms; Geometry pass falls back to non-instanced draws."), transformBatch.GetSize());
+               bIsDrawable = renderer->AcquireFallbackTransformBuffers();
+               fallbackTransforms = transformBatch.GetData();
+            }
+
+            bool bDrawInstanced = bInstancingEnabled && bIsUploaded;
+            auto drawIDBuffer = bIsUploaded ? renderer->m_drawIDBuffer : renderer->m_fallbackDrawIDBuffer;
+
             /** Meshes */
             for (size_t subThreadIdx = 0; subThreadIdx < maximumThreadsNum; ++subThreadIdx)
             {
-               if (renderTasks[subThreadIdx].size() > 0)
+               if (bIsDrawable && renderTasks[subThreadIdx].size() > 0)
                {
                   auto& profiler = data.Renderer->GetProfiler();
                   size_t threadIdx = subThreadIdx + 1; /** thread index = thread + 1(Main Thread) */
                   std::string taskName = "GeometryPass_thread";
                   taskName.append(std::to_string(threadIdx));
 
-                  auto transformBuffer = data.TransformBuffers[subThreadIdx]->GetActual();
                   auto materialParamsBuffer = data.MaterialBuffers[subThreadIdx]->GetActual();
+                  auto instanceTransformBuffer = bIsUploaded ? renderer->m_instanceTransformBuffer : renderer->m_fallbackTransformBuffers[subThreadIdx];
+                  size_t firstDrawID = firstDrawIDs[subThreadIdx];
 
                   auto& renderTask = renderTasks[subThreadIdx];
                   renderTaskQueue.push(std::make_pair(subThreadIdx, threadPool->AddTask([=, &profiler, &renderTask]()
                      {
                         OPTICK_EVENT("ExecuteGeometryPassRenderTask");
+                        ME_TIMELINE_SCOPE("GeometryPassRenderTask");
                         ScopedDeferredGPUProfile deferredProfile{ profiler, taskName, data.Renderer->GetDeferredContext(subThreadIdx) };
                         RendererPBR::RenderMeshes(
                            data.Renderer,
                            false, renderTask, 0, renderTask.size(),
                            vertexShader, pixelShader, sampler,
-                           gBuffer, transformBuffer, materialParamsBuffer,
-                           rasterizerState, viewport, targetCamera, threadIdx);
+                           gBuffer, materialParamsBuffer,
+                           instanceTransformBuffer, drawIDBuffer, firstDrawID,
+                           rasterizerState, viewport, targetCamera,
+                           bDrawInstanced, threadIdx, fallbackTransforms);
                      })));
                }
             }
 
             profiler.Begin("GeometryPass");
             /** Clear GBuffer */
-            ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+            RenderContext& immediateContext = data.Renderer->GetImmediateContext();
             gBuffer->BindRenderTargetView(immediateContext);
             gBuffer->UnbindRenderTargetView(immediateContext);
             while (!renderTaskQueue.empty())
@@ -784,7 +873,7 @@ namespace Mile
                renderTaskQueue.pop();
                renderTask.second.get();
 
-               ID3D11DeviceContext& deferredContext = data.Renderer->GetDeferredContext(renderTask.first);
+               RenderContext& deferredContext = data.Renderer->GetDeferredContext(renderTask.first);
 
                ID3D11CommandList* commandList = nullptr;
                deferredContext.FinishCommandList(false, &commandList);
@@ -920,7 +1009,7 @@ namespace Mile
                OPTICK_EVENT("ExecuteConvertSkyboxPass");
                auto& profiler = data.Renderer->GetProfiler();
                ScopedGPUProfile profile(profiler, "ConvertSkyboxPass");
-               ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+               RenderContext& immediateContext = data.Renderer->GetImmediateContext();
                immediateContext.ClearState();
                immediateContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -1061,7 +1150,7 @@ namespace Mile
                OPTICK_EVENT("ExecuteDiffuseIntegralPass");
                auto& profiler = data.Renderer->GetProfiler();
                ScopedGPUProfile profile(profiler, "DiffuseIntegralPass");
-               ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+               RenderContext& immediateContext = data.Renderer->GetImmediateContext();
                immediateContext.ClearState();
                immediateContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -1202,7 +1291,7 @@ namespace Mile
                auto& profiler = data.Renderer->GetProfiler();
                ScopedGPUProfile profile(profiler, "PrefilterEnvironmentMapPass");
 
-               ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+               RenderContext& immediateContext = data.Renderer->GetImmediateContext();
                immediateContext.ClearState();
                immediateContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -1336,7 +1425,7 @@ namespace Mile
                auto& profiler = data.Renderer->GetProfiler();
                ScopedGPUProfile profile(profiler, "IntegrateBRDFPass");
 
-               ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+               RenderContext& immediateContext = data.Renderer->GetImmediateContext();
                immediateContext.ClearState();
                immediateContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -1480,7 +1569,7 @@ namespace Mile
             OPTICK_EVENT("ExecuteLightingPass");
             auto& profiler = data.Renderer->GetProfiler();
             ScopedGPUProfile profile(profiler, "LightingPass");
-            ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+            RenderContext& immediateContext = data.Renderer->GetImmediateContext();
             immediateContext.ClearState();
             immediateContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -1645,7 +1734,7 @@ namespace Mile
             OPTICK_EVENT("ExecuteConvertGBufferPass");
             auto& profiler = data.Renderer->GetProfiler();
             ScopedGPUProfile profile(profiler, "ConvertGBufferPass");
-            ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+            RenderContext& immediateContext = data.Renderer->GetImmediateContext();
             immediateContext.ClearState();
             immediateContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -1785,7 +1874,7 @@ namespace Mile
             bool bSSAOEnabled = *(*data.SSAOEnabledRef->GetActual());
             if (bSSAOEnabled)
             {
-               ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+               RenderContext& immediateContext = data.Renderer->GetImmediateContext();
                immediateContext.ClearState();
                immediateContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -1904,7 +1993,7 @@ namespace Mile
             {
                auto& profiler = data.Renderer->GetProfiler();
                ScopedGPUProfile profile(profiler, "SSAOBlurPass");
-               ID3D11DeviceContext& context = data.Renderer->GetImmediateContext();
+               RenderContext& context = data.Renderer->GetImmediateContext();
                context.ClearState();
                context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -2028,7 +2117,7 @@ namespace Mile
             OPTICK_EVENT("ExecuteAmbientEmissivePass");
             auto& profiler = data.Renderer->GetProfiler();
             ScopedGPUProfile profile(profiler, "AmbientEmissivePass");
-            ID3D11DeviceContext& context = data.Renderer->GetImmediateContext();
+            RenderContext& context = data.Renderer->GetImmediateContext();
             context.ClearState();
             context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -2171,7 +2260,7 @@ namespace Mile
          {
             OPTICK_EVENT("ExecuteSkyboxPass");
             auto& profiler = data.Renderer->GetProfiler();
-            ID3D11DeviceContext& context = data.Renderer->GetImmediateContext();
+            RenderContext& context = data.Renderer->GetImmediateContext();
             ScopedGPUProfile profile(profiler, "SkyboxPass");
             context.ClearState();
             context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -2302,7 +2391,7 @@ namespace Mile
                auto avgLum1DBuffer = *data.AvgLum1DRef->GetActual();
                auto paramsBuffer = data.ParamsBuffer->GetActual();
 
-               ID3D11DeviceContext& immediateContext = data.Renderer->GetImmediateContext();
+               RenderContext& immediateContext = data.Renderer->GetImmediateContext();
                shader->Bind(immediateContext);
                hdrInput->BindShaderResourceView(immediateContext, 0, EShaderType::ComputeShader);
                avgLum1DBuffer->BindUnorderedAccessView(immediateContext, 0);
@@ -2315,11 +2404,13 @@ namespace Mile
                unsigned int downScaledDomain = (renderRes.x * renderRes.y) / 16;
                unsigned int groupSize = downScaledDomain / 1024;
 
-               auto timer = Engine::GetTimer();
+               /** Headless renderer may not have timer; Exposure does not adapt then. */
+               auto timer = data.Renderer->GetContext()->GetSubSystem<Timer>();
+               float deltaTime = (timer != nullptr) ? timer->GetDeltaTime() : 0.0f;
                auto mappedParamsBuffer = paramsBuffer->Map<DownScaleConstantsBuffer>(immediateContext);
                (*mappedParamsBuffer) = DownScaleConstantsBuffer{
                   { downScaledResX, downScaledResY, downScaledDomain, groupSize },
-                  Vector4(camera->GetLightAdaptionSpeed() * timer->GetDeltaTime(), camera->GetDarkAdaptionSpeed() * timer->GetDeltaTime(), camera->GetMinBrightness(), camera->GetMaxBrightness())
+                  Vector4(camera->GetLightAdaptionSpeed() * deltaTime, camera->GetDarkAdaptionSpeed() * deltaTime, camera->GetMinBrightness(), camera->GetMaxBrightness())
                };
                paramsBuffer->UnMap(immediateContext);
 
@@ -2395,7 +2486,7 @@ namespace Mile
                auto prevAvgLum = *data.PrevAvgLumRef->GetActual();
                auto paramsBuffer = data.ParamsBuffer->GetActual();
 
-               ID3D11DeviceContext& immeidiateContext = data.Renderer->GetImmediateContext();
+               RenderContext& immeidiateContext = data.Renderer->GetImmediateContext();
                shader->Bind(immeidiateContext);
                avgLum1DBuffer->BindShaderResourceView(immeidiateContext, 0, EShaderType::ComputeShader);
                finalAvgLum->BindUnorderedAccessView(immeidiateContext, 0);
@@ -2462,7 +2553,7 @@ namespace Mile
          {
             OPTICK_EVENT("ExecuteToneMappingPass");
             auto& profiler = data.Renderer->GetProfiler();
-            ID3D11DeviceContext& context = data.Renderer->GetImmediateContext();
+            RenderContext& context = data.Renderer->GetImmediateContext();
             ScopedGPUProfile profile(profiler, "ToneMappingPass");
             context.ClearState();
             context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -2557,7 +2648,7 @@ namespace Mile
          {
             OPTICK_EVENT("ExecuteDebugDepthSSAO");
             auto& profiler = data.Renderer->GetProfiler();
-            ID3D11DeviceContext& context = data.Renderer->GetImmediateContext();
+            RenderContext& context = data.Renderer->GetImmediateContext();
             ScopedGPUProfile profile(profiler, "DebugDepthSSAOPass");
             context.ClearState();
             context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -2701,12 +2792,15 @@ namespace Mile
          }
          else
          {
-#ifdef MILE_EDITOR
-            ResourceManager* resManager = Engine::GetResourceManager();
-            renderTexture = resManager->Load<RenderTexture>(EDITOR_GAME_VIEW_RENDER_TEXTURE, true);
-            m_outputRenderTarget = renderTexture->GetRenderTarget();
-#else
             m_outputRenderTarget = &GetBackBuffer();
+#ifdef MILE_EDITOR
+            /** Headless renderer has no game view; Render into offscreen back buffer. */
+            if (!IsHeadless())
+            {
+               ResourceManager* resManager = Engine::GetResourceManager();
+               renderTexture = resManager->Load<RenderTexture>(EDITOR_GAME_VIEW_RENDER_TEXTURE, true);
+               m_outputRenderTarget = renderTexture->GetRenderTarget();
+            }
 #endif
          }
 
@@ -2714,6 +2808,7 @@ namespace Mile
          if (camera->IsActivated())
          {
             m_targetCamera = camera;
+            CullMeshes(camera, *m_outputRenderTarget);
             m_frameGraph.Execute();
          }
 
@@ -2800,26 +2895,13 @@ namespace Mile
    void RendererPBR::AcquireRenderResources(const World& world)
    {
       OPTICK_EVENT();
-      ID3D11DeviceContext& immediateContext = GetImmediateContext();
-      auto threadPool = Engine::GetThreadPool();
+      RenderContext& immediateContext = GetImmediateContext();
+      auto threadPool = GetContext()->GetSubSystem<ThreadPool>();
       auto acquireMeshRenderersAndMatTask = threadPool->AddTask([&]()
          {
-            OPTICK_EVENT("AcquireMeshRenderersAndMaterial");
-            for (auto& meshes : m_materialMap)
-            {
-               meshes.second.resize(0);
-            }
-
+            OPTICK_EVENT("AcquireMeshRenderers");
             m_meshes.resize(0);
             world.GetComponentsFromEntities<MeshRenderComponent>(m_meshes);
-            for (auto renderComponent : m_meshes)
-            {
-               auto material = renderComponent->GetMaterial();
-               if (material != nullptr && renderComponent->GetMesh() != nullptr)
-               {
-                  m_materialMap[material].push_back(renderComponent);
-               }
-            }
          });
       auto acquireLightsTask = threadPool->AddTask([&]()
          {
@@ -2871,11 +2953,172 @@ namespace Mile
       acquireSkyLightTask.get();
    }
 
-   void RendererPBR::RenderMeshes(RendererDX11* renderer, bool bClearGBuffer, const Meshes& meshes, size_t offset, size_t num, VertexShaderDX11* vertexShader, PixelShaderDX11* pixelShader, SamplerDX11* sampler, GBuffer* gBuffer, ConstantBufferDX11* transformBuffer, ConstantBufferDX11* materialParamsBuffer, RasterizerState* rasterizerState, Viewport* viewport, CameraRef camera, size_t threadIdx)
+   void RendererPBR::CullMeshes(CameraComponent* camera, const RenderTargetDX11& renderTarget)
+   {
+      OPTICK_EVENT();
+      for (auto& meshes : m_materialMap)
+      {
+         meshes.second.resize(0);
+      }
+
+      auto camTransform = camera->GetTransform();
+      Matrix viewMatrix = Matrix::CreateView(
+         camTransform->GetPosition(ETransformSpace::World),
+         camTransform->GetForward(ETransformSpace::World),
+         camTransform->GetUp(ETransformSpace::World));
+      Matrix projMatrix = Matrix::CreatePerspectiveProj(
+         camera->GetFov(),
+         (renderTarget.GetWidth() / (float)renderTarget.GetHeight()),
+         camera->GetNearPlane(),
+         camera->GetFarPlane());
+      const Frustum frustum{ viewMatrix * projMatrix };
+
+      /** Culling pass; Each mesh render component only touched by one task. */
+      m_meshVisibility.resize(m_meshes.size());
+      bool bFrustumCullingEnabled = m_bFrustumCullingEnabled;
+      GetContext()->GetSubSystem<ThreadPool>()->ParallelFor(0, m_meshes.size(),
+         [this, &frustum, bFrustumCullingEnabled](size_t begin, size_t end)
+         {
+            OPTICK_EVENT("FrustumCulling");
+            for (size_t idx = begin; idx < end; ++idx)
+            {
+               MeshRenderComponent* renderComponent = m_meshes[idx];
+               bool bIsVisible = (renderComponent->GetMaterial() != nullptr && renderComponent->GetMesh() != nullptr);
+               if (bIsVisible && bFrustumCullingEnabled)
+               {
+                  bIsVisible = frustum.Intersects(renderComponent->GetWorldBoundingSphere()) &&
+                     frustum.Intersects(renderComponent->GetWorldBounds());
+               }
+
+               m_meshVisibility[idx] = bIsVisible ? 1 : 0;
+            }
+         });
+
+      UINT64 visibleMeshes = 0;
+      for (size_t idx = 0; idx < m_meshes.size(); ++idx)
+      {
+         if (m_meshVisibility[idx] != 0)
+         {
+            MeshRenderComponent* renderComponent = m_meshes[idx];
+            m_materialMap[renderComponent->GetMaterial()].push_back(renderComponent);
+            ++visibleMeshes;
+         }
+      }
+
+      if (m_bInstancingEnabled)
+      {
+         /** Group identical (mesh, material) pairs before geometry pass splits meshes of material across threads. */
+         for (auto& meshes : m_materialMap)
+         {
+            std::stable_sort(meshes.second.begin(), meshes.second.end(),
+               [](const MeshRenderComponent* lhs, const MeshRenderComponent* rhs)
+               {
+                  return std::less<Mesh*>()(lhs->GetMesh(), rhs->GetMesh());
+               });
+         }
+      }
+
+      GetProfiler().CullingResult(visibleMeshes, m_meshes.size() - visibleMeshes);
+   }
+
+   bool RendererPBR::UploadInstanceTransforms(RenderContext& context)
    {
       OPTICK_EVENT();
+      size_t requiredCapacity = std::max<size_t>(m_instanceTransformBatch.GetSize(), 1);
+      if (m_instanceTransformCapacity < requiredCapacity)
+      {
+         size_t newCapacity = std::max<size_t>(m_instanceTransformCapacity, 1024);
+         while (newCapacity < requiredCapacity)
+         {
+            newCapacity *= 2;
+         }
+
+         SafeDelete(m_instanceTransformBuffer);
+         SafeDelete(m_drawIDBuffer);
+         m_instanceTransformCapacity = 0;
+
+         StructuredBufferDescriptor transformBufferDesc;
+         transformBufferDesc.Renderer = this;
+         transformBufferDesc.Count = static_cast<unsigned int>(newCapacity);
+         transformBufferDesc.StructSize = sizeof(InstanceTransform);
+         transformBufferDesc.bCPUWritable = true;
+         transformBufferDesc.bGPUWritable = false;
+         m_instanceTransformBuffer = Elaina::Realize<StructuredBufferDescriptor, StructuredBufferDX11>(transformBufferDesc);
+
+         std::vector<unsigned int> drawIDs(newCapacity);
+         std::iota(drawIDs.begin(), drawIDs.end(), 0);
+         m_drawIDBuffer = new VertexBufferDX11(this);
+         if (m_instanceTransformBuffer == nullptr || !m_drawIDBuffer->Init(drawIDs))
+         {
+            ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to create instance transform buffers."));
+            SafeDelete(m_instanceTransformBuffer);
+            SafeDelete(m_drawIDBuffer);
+            return false;
+         }
+
+         m_instanceTransformCapacity = newCapacity;
+      }
+
+      if (m_instanceTransformBatch.GetSize() > 0)
+      {
+         void* mapped = m_instanceTransformBuffer->Map(context);
+         if (mapped == nullptr)
+         {
+            return false;
+         }
+
+         std::memcpy(mapped, m_instanceTransformBatch.GetData(), m_instanceTransformBatch.GetSizeInBytes());
+         m_instanceTransformBuffer->UnMap(context);
+      }
+
+      return true;
+   }
+
+   bool RendererPBR::AcquireFallbackTransformBuffers()
+   {
+      if (m_fallbackDrawIDBuffer != nullptr)
       {
-         ID3D11DeviceContext& context = renderer->GetDeviceContext(threadIdx);
+         return true;
+      }
+
+      StructuredBufferDescriptor transformBufferDesc;
+      transformBufferDesc.Renderer = this;
+      transformBufferDesc.Count = 1;
+      transformBufferDesc.StructSize = sizeof(InstanceTransform);
+      transformBufferDesc.bCPUWritable = true;
+      transformBufferDesc.bGPUWritable = false;
+
+      bool bIsCreated = true;
+      m_fallbackTransformBuffers.resize(GetMaximumThreads(), nullptr);
+      for (auto& fallbackTransformBuffer : m_fallbackTransformBuffers)
+      {
+         fallbackTransformBuffer = Elaina::Realize<StructuredBufferDescriptor, StructuredBufferDX11>(transformBufferDesc);
+         bIsCreated = bIsCreated && (fallbackTransformBuffer != nullptr);
+      }
+
+      auto drawIDBuffer = new VertexBufferDX11(this);
+      if (!bIsCreated || !drawIDBuffer->Init(std::vector<unsigned int>{ 0 }))
+      {
+         ME_LOG(MileRendererPBR, Fatal, TEXT("Failed to create fallback transform buffers."));
+         SafeDelete(drawIDBuffer);
+         for (auto* fallbackTransformBuffer : m_fallbackTransformBuffers)
+         {
+            SafeDelete(fallbackTransformBuffer);
+         }
+
+         m_fallbackTransformBuffers.clear();
+         return false;
+      }
+
+      m_fallbackDrawIDBuffer = drawIDBuffer;
+      return true;
+   }
+
+   void RendererPBR::RenderMeshes(RendererDX11* renderer, bool bClearGBuffer, const Meshes& meshes, size_t offset, size_t num, VertexShaderDX11* vertexShader, PixelShaderDX11* pixelShader, SamplerDX11* sampler, GBuffer* gBuffer, ConstantBufferDX11* materialParamsBuffer, StructuredBufferDX11* instanceTransformBuffer, VertexBufferDX11* drawIDBuffer, size_t firstDrawID, RasterizerState* rasterizerState, Viewport* viewport, CameraRef camera, bool bInstancingEnabled, size_t threadIdx, const InstanceTransform* fallbackTransforms)
+   {
+      OPTICK_EVENT();
+      {
+         RenderContext& context = renderer->GetDeviceContext(threadIdx);
          context.ClearState();
          context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -2884,28 +3127,32 @@ namespace Mile
          sampler->Bind(context, 0);
 
          gBuffer->BindRenderTargetView(context, bClearGBuffer, bClearGBuffer);
-         transformBuffer->Bind(context, 0, EShaderType::VertexShader);
+         instanceTransformBuffer->BindShaderResourceView(context, 0, EShaderType::VertexShader);
+         drawIDBuffer->Bind(context, INSTANCE_INPUT_SLOT);
          materialParamsBuffer->Bind(context, 0, EShaderType::PixelShader);
 
          rasterizerState->Bind(context);
          viewport->Bind(context);
 
-         auto camTransform = camera->GetTransform();
-         Matrix viewMatrix = Matrix::CreateView(
-            camTransform->GetPosition(ETransformSpace::World),
-            camTransform->GetForward(ETransformSpace::World),
-            camTransform->GetUp(ETransformSpace::World));
-         Matrix projMatrix = Matrix::CreatePerspectiveProj(
-            camera->GetFov(),
-            (viewport->GetWidth() / (float)viewport->GetHeight()),
-            camera->GetNearPlane(),
-            camera->GetFarPlane());
-
          Material* material = nullptr;
-         for (auto meshItr = meshes.begin() + offset; meshItr != meshes.begin() + offset + num; ++meshItr)
+         auto beginItr = meshes.begin() + offset;
+         auto endItr = beginItr + num;
+         for (auto meshItr = beginItr; meshItr != endItr;)
          {
             auto meshComponent = (*meshItr);
             Material* meshMaterial = meshComponent->GetMaterial();
+            Mesh* mesh = meshComponent->GetMesh();
+
+            /** Adjacent draws of same (mesh, material) pair have contiguous draw ids, so they can be drawn as instances. */
+            auto runEndItr = meshItr + 1;
+            if (bInstancingEnabled)
+            {
+               while (runEndItr != endItr && (*runEndItr)->GetMesh() == mesh && (*runEndItr)->GetMaterial() == meshMaterial)
+               {
+                  ++runEndItr;
+               }
+            }
+
             if (meshMaterial->GetMaterialType() == EMaterialType::Opaque)
             {
                if (material != meshMaterial)
@@ -2915,30 +3162,41 @@ namespace Mile
                   material->UpdateConstantBuffer(context, materialParamsBuffer, camera->Exposure());
                }
 
-               /** Render Mesh */
-               Transform* transform = meshComponent->GetTransform();
-               Mesh* mesh = meshComponent->GetMesh();
-               Matrix worldMatrix = transform->GetWorldMatrix();
-               Matrix worldViewMatrix = worldMatrix * viewMatrix;
-               auto transforms = transformBuffer->Map<GeometryPassTransformBuffer>(context);
-               transforms->WorldMatrix = worldMatrix;
-               transforms->WorldViewMatrix = worldViewMatrix;
-               transforms->WorldViewProjMatrix = (worldViewMatrix * projMatrix);
-               transformBuffer->UnMap(context);
-               mesh->Bind(context, 0);
-
-               renderer->ThreadSafeDrawIndexed(threadIdx, mesh->GetVertexCount(), mesh->GetIndexCount());
-
-               auto nextMeshItr = (meshItr + 1);
-               if (nextMeshItr == meshes.end() || (*nextMeshItr)->GetMaterial() != material)
+               /** Render Mesh; Transforms are fetched by draw id from start instance location. */
+               UINT drawID = static_cast<UINT>(firstDrawID + std::distance(beginItr, meshItr));
+               UINT instanceCount = static_cast<UINT>(std::distance(meshItr, runEndItr));
+               bool bIsDrawable = true;
+               if (fallbackTransforms != nullptr)
+               {
+                  /** Single slot buffer; Transforms of draw are uploaded right before draw. */
+                  InstanceTransform* mappedTransform = instanceTransformBuffer->Map<InstanceTransform>(context);
+                  bIsDrawable = (mappedTransform != nullptr);
+                  if (bIsDrawable)
+                  {
+                     (*mappedTransform) = fallbackTransforms[drawID];
+                     instanceTransformBuffer->UnMap(context);
+                  }
+
+                  drawID = 0;
+               }
+
+               if (bIsDrawable)
+               {
+                  mesh->Bind(context, 0);
+                  renderer->ThreadSafeDrawIndexedInstanced(threadIdx, mesh->GetVertexCount(), mesh->GetIndexCount(), instanceCount, 0, 0, drawID);
+               }
+
+               if (runEndItr == endItr || (*runEndItr)->GetMaterial() != material)
                {
                   material->UnbindTextures(context, 0, EShaderType::PixelShader);
                }
             }
+
+            meshItr = runEndItr;
          }
 
          gBuffer->UnbindRenderTargetView(context);
-         transformBuffer->Unbind(context, 0, EShaderType::VertexShader);
+         instanceTransformBuffer->UnbindShaderResourceView(context, 0, EShaderType::VertexShader);
          materialParamsBuffer->Unbind(context, 0, EShaderType::PixelShader);
 
          sampler->Unbind(context, 0);
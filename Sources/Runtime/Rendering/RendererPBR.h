@@ -1,6 +1,7 @@
 #pragma once
 #include "Rendering/RendererDX11.h"
 #include "Rendering/FrameResources.h"
+#include "Rendering/InstanceTransformBatch.h"
 #include "Elaina/FrameGraph.h"
 
 namespace Mile
@@ -59,6 +60,7 @@ namespace Mile
    };
 
    class SkyLightComponent;
+   class VertexBufferDX11;
    class MEAPI RendererPBR : public RendererDX11
    {
    public:
@@ -66,6 +68,7 @@ namespace Mile
       virtual ~RendererPBR();
 
       bool Init(Window& window) override;
+      bool InitHeadless(std::unique_ptr<RenderDevice> device, unsigned int width, unsigned int height) override;
 
       SSAOParams& GetSSAOParams() { return m_ssaoParams; }
       SSAOParams GetSSAOParams() const { return m_ssaoParams; }
@@ -82,6 +85,13 @@ namespace Mile
       bool& SSAOEnabled() { return m_bSSAOEnabled; }
       bool IsSSAOEnabled() const { return m_bSSAOEnabled; }
 
+      bool& FrustumCullingEnabled() { return m_bFrustumCullingEnabled; }
+      bool IsFrustumCullingEnabled() const { return m_bFrustumCullingEnabled; }
+
+      /** Draw identical (mesh, material) pairs of geometry pass by single instanced draw. */
+      bool& InstancingEnabled() { return m_bInstancingEnabled; }
+      bool IsInstancingEnabled() const { return m_bInstancingEnabled; }
+
       GBuffer* GetGBuffer() const { return m_gBuffer; }
       RenderTargetDX11* GetSSAOBuffer() const { return m_blurredSSAO; }
       RenderTargetDX11* GetExtractedBrightnessBuffer() const { return m_extractedBrightness; }
@@ -89,11 +99,20 @@ namespace Mile
       RenderTargetDX11* GetDebugSSAOBuffer() const { return m_ssaoDebugBuffer; }
       RenderTargetDX11* GetDebugLightingBuffer() const { return m_lightingDebugBuffer; }
 
+      const Elaina::ResourcePoolStats& GetFrameGraphPoolStats() const { return m_frameGraph.GetResourcePoolStats(); }
+      const InstanceTransformBatch& GetInstanceTransformBatch() const { return m_instanceTransformBatch; }
+
    protected:
       void RenderImpl(const World& world) override;
       void OnRenderResolutionChanged() override;
 
       void AcquireRenderResources(const World& world);
+      /** Build material map from meshes which are inside of camera frustum. */
+      void CullMeshes(CameraComponent* camera, const RenderTargetDX11& renderTarget);
+      /** Upload every packed instance transforms at once. GPU buffers grow if needed. */
+      bool UploadInstanceTransforms(RenderContext& context);
+      /** Single slot transform buffers to draw without instancing, when instance transforms could not be uploaded. */
+      bool AcquireFallbackTransformBuffers();
 
       static void RenderMeshes(
          RendererDX11* renderer,
@@ -102,12 +121,16 @@ namespace Mile
          size_t offset,
          size_t num,
          VertexShaderDX11* vertexShader, PixelShaderDX11* pixelShader, SamplerDX11* sampler, 
-         GBuffer* gBuffer, ConstantBufferDX11* transformBuffer, ConstantBufferDX11* materialParamsBuffer, 
+         GBuffer* gBuffer, ConstantBufferDX11* materialParamsBuffer,
+         StructuredBufferDX11* instanceTransformBuffer, VertexBufferDX11* drawIDBuffer, size_t firstDrawID,
          RasterizerState* rasterizeState, Viewport* viewport,
          CameraRef camera,
-         size_t threadIdx = 0);
+         bool bInstancingEnabled,
+         size_t threadIdx = 0,
+         const InstanceTransform* fallbackTransforms = nullptr);
 
    private:
+      bool InitPipeline();
       bool InitShader();
       bool InitFrameGraph();
 
@@ -183,6 +206,19 @@ namespace Mile
       Lights m_lights;
       Meshes m_meshes;
       MaterialMap m_materialMap;
+      bool m_bFrustumCullingEnabled;
+      bool m_bInstancingEnabled;
+      std::vector<UINT8> m_meshVisibility;
+      /** Transforms of geometry pass draws; indexed by draw id. */
+      InstanceTransformBatch m_instanceTransformBatch;
+      StructuredBufferDX11* m_instanceTransformBuffer;
+      /** Per instance stream of [0, capacity) which translates start instance location to draw id. */
+      VertexBufferDX11* m_drawIDBuffer;
+      size_t m_instanceTransformCapacity;
+      /** Per render thread; Transforms are mapped right before each draw. */
+      std::vector<StructuredBufferDX11*> m_fallbackTransformBuffers;
+      /** Per instance stream of single draw id 0. */
+      VertexBufferDX11* m_fallbackDrawIDBuffer;
       RenderTargetDX11* m_outputRenderTarget;
 
       /** Skybox/IBL */
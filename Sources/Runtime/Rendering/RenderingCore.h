@@ -359,7 +359,7 @@ namespace Mile
          };
       }
 
-      bool operator==(const RenderTargetBlendDesc& lhs)
+      bool operator==(const RenderTargetBlendDesc& lhs) const
       {
          return (
             BlendEnable == lhs.BlendEnable &&
@@ -372,12 +372,14 @@ namespace Mile
             RenderTargetWriteMask == lhs.RenderTargetWriteMask);
       }
 
-      bool operator!=(const RenderTargetBlendDesc& lhs)
+      bool operator!=(const RenderTargetBlendDesc& lhs) const
       {
          return !((*this) == lhs);
       }
    };
 
+   class RenderDevice;
+   class RenderContext;
    class Material;
    class MeshRenderComponent;
    using MaterialMap = std::map<Material*, std::vector<MeshRenderComponent*>>;
@@ -387,6 +389,42 @@ namespace Mile
       return static_cast<DXGI_FORMAT>(format);
    }
 
+   /** Approximate bytes per pixel of uncompressed color formats. */
+   static inline unsigned int ColorFormatToBytesPerPixel(EColorFormat format)
+   {
+      UINT32 formatValue = static_cast<UINT32>(format);
+      if (format == EColorFormat::UNKNOWN)
+      {
+         return 0;
+      }
+      else if (formatValue <= static_cast<UINT32>(EColorFormat::R32G32B32A32_SINT))
+      {
+         return 16;
+      }
+      else if (formatValue <= static_cast<UINT32>(EColorFormat::R32G32B32_SINT))
+      {
+         return 12;
+      }
+      else if (formatValue <= static_cast<UINT32>(EColorFormat::X32_TYPELESS_G8X24_UINT))
+      {
+         return 8;
+      }
+      else if (formatValue <= static_cast<UINT32>(EColorFormat::X24_TYPELESS_G8_UINT))
+      {
+         return 4;
+      }
+      else if (formatValue <= static_cast<UINT32>(EColorFormat::R16_SINT))
+      {
+         return 2;
+      }
+      else if (formatValue <= static_cast<UINT32>(EColorFormat::A8_UNORM))
+      {
+         return 1;
+      }
+
+      return 4;
+   }
+
    static inline Vector2 FindResolutionWithAspectRatio(float currentWidth, float currentHeight, float targetAspectRatio)
    {
       float width = currentWidth;
@@ -45,7 +45,7 @@ namespace Mile
 
       FORCEINLINE bool IsMapped() const { return m_bIsMapped; }
 
-      void* Map(ID3D11DeviceContext& deviceContext)
+      void* Map(RenderContext& deviceContext)
       {
          bool bIsReadyToMap = RenderObject::IsBindable() && (!IsMapped());
          if (bIsReadyToMap)
@@ -66,7 +66,7 @@ namespace Mile
          return nullptr;
       }
 
-      bool UnMap(ID3D11DeviceContext& deviceContext)
+      bool UnMap(RenderContext& deviceContext)
       {
          if (IsMapped())
          {
@@ -79,12 +79,12 @@ namespace Mile
       }
 
       template <typename ResourceType>
-      ResourceType* Map(ID3D11DeviceContext& deviceContext)
+      ResourceType* Map(RenderContext& deviceContext)
       {
          return reinterpret_cast<ResourceType*>(Map(deviceContext));
       }
 
-      bool BindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
+      bool BindShaderResourceView(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
       {
          if (m_srv != nullptr)
          {
@@ -116,7 +116,7 @@ namespace Mile
          return false;
       }
 
-      void UnbindShaderResourceView(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType boundShader)
+      void UnbindShaderResourceView(RenderContext& deviceContext, unsigned int boundSlot, EShaderType boundShader)
       {
          if (m_srv != nullptr)
          {
@@ -145,7 +145,7 @@ namespace Mile
          }
       }
 
-      bool BindUnorderedAccessView(ID3D11DeviceContext& deviceContext, unsigned int bindSlot)
+      bool BindUnorderedAccessView(RenderContext& deviceContext, unsigned int bindSlot)
       {
          if (m_uav != nullptr)
          {
@@ -156,7 +156,7 @@ namespace Mile
          return false;
       }
 
-      void UnbindUnorderedAccessView(ID3D11DeviceContext& deviceContext, unsigned int boundSlot)
+      void UnbindUnorderedAccessView(RenderContext& deviceContext, unsigned int boundSlot)
       {
          if (m_uav != nullptr)
          {
@@ -187,7 +187,7 @@ namespace Mile
          if (m_uav == nullptr)
          {
             RendererDX11* renderer = GetRenderer();
-            ID3D11Device& device = renderer->GetDevice();
+            RenderDevice& device = renderer->GetDevice();
             HRESULT result = device.CreateUnorderedAccessView(m_resource, &desc, &m_uav);
             if (!FAILED(result))
             {
@@ -46,7 +46,7 @@ namespace Mile
       return false;
    }
 
-   bool SamplerDX11::Bind(ID3D11DeviceContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
+   bool SamplerDX11::Bind(RenderContext& deviceContext, unsigned int bindSlot, EShaderType bindShader)
    {
       if (RenderObject::IsBindable())
       {
@@ -78,7 +78,7 @@ namespace Mile
       return false;
    }
 
-   void SamplerDX11::Unbind(ID3D11DeviceContext& deviceContext, unsigned int boundSlot, EShaderType bondShader)
+   void SamplerDX11::Unbind(RenderContext& deviceContext, unsigned int boundSlot, EShaderType bondShader)
    {
       if (RenderObject::IsBindable())
       {
@@ -34,7 +34,7 @@ namespace Mile
       }
 
       RendererDX11* renderer = GetRenderer();
-      ID3D11Device& device = renderer->GetDevice();
+      RenderDevice& device = renderer->GetDevice();
 
       HRESULT result = device.CreateBuffer(&desc, data, reinterpret_cast<ID3D11Buffer**>(&m_resource));
       if (FAILED(result))
@@ -42,14 +42,18 @@ namespace Mile
          return false;
       }
 
-      D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
-      ZeroMemory(&uavDesc, sizeof(uavDesc));
-      uavDesc.Format = DXGI_FORMAT_UNKNOWN;
-      uavDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
-      uavDesc.Buffer.NumElements = count;
-      if (!ResourceDX11::InitUnorderedAccessView(uavDesc))
+      /** Dynamic buffer can't have unordered access view. */
+      if (bGPUWritable)
       {
-         return false;
+         D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+         ZeroMemory(&uavDesc, sizeof(uavDesc));
+         uavDesc.Format = DXGI_FORMAT_UNKNOWN;
+         uavDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+         uavDesc.Buffer.NumElements = count;
+         if (!ResourceDX11::InitUnorderedAccessView(uavDesc))
+         {
+            return false;
+         }
       }
 
       D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
@@ -62,6 +66,7 @@ namespace Mile
          return false;
       }
 
+      RenderObject::ConfirmInit();
       return true;
    }
 }
\ No newline at end of file
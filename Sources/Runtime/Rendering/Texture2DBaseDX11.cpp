@@ -11,7 +11,7 @@ namespace Mile
    {
    }
 
-   void Texture2DBaseDX11::GenerateMips(ID3D11DeviceContext& deviceContext)
+   void Texture2DBaseDX11::GenerateMips(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -13,7 +13,7 @@ namespace Mile
       FORCEINLINE unsigned int GetMipLevels() const { return m_mipLevels; }
       virtual ERenderResourceType GetResourceType() const override { return ERenderResourceType::Texture2D; }
 
-      void GenerateMips(ID3D11DeviceContext& deviceContext);
+      void GenerateMips(RenderContext& deviceContext);
 
    protected:
       bool InitSRV(D3D11_TEXTURE2D_DESC desc, bool bIsCubemap = false);
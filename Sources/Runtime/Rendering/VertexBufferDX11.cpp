@@ -8,7 +8,7 @@ namespace Mile
    {
    }
 
-   bool VertexBufferDX11::Bind(ID3D11DeviceContext& deviceContext, unsigned int startSlot)
+   bool VertexBufferDX11::Bind(RenderContext& deviceContext, unsigned int startSlot)
    {
       if (RenderObject::IsBindable())
       {
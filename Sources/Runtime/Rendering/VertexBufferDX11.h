@@ -40,7 +40,7 @@ namespace Mile
          return false;
       }
 
-      bool Bind(ID3D11DeviceContext& deviceContext, unsigned int startSlot);
+      bool Bind(RenderContext& deviceContext, unsigned int startSlot);
 
       virtual ERenderResourceType GetResourceType() const override { return ERenderResourceType::VertexBuffer; }
       FORCEINLINE unsigned int GetStride() const { return m_stride; }
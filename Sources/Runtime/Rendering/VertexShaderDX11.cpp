@@ -52,7 +52,7 @@ namespace Mile
       return false;
    }
 
-   bool VertexShaderDX11::Bind(ID3D11DeviceContext& deviceContext)
+   bool VertexShaderDX11::Bind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -66,7 +66,7 @@ namespace Mile
       return false;
    }
 
-   void VertexShaderDX11::Unbind(ID3D11DeviceContext& deviceContext)
+   void VertexShaderDX11::Unbind(RenderContext& deviceContext)
    {
       if (RenderObject::IsBindable())
       {
@@ -102,6 +102,14 @@ namespace Mile
          elementDesc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
          elementDesc.InstanceDataStepRate = 0;
 
+         /** Semantics which start with 'INSTANCE_' are fetched per instance from input slot 1. */
+         if (std::strncmp(paramDesc.SemanticName, INSTANCE_SEMANTIC_PREFIX, std::strlen(INSTANCE_SEMANTIC_PREFIX)) == 0)
+         {
+            elementDesc.InputSlot = INSTANCE_INPUT_SLOT;
+            elementDesc.InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+            elementDesc.InstanceDataStepRate = 1;
+         }
+
          if (paramDesc.Mask == 1)
          {
             if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) elementDesc.Format = DXGI_FORMAT_R32_UINT;
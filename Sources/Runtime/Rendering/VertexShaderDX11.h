@@ -3,6 +3,10 @@
 
 namespace Mile
 {
+   /** Vertex shader inputs with this semantic prefix are per instance data of INSTANCE_INPUT_SLOT. */
+   constexpr char INSTANCE_SEMANTIC_PREFIX[] = "INSTANCE_";
+   constexpr unsigned int INSTANCE_INPUT_SLOT = 1;
+
    class InputLayoutDX11;
    class MEAPI VertexShaderDX11 : public ShaderDX11
    {
@@ -13,8 +17,8 @@ namespace Mile
       virtual ~VertexShaderDX11();
 
       virtual bool Init(const String& shaderPath) override;
-      virtual bool Bind(ID3D11DeviceContext& deviceContext) override;
-      virtual void Unbind(ID3D11DeviceContext& deviceContext) override;
+      virtual bool Bind(RenderContext& deviceContext) override;
+      virtual void Unbind(RenderContext& deviceContext) override;
 
       virtual EShaderType GetShaderType() const override { return EShaderType::VertexShader; }
 
@@ -26,7 +26,7 @@ namespace Mile
       return viewport;
    }
 
-   bool Viewport::Bind(ID3D11DeviceContext& deviceContext)
+   bool Viewport::Bind(RenderContext& deviceContext)
    {
       if (IsBindable())
       {
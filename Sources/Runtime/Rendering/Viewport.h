@@ -29,7 +29,7 @@ namespace Mile
 
       D3D11_VIEWPORT GetD3DViewport() const;
 
-      bool Bind(ID3D11DeviceContext& deviceContext);
+      bool Bind(RenderContext& deviceContext);
 
    public:
       float m_width;
@@ -253,26 +253,28 @@ namespace Mile
          return;
       }
 
-      SetTexture2D(
-         MaterialTextureProperty::BaseColor,
-         m_resMng->Load<Texture2D>(String2WString(GetValueSafelyFromJson<std::string>(jsonData, "BaseColor"))));
+      /** Textures are decoded in parallel. */
+      std::vector<Texture2D*> textures = m_resMng->LoadBatch<Texture2D>({
+         String2WString(GetValueSafelyFromJson<std::string>(jsonData, "BaseColor")),
+         String2WString(GetValueSafelyFromJson<std::string>(jsonData, "Emissive")),
+         String2WString(GetValueSafelyFromJson<std::string>(jsonData, "MetallicRoughness")),
+         String2WString(GetValueSafelyFromJson<std::string>(jsonData, "AO")),
+         String2WString(GetValueSafelyFromJson<std::string>(jsonData, "Normal")) });
+
+      SetTexture2D(MaterialTextureProperty::BaseColor, textures[0]);
 
       m_baseColorFactor.DeSerialize(GetValueSafelyFromJson<json>(
          jsonData, 
          "BaseColorFactor",
          m_baseColorFactor.Serialize()));
 
-      SetTexture2D(
-         MaterialTextureProperty::Emissive,
-         m_resMng->Load<Texture2D>(String2WString(GetValueSafelyFromJson<std::string>(jsonData, "Emissive"))));
+      SetTexture2D(MaterialTextureProperty::Emissive, textures[1]);
 
       m_emissiveFactor = GetValueSafelyFromJson<json>(
          jsonData,
          "EmissiveFactor", 0.0f);
 
-      SetTexture2D(
-         MaterialTextureProperty::MetallicRoughness,
-         m_resMng->Load<Texture2D>(String2WString(GetValueSafelyFromJson<std::string>(jsonData, "MetallicRoughness"))));
+      SetTexture2D(MaterialTextureProperty::MetallicRoughness, textures[2]);
 
       m_metallicFactor = GetValueSafelyFromJson(jsonData, "MetallicFactor", 0.0f);
       m_roughnessFactor = GetValueSafelyFromJson(jsonData, "RoughnessFactor", 0.0f);
@@ -284,16 +286,11 @@ namespace Mile
          "UVOffset",
          m_uvOffset.Serialize()));
 
-      SetTexture2D(
-         MaterialTextureProperty::AO,
-         m_resMng->Load<Texture2D>(String2WString(GetValueSafelyFromJson<std::string>(jsonData, "AO"))));
-
-      SetTexture2D(
-         MaterialTextureProperty::Normal,
-         m_resMng->Load<Texture2D>(String2WString(GetValueSafelyFromJson<std::string>(jsonData, "Normal"))));
+      SetTexture2D(MaterialTextureProperty::AO, textures[3]);
+      SetTexture2D(MaterialTextureProperty::Normal, textures[4]);
    }
 
-   void Material::BindTextures(ID3D11DeviceContext& context, unsigned int bindSlot, EShaderType shaderType)
+   void Material::BindTextures(RenderContext& context, unsigned int bindSlot, EShaderType shaderType)
    {
       SAFE_SHADER_RESOURCE_VIEW_BIND(m_baseColor == nullptr ? nullptr : m_baseColor->GetRawTexture(), context, 0, shaderType);
       SAFE_SHADER_RESOURCE_VIEW_BIND(m_emissive == nullptr ? nullptr : m_emissive->GetRawTexture(), context, 1, shaderType);
@@ -302,7 +299,7 @@ namespace Mile
       SAFE_SHADER_RESOURCE_VIEW_BIND(m_normal == nullptr ? nullptr : m_normal->GetRawTexture(), context, 4, shaderType);
    }
 
-   void Material::UnbindTextures(ID3D11DeviceContext& context, unsigned int boundSlot, EShaderType shaderType)
+   void Material::UnbindTextures(RenderContext& context, unsigned int boundSlot, EShaderType shaderType)
    {
       SAFE_SHADER_RESOURCE_VIEW_UNBIND(m_baseColor == nullptr ? nullptr : m_baseColor->GetRawTexture(), context, 0, shaderType);
       SAFE_SHADER_RESOURCE_VIEW_UNBIND(m_emissive == nullptr ? nullptr : m_emissive->GetRawTexture(), context, 1, shaderType);
@@ -311,7 +308,7 @@ namespace Mile
       SAFE_SHADER_RESOURCE_VIEW_UNBIND(m_normal == nullptr ? nullptr : m_normal->GetRawTexture(), context, 4, shaderType);
    }
 
-   void Material::UpdateConstantBuffer(ID3D11DeviceContext& context, ConstantBufferDX11* buffer, float exposure) const
+   void Material::UpdateConstantBuffer(RenderContext& context, ConstantBufferDX11* buffer, float exposure) const
    {
       auto materialParamsBuffer = buffer->Map<PackedMaterialParams>(context);
       materialParamsBuffer->BaseColorFactor = m_baseColorFactor;
@@ -69,9 +69,9 @@ namespace Mile
       virtual json Serialize() const override;
       virtual void DeSerialize(const json& jsonData) override;
 
-      void BindTextures(ID3D11DeviceContext& context, unsigned int bindSlot, EShaderType shaderType);
-      void UnbindTextures(ID3D11DeviceContext& context, unsigned int boundSlot, EShaderType shaderType);
-      void UpdateConstantBuffer(ID3D11DeviceContext& context, ConstantBufferDX11* buffer, float exposure = 1.0f) const;
+      void BindTextures(RenderContext& context, unsigned int bindSlot, EShaderType shaderType);
+      void UnbindTextures(RenderContext& context, unsigned int boundSlot, EShaderType shaderType);
+      void UpdateConstantBuffer(RenderContext& context, ConstantBufferDX11* buffer, float exposure = 1.0f) const;
 
    private:
       EMaterialType m_materialType;
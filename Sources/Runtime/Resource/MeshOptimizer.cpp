@@ -0,0 +1,474 @@
+#include "Resource/MeshOptimizer.h"
+
+namespace Mile
+{
+   /** Forsyth's scoring parameters; Cache size is only used for scoring, it does not have to match hardware. */
+   constexpr unsigned int VERTEX_CACHE_SCORE_SIZE = 32;
+   constexpr unsigned int VERTEX_VALENCE_SCORE_SIZE = 32;
+   constexpr float VERTEX_CACHE_DECAY_POWER = 1.5f;
+   constexpr float VERTEX_LAST_TRIANGLE_SCORE = 0.75f;
+   constexpr float VERTEX_VALENCE_BOOST_SCALE = 2.0f;
+   constexpr float VERTEX_VALENCE_BOOST_POWER = 0.5f;
+
+   struct VertexScoreTable
+   {
+      VertexScoreTable()
+      {
+         for (unsigned int pos = 0; pos < VERTEX_CACHE_SCORE_SIZE; ++pos)
+         {
+            if (pos < 3)
+            {
+               /** Vertices of last triangle get fixed score to avoid using them for next triangle immediately. */
+               Cache[pos] = VERTEX_LAST_TRIANGLE_SCORE;
+            }
+            else
+            {
+               float scaler = 1.0f / static_cast<float>(VERTEX_CACHE_SCORE_SIZE - 3);
+               Cache[pos] = std::pow(1.0f - static_cast<float>(pos - 3) * scaler, VERTEX_CACHE_DECAY_POWER);
+            }
+         }
+
+         Valence[0] = 0.0f;
+         for (unsigned int valence = 1; valence < VERTEX_VALENCE_SCORE_SIZE; ++valence)
+         {
+            /** Boost vertices which have only few triangles left, to get rid of lone triangles. */
+            Valence[valence] = VERTEX_VALENCE_BOOST_SCALE * std::pow(static_cast<float>(valence), -VERTEX_VALENCE_BOOST_POWER);
+         }
+      }
+
+      float Get(int cachePosition, unsigned int liveTriangleNum) const
+      {
+         if (liveTriangleNum == 0)
+         {
+            return -1.0f;
+         }
+
+         float score = Valence[std::min(liveTriangleNum, VERTEX_VALENCE_SCORE_SIZE - 1)];
+         if (cachePosition >= 0)
+         {
+            score += Cache[cachePosition];
+         }
+
+         return score;
+      }
+
+      float Cache[VERTEX_CACHE_SCORE_SIZE];
+      float Valence[VERTEX_VALENCE_SCORE_SIZE];
+   };
+
+   /** FIFO cache simulation by timestamp. Returns number of cache misses of triangle. */
+   static unsigned int SimulateFIFOCache(const unsigned int* triangle, std::vector<unsigned int>& timestamps, unsigned int& timestamp, unsigned int cacheSize)
+   {
+      unsigned int misses = 0;
+      for (unsigned int corner = 0; corner < 3; ++corner)
+      {
+         unsigned int vertex = triangle[corner];
+         if ((timestamp - timestamps[vertex]) > cacheSize)
+         {
+            timestamps[vertex] = timestamp++;
+            ++misses;
+         }
+      }
+
+      return misses;
+   }
+
+   static const float* GetPosition(const void* vertices, size_t vertexStride, unsigned int vertex)
+   {
+      return reinterpret_cast<const float*>(reinterpret_cast<const UINT8*>(vertices) + vertexStride * vertex);
+   }
+
+   UINT64 MeshOptimizer::HashBytes(const void* data, size_t size, UINT64 seed)
+   {
+      /** FNV-1a */
+      const UINT8* bytes = reinterpret_cast<const UINT8*>(data);
+      UINT64 hash = seed;
+      for (size_t idx = 0; idx < size; ++idx)
+      {
+         hash ^= bytes[idx];
+         hash *= 1099511628211ULL;
+      }
+
+      return hash;
+   }
+
+   size_t MeshOptimizer::GenerateWeldRemap(std::vector<unsigned int>& remap, const void* vertices, size_t vertexNum, size_t vertexStride)
+   {
+      remap.assign(vertexNum, UINT_MAX);
+
+      /** Open addressing hash table of vertex indices. */
+      size_t tableSize = 1;
+      while (tableSize < vertexNum * 2)
+      {
+         tableSize <<= 1;
+      }
+
+      std::vector<unsigned int> table(tableSize, UINT_MAX);
+      const UINT8* bytes = reinterpret_cast<const UINT8*>(vertices);
+      size_t uniqueVertexNum = 0;
+      for (size_t vertex = 0; vertex < vertexNum; ++vertex)
+      {
+         const UINT8* vertexBytes = bytes + vertexStride * vertex;
+         size_t bucket = static_cast<size_t>(HashBytes(vertexBytes, vertexStride)) & (tableSize - 1);
+         while (table[bucket] != UINT_MAX &&
+            std::memcmp(bytes + vertexStride * table[bucket], vertexBytes, vertexStride) != 0)
+         {
+            bucket = (bucket + 1) & (tableSize - 1);
+         }
+
+         if (table[bucket] == UINT_MAX)
+         {
+            table[bucket] = static_cast<unsigned int>(vertex);
+            remap[vertex] = static_cast<unsigned int>(uniqueVertexNum++);
+         }
+         else
+         {
+            remap[vertex] = remap[table[bucket]];
+         }
+      }
+
+      return uniqueVertexNum;
+   }
+
+   void MeshOptimizer::OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexNum)
+   {
+      static const VertexScoreTable scoreTable;
+
+      size_t triangleNum = indices.size() / 3;
+      if (triangleNum == 0 || vertexNum == 0)
+      {
+         return;
+      }
+
+      /** Vertex -> Triangles adjacency. Live triangles of vertex are packed at front of its range. */
+      std::vector<unsigned int> liveTriangleNums(vertexNum, 0);
+      for (unsigned int index : indices)
+      {
+         ++liveTriangleNums[index];
+      }
+
+      std::vector<unsigned int> adjacencyOffsets(vertexNum + 1, 0);
+      for (size_t vertex = 0; vertex < vertexNum; ++vertex)
+      {
+         adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + liveTriangleNums[vertex];
+      }
+
+      std::vector<unsigned int> adjacency(indices.size());
+      std::vector<unsigned int> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+      for (size_t triangle = 0; triangle < triangleNum; ++triangle)
+      {
+         for (size_t corner = 0; corner < 3; ++corner)
+         {
+            adjacency[fillOffsets[indices[triangle * 3 + corner]]++] = static_cast<unsigned int>(triangle);
+         }
+      }
+
+      std::vector<int> cachePositions(vertexNum, -1);
+      std::vector<float> vertexScores(vertexNum);
+      for (size_t vertex = 0; vertex < vertexNum; ++vertex)
+      {
+         vertexScores[vertex] = scoreTable.Get(-1, liveTriangleNums[vertex]);
+      }
+
+      std::vector<float> triangleScores(triangleNum);
+      for (size_t triangle = 0; triangle < triangleNum; ++triangle)
+      {
+         const unsigned int* tri = &indices[triangle * 3];
+         triangleScores[triangle] = vertexScores[tri[0]] + vertexScores[tri[1]] + vertexScores[tri[2]];
+      }
+
+      std::vector<bool> emitted(triangleNum, false);
+      std::vector<unsigned int> result;
+      result.reserve(indices.size());
+
+      std::vector<unsigned int> cache;
+      std::vector<unsigned int> newCache;
+      cache.reserve(VERTEX_CACHE_SCORE_SIZE + 3);
+      newCache.reserve(VERTEX_CACHE_SCORE_SIZE + 3);
+
+      size_t bestTriangle = 0;
+      for (size_t triangle = 1; triangle < triangleNum; ++triangle)
+      {
+         if (triangleScores[triangle] > triangleScores[bestTriangle])
+         {
+            bestTriangle = triangle;
+         }
+      }
+
+      size_t inputCursor = 0;
+      while (bestTriangle != SIZE_MAX)
+      {
+         const unsigned int* tri = &indices[bestTriangle * 3];
+         result.insert(result.end(), tri, tri + 3);
+         emitted[bestTriangle] = true;
+
+         /** Remove emitted triangle from adjacency of its vertices. */
+         for (size_t corner = 0; corner < 3; ++corner)
+         {
+            unsigned int vertex = tri[corner];
+            unsigned int* begin = &adjacency[adjacencyOffsets[vertex]];
+            unsigned int* end = begin + liveTriangleNums[vertex];
+            unsigned int* found = std::find(begin, end, static_cast<unsigned int>(bestTriangle));
+            if (found != end)
+            {
+               std::swap(*found, *(end - 1));
+               --liveTriangleNums[vertex];
+            }
+         }
+
+         /** Vertices of emitted triangle move to front of cache (LRU). */
+         newCache.clear();
+         for (size_t corner = 0; corner < 3; ++corner)
+         {
+            /** Degenerate triangle must not occupy multiple cache entries. */
+            if (std::find(newCache.begin(), newCache.end(), tri[corner]) == newCache.end())
+            {
+               newCache.push_back(tri[corner]);
+            }
+         }
+
+         for (unsigned int vertex : cache)
+         {
+            if (vertex != tri[0] && vertex != tri[1] && vertex != tri[2])
+            {
+               newCache.push_back(vertex);
+            }
+         }
+
+         bestTriangle = SIZE_MAX;
+         float bestScore = -1.0f;
+         for (size_t pos = 0; pos < newCache.size(); ++pos)
+         {
+            unsigned int vertex = newCache[pos];
+            cachePositions[vertex] = (pos < VERTEX_CACHE_SCORE_SIZE) ? static_cast<int>(pos) : -1;
+
+            float newScore = scoreTable.Get(cachePositions[vertex], liveTriangleNums[vertex]);
+            float scoreDelta = newScore - vertexScores[vertex];
+            vertexScores[vertex] = newScore;
+
+            const unsigned int* adjacent = &adjacency[adjacencyOffsets[vertex]];
+            for (unsigned int adjIdx = 0; adjIdx < liveTriangleNums[vertex]; ++adjIdx)
+            {
+               unsigned int triangle = adjacent[adjIdx];
+               triangleScores[triangle] += scoreDelta;
+               if (triangleScores[triangle] > bestScore)
+               {
+                  bestScore = triangleScores[triangle];
+                  bestTriangle = triangle;
+               }
+            }
+         }
+
+         if (newCache.size() > VERTEX_CACHE_SCORE_SIZE)
+         {
+            newCache.resize(VERTEX_CACHE_SCORE_SIZE);
+         }
+         std::swap(cache, newCache);
+
+         /** Cache does not touch any live triangle; Continue from next triangle in input order. */
+         if (bestTriangle == SIZE_MAX)
+         {
+            while (inputCursor < triangleNum && emitted[inputCursor])
+            {
+               ++inputCursor;
+            }
+
+            if (inputCursor < triangleNum)
+            {
+               bestTriangle = inputCursor;
+            }
+         }
+      }
+
+      indices = std::move(result);
+   }
+
+   void MeshOptimizer::OptimizeOverdraw(std::vector<unsigned int>& indices, const void* vertices, size_t vertexNum, size_t vertexStride, float threshold)
+   {
+      size_t triangleNum = indices.size() / 3;
+      if (triangleNum == 0 || vertexNum == 0)
+      {
+         return;
+      }
+
+      std::vector<unsigned int> timestamps(vertexNum, 0);
+      unsigned int timestamp = SIMULATED_CACHE_SIZE + 1;
+
+      /** Hard boundaries; Triangle which misses every vertex usually starts disjoint patch of mesh. */
+      std::vector<size_t> hardBoundaries;
+      for (size_t triangle = 0; triangle < triangleNum; ++triangle)
+      {
+         unsigned int misses = SimulateFIFOCache(&indices[triangle * 3], timestamps, timestamp, SIMULATED_CACHE_SIZE);
+         if (triangle == 0 || misses == 3)
+         {
+            hardBoundaries.push_back(triangle);
+         }
+      }
+      hardBoundaries.push_back(triangleNum);
+
+      /** Soft boundaries; Split patch as soon as running ACMR of cluster reaches threshold of patch ACMR. */
+      std::vector<size_t> clusters;
+      for (size_t hardIdx = 0; hardIdx + 1 < hardBoundaries.size(); ++hardIdx)
+      {
+         size_t begin = hardBoundaries[hardIdx];
+         size_t end = hardBoundaries[hardIdx + 1];
+
+         timestamp += SIMULATED_CACHE_SIZE + 1;
+         unsigned int patchMisses = 0;
+         for (size_t triangle = begin; triangle < end; ++triangle)
+         {
+            patchMisses += SimulateFIFOCache(&indices[triangle * 3], timestamps, timestamp, SIMULATED_CACHE_SIZE);
+         }
+
+         float patchThreshold = threshold * static_cast<float>(patchMisses) / static_cast<float>(end - begin);
+
+         clusters.push_back(begin);
+         timestamp += SIMULATED_CACHE_SIZE + 1;
+         unsigned int runningMisses = 0;
+         unsigned int runningTriangles = 0;
+         for (size_t triangle = begin; triangle < end; ++triangle)
+         {
+            runningMisses += SimulateFIFOCache(&indices[triangle * 3], timestamps, timestamp, SIMULATED_CACHE_SIZE);
+            ++runningTriangles;
+            if (static_cast<float>(runningMisses) / static_cast<float>(runningTriangles) <= patchThreshold)
+            {
+               clusters.push_back(triangle + 1);
+               timestamp += SIMULATED_CACHE_SIZE + 1;
+               runningMisses = 0;
+               runningTriangles = 0;
+            }
+         }
+
+         if (clusters.back() == end)
+         {
+            clusters.pop_back();
+         }
+      }
+      clusters.push_back(triangleNum);
+
+      /** Mesh centroid which is weighted by every triangle corner. */
+      float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+      for (unsigned int index : indices)
+      {
+         const float* position = GetPosition(vertices, vertexStride, index);
+         meshCentroid[0] += position[0];
+         meshCentroid[1] += position[1];
+         meshCentroid[2] += position[2];
+      }
+
+      float invIndexNum = 1.0f / static_cast<float>(indices.size());
+      meshCentroid[0] *= invIndexNum;
+      meshCentroid[1] *= invIndexNum;
+      meshCentroid[2] *= invIndexNum;
+
+      /** Clusters which face outward from center of mesh are likely to occlude others, so draw them first. */
+      size_t clusterNum = clusters.size() - 1;
+      std::vector<float> sortKeys(clusterNum);
+      for (size_t cluster = 0; cluster < clusterNum; ++cluster)
+      {
+         float centroid[3] = { 0.0f, 0.0f, 0.0f };
+         float normal[3] = { 0.0f, 0.0f, 0.0f };
+         float area = 0.0f;
+         for (size_t triangle = clusters[cluster]; triangle < clusters[cluster + 1]; ++triangle)
+         {
+            const float* p0 = GetPosition(vertices, vertexStride, indices[triangle * 3 + 0]);
+            const float* p1 = GetPosition(vertices, vertexStride, indices[triangle * 3 + 1]);
+            const float* p2 = GetPosition(vertices, vertexStride, indices[triangle * 3 + 2]);
+
+            float e0[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            float e1[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            float cross[3] = {
+               e0[1] * e1[2] - e0[2] * e1[1],
+               e0[2] * e1[0] - e0[0] * e1[2],
+               e0[0] * e1[1] - e0[1] * e1[0] };
+
+            /** Length of cross product is twice the area of triangle. */
+            float triangleArea = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+               centroid[axis] += (p0[axis] + p1[axis] + p2[axis]) * (triangleArea / 3.0f);
+               normal[axis] += cross[axis];
+            }
+            area += triangleArea;
+         }
+
+         float invArea = (area == 0.0f) ? 0.0f : (1.0f / area);
+         float normalLength = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+         float invNormalLength = (normalLength == 0.0f) ? 0.0f : (1.0f / normalLength);
+
+         float sortKey = 0.0f;
+         for (size_t axis = 0; axis < 3; ++axis)
+         {
+            sortKey += (centroid[axis] * invArea - meshCentroid[axis]) * (normal[axis] * invNormalLength);
+         }
+         sortKeys[cluster] = sortKey;
+      }
+
+      std::vector<size_t> order(clusterNum);
+      for (size_t cluster = 0; cluster < clusterNum; ++cluster)
+      {
+         order[cluster] = cluster;
+      }
+
+      std::stable_sort(order.begin(), order.end(),
+         [&sortKeys](size_t lhs, size_t rhs) { return sortKeys[lhs] > sortKeys[rhs]; });
+
+      std::vector<unsigned int> result;
+      result.reserve(indices.size());
+      for (size_t cluster : order)
+      {
+         result.insert(result.end(),
+            indices.begin() + clusters[cluster] * 3,
+            indices.begin() + clusters[cluster + 1] * 3);
+      }
+
+      indices = std::move(result);
+   }
+
+   size_t MeshOptimizer::GenerateVertexFetchRemap(std::vector<unsigned int>& remap, const std::vector<unsigned int>& indices, size_t vertexNum)
+   {
+      remap.assign(vertexNum, UINT_MAX);
+
+      unsigned int referencedVertexNum = 0;
+      for (unsigned int index : indices)
+      {
+         if (remap[index] == UINT_MAX)
+         {
+            remap[index] = referencedVertexNum++;
+         }
+      }
+
+      return referencedVertexNum;
+   }
+
+   VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const std::vector<unsigned int>& indices, size_t vertexNum, unsigned int cacheSize)
+   {
+      VertexCacheStatistics stats;
+      stats.TriangleNum = static_cast<UINT32>(indices.size() / 3);
+      if (stats.TriangleNum == 0 || vertexNum == 0)
+      {
+         return stats;
+      }
+
+      std::vector<unsigned int> timestamps(vertexNum, 0);
+      unsigned int timestamp = cacheSize + 1;
+      for (size_t triangle = 0; triangle < stats.TriangleNum; ++triangle)
+      {
+         stats.TransformedVertexNum += SimulateFIFOCache(&indices[triangle * 3], timestamps, timestamp, cacheSize);
+      }
+
+      std::vector<bool> referenced(vertexNum, false);
+      for (unsigned int index : indices)
+      {
+         if (!referenced[index])
+         {
+            referenced[index] = true;
+            ++stats.ReferencedVertexNum;
+         }
+      }
+
+      stats.ACMR = static_cast<float>(stats.TransformedVertexNum) / static_cast<float>(stats.TriangleNum);
+      stats.ATVR = static_cast<float>(stats.TransformedVertexNum) / static_cast<float>(stats.ReferencedVertexNum);
+      return stats;
+   }
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "Core/CoreMinimal.h"
+
+namespace Mile
+{
+   /**
+    * @brief   Post-transform vertex cache efficiency of index buffer, simulated with FIFO cache.
+    *          ACMR : Average Cache Miss Ratio (Transformed vertices per triangle, 0.5 ~ 3.0)
+    *          ATVR : Average Transformed Vertex Ratio (Transformed vertices per referenced vertex, 1.0 is optimal)
+    */
+   struct MEAPI VertexCacheStatistics
+   {
+      UINT32 TransformedVertexNum = 0;
+      UINT32 ReferencedVertexNum = 0;
+      UINT32 TriangleNum = 0;
+      float ACMR = 0.0f;
+      float ATVR = 0.0f;
+   };
+
+   /**
+    * @brief   Import time optimizations for indexed triangle list.
+    *          Every index buffer is triangle list which has 32 bit indices.
+    *          Vertex data is treated as opaque bytes except position which is read as float3 at beginning of each vertex.
+    */
+   class MEAPI MeshOptimizer
+   {
+   public:
+      /** Cache size which is used to report statistics; Similar to post-transform cache of modern GPUs. */
+      static constexpr unsigned int SIMULATED_CACHE_SIZE = 16;
+      /** Overdraw optimization may increase ACMR up to this ratio. */
+      static constexpr float DEFAULT_OVERDRAW_THRESHOLD = 1.05f;
+
+      /**
+      * @brief   Pick one vertex from every set of bitwise identical vertices.
+      * @return  Number of unique vertices; remap[old] = new
+      */
+      static size_t GenerateWeldRemap(std::vector<unsigned int>& remap, const void* vertices, size_t vertexNum, size_t vertexStride);
+
+      /**
+      * @brief   Reorder triangles for post-transform vertex cache locality. (Tom Forsyth, Linear-Speed Vertex Cache Optimisation)
+      */
+      static void OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexNum);
+
+      /**
+      * @brief   Split cache optimized triangles into clusters and sort them outside-in, so front most triangles tend to be drawn first.
+      *          Cluster boundaries are chosen to keep ACMR under threshold * original ACMR. (Sander et al., Tipsify)
+      */
+      static void OptimizeOverdraw(std::vector<unsigned int>& indices, const void* vertices, size_t vertexNum, size_t vertexStride, float threshold = DEFAULT_OVERDRAW_THRESHOLD);
+
+      /**
+      * @brief   Order vertices by first reference in index buffer. Unreferenced vertices are dropped.
+      * @return  Number of referenced vertices; remap[old] = new or UINT_MAX if it is not referenced.
+      */
+      static size_t GenerateVertexFetchRemap(std::vector<unsigned int>& remap, const std::vector<unsigned int>& indices, size_t vertexNum);
+
+      static VertexCacheStatistics AnalyzeVertexCache(const std::vector<unsigned int>& indices, size_t vertexNum, unsigned int cacheSize = SIMULATED_CACHE_SIZE);
+
+      /** 0xffff is reserved as strip cut value; Largest index of 0xffff vertices is 0xfffe. */
+      static bool CanUse16BitIndices(size_t vertexNum) { return vertexNum <= 0xffff; }
+
+      static UINT64 HashBytes(const void* data, size_t size, UINT64 seed = 14695981039346656037ULL);
+
+      template <typename Vertex>
+      static void RemapVertices(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, const std::vector<unsigned int>& remap, size_t newVertexNum)
+      {
+         std::vector<Vertex> remapped(newVertexNum);
+         for (size_t idx = 0; idx < vertices.size(); ++idx)
+         {
+            if (remap[idx] != UINT_MAX)
+            {
+               remapped[remap[idx]] = vertices[idx];
+            }
+         }
+
+         for (auto& index : indices)
+         {
+            index = remap[index];
+         }
+
+         vertices = std::move(remapped);
+      }
+
+      /**
+      * @brief   Weld -> Vertex cache -> Overdraw -> Vertex fetch.
+      *          Vertex type must begin with position.
+      */
+      template <typename Vertex>
+      static void Optimize(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, float overdrawThreshold = DEFAULT_OVERDRAW_THRESHOLD)
+      {
+         std::vector<unsigned int> remap;
+         size_t uniqueVertexNum = GenerateWeldRemap(remap, vertices.data(), vertices.size(), sizeof(Vertex));
+         RemapVertices(vertices, indices, remap, uniqueVertexNum);
+
+         OptimizeVertexCache(indices, vertices.size());
+         OptimizeOverdraw(indices, vertices.data(), vertices.size(), sizeof(Vertex), overdrawThreshold);
+
+         size_t referencedVertexNum = GenerateVertexFetchRemap(remap, indices, vertices.size());
+         RemapVertices(vertices, indices, remap, referencedVertexNum);
+      }
+
+   };
+}
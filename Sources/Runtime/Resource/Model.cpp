@@ -37,7 +37,7 @@ namespace Mile
             return false;
          }
 
-         m_serializedInstance = m_instance->Serialize().dump();
+         m_prefab.Compile(m_instance);
          SucceedInit();
          return true;
       }
@@ -102,10 +102,11 @@ namespace Mile
 
    Entity* Model::Instantiate(Model* target, World* targetWorld, const String& entityName)
    {
-      Entity* tempEntity = targetWorld->CreateEntity(TEXT(""));
-      auto serialized = json::parse(target->m_serializedInstance);
-      tempEntity->DeSerialize(serialized);
-      tempEntity->SetName(entityName);
-      return tempEntity;
+      return target->m_prefab.Instantiate(targetWorld, entityName);
+   }
+
+   std::vector<Entity*> Model::InstantiateMany(Model* target, World* targetWorld, size_t count, const String& entityName)
+   {
+      return target->m_prefab.InstantiateMany(targetWorld, count, entityName);
    }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Resource/Resource.h"
 #include "Core/Logger.h"
+#include "GameFramework/Prefab.h"
 
 namespace Mile
 {
@@ -17,6 +18,7 @@ namespace Mile
          object["GenUVs"] = GenUVs;
          object["GenSmoothNormals"] = GenSmoothNormals;
          object["PreTransformVertices"] = PreTransformVertices;
+         object["OptimizeMesh"] = OptimizeMesh;
          return object;
       }
 
@@ -28,6 +30,7 @@ namespace Mile
          GenUVs = GetValueSafelyFromJson(data, "GenUVs", true);
          GenSmoothNormals = GetValueSafelyFromJson(data, "GenSmoothNormals", true);
          PreTransformVertices = GetValueSafelyFromJson(data, "PreTransformVertices", true);
+         OptimizeMesh = GetValueSafelyFromJson(data, "OptimizeMesh", true);
       }
 
       bool ConvertToLeftHanded = true;
@@ -36,6 +39,8 @@ namespace Mile
       bool GenUVs = true;
       bool GenSmoothNormals = true;
       bool PreTransformVertices = true;
+      /** Weld and reorder vertices/indices at import time. Result is cached next to .meta file. */
+      bool OptimizeMesh = true;
    };
 
    class Entity;
@@ -60,11 +65,12 @@ namespace Mile
       void SaveMetafile() override;
 
       static Entity* Instantiate( Model* target, World* targetWorld, const String& entityName = TEXT("Entity"));
+      static std::vector<Entity*> InstantiateMany(Model* target, World* targetWorld, size_t count, const String& entityName = TEXT("Entity"));
 
    private:
       Entity* m_instance;
       std::vector<Mesh*>      m_meshes;
-      std::string             m_serializedInstance;
+      Prefab                  m_prefab;
       ModelLoadParams m_loadParams;
 
    };
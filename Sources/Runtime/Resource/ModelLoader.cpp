@@ -3,6 +3,7 @@
 #include "Resource/Model.h"
 #include "Resource/Material.h"
 #include "Resource/Texture2D.h"
+#include "Resource/MeshOptimizer.h"
 #include "Core/Logger.h"
 #include "Core/Engine.h"
 #include "Component/MeshRenderComponent.h"
@@ -18,6 +19,102 @@ namespace Mile
 {
    DEFINE_LOG_CATEGORY(MileModelLoader);
 
+   /** "MMSH" */
+   constexpr UINT32 MESH_CACHE_MAGIC = 0x48534D4D;
+   constexpr UINT32 MESH_CACHE_VERSION = 1;
+   constexpr wchar_t MESH_CACHE_EXTENSION[] = TEXT(".meshcache");
+
+   /** Replace characters which are not allowed in file name. (ex. ':', '|' or '/' of imported node path) */
+   static String SanitizeFileName(const String& name)
+   {
+      static const String invalidCharacters = TEXT("<>:\"/\\|?*");
+      String sanitized = name;
+      for (auto& character : sanitized)
+      {
+         if (character < 0x20 || invalidCharacters.find(character) != String::npos)
+         {
+            character = TEXT('_');
+         }
+      }
+
+      return sanitized;
+   }
+
+   /**
+    * @brief   Optimized mesh cache layout. [Header][Vertices][Indices]
+    *          Source hash is computed from imported vertices and indices before optimization.
+    */
+   struct MeshCacheHeader
+   {
+      UINT32 Magic = MESH_CACHE_MAGIC;
+      UINT32 Version = MESH_CACHE_VERSION;
+      UINT64 SourceHash = 0;
+      UINT32 VertexStride = sizeof(VertexPosTexNTB);
+      UINT32 SourceVertexNum = 0;
+      UINT32 VertexNum = 0;
+      UINT32 IndexNum = 0;
+      VertexCacheStatistics Before;
+      VertexCacheStatistics After;
+   };
+
+   static bool LoadMeshCache(const String& filePath, UINT64 sourceHash, MeshCacheHeader& header, std::vector<VertexPosTexNTB>& vertices, std::vector<unsigned int>& indices)
+   {
+      std::ifstream stream(std::filesystem::path(filePath), std::ios::binary);
+      if (!stream.is_open())
+      {
+         return false;
+      }
+
+      MeshCacheHeader cachedHeader;
+      stream.read(reinterpret_cast<char*>(&cachedHeader), sizeof(MeshCacheHeader));
+      bool bIsValidHeader = stream.good() &&
+         cachedHeader.Magic == MESH_CACHE_MAGIC &&
+         cachedHeader.Version == MESH_CACHE_VERSION &&
+         cachedHeader.SourceHash == sourceHash &&
+         cachedHeader.VertexStride == sizeof(VertexPosTexNTB) &&
+         cachedHeader.IndexNum % 3 == 0;
+      if (!bIsValidHeader)
+      {
+         return false;
+      }
+
+      std::vector<VertexPosTexNTB> cachedVertices(cachedHeader.VertexNum);
+      std::vector<unsigned int> cachedIndices(cachedHeader.IndexNum);
+      stream.read(reinterpret_cast<char*>(cachedVertices.data()), sizeof(VertexPosTexNTB) * cachedVertices.size());
+      stream.read(reinterpret_cast<char*>(cachedIndices.data()), sizeof(unsigned int) * cachedIndices.size());
+      if (!stream.good())
+      {
+         return false;
+      }
+
+      for (unsigned int index : cachedIndices)
+      {
+         if (index >= cachedHeader.VertexNum)
+         {
+            return false;
+         }
+      }
+
+      header = cachedHeader;
+      vertices = std::move(cachedVertices);
+      indices = std::move(cachedIndices);
+      return true;
+   }
+
+   static bool SaveMeshCache(const String& filePath, const MeshCacheHeader& header, const std::vector<VertexPosTexNTB>& vertices, const std::vector<unsigned int>& indices)
+   {
+      std::ofstream stream(std::filesystem::path(filePath), std::ios::binary | std::ios::trunc);
+      if (!stream.is_open())
+      {
+         return false;
+      }
+
+      stream.write(reinterpret_cast<const char*>(&header), sizeof(MeshCacheHeader));
+      stream.write(reinterpret_cast<const char*>(vertices.data()), sizeof(VertexPosTexNTB) * vertices.size());
+      stream.write(reinterpret_cast<const char*>(indices.data()), sizeof(unsigned int) * indices.size());
+      return stream.good();
+   }
+
    ModelLoader::ModelLoader(ResourceManager* resMng) :
       m_resMng(resMng),
       m_renderer(nullptr)
@@ -134,11 +231,25 @@ namespace Mile
       }
 
       auto meshName = String2WString(mesh->mName.C_Str());
+      if (target->GetLoadParameters().OptimizeMesh && !indices.empty())
+      {
+         size_t meshIndex = std::distance(scene->mMeshes, std::find(scene->mMeshes, scene->mMeshes + scene->mNumMeshes, mesh));
+         OptimizeMesh(target, meshIndex, meshName, verticies, indices);
+      }
+
       entity->SetName(meshName);
       Mesh* newMesh = new Mesh(m_renderer,
          meshName,
          target->GetPath());
-      newMesh->Init(verticies, indices);
+      if (MeshOptimizer::CanUse16BitIndices(verticies.size()))
+      {
+         std::vector<UINT16> shortIndices(indices.begin(), indices.end());
+         newMesh->Init(verticies, shortIndices);
+      }
+      else
+      {
+         newMesh->Init(verticies, indices);
+      }
       target->AddMesh(newMesh);
 
       auto renderComponent = entity->AddComponent<MeshRenderComponent>();
@@ -204,4 +315,47 @@ namespace Mile
 
       renderComponent->SetMaterial(foundedMat);
    }
+
+   void ModelLoader::OptimizeMesh(Model* target, size_t meshIndex, const String& meshName, std::vector<VertexPosTexNTB>& vertices, std::vector<unsigned int>& indices)
+   {
+      UINT64 sourceHash = MeshOptimizer::HashBytes(vertices.data(), sizeof(VertexPosTexNTB) * vertices.size());
+      sourceHash = MeshOptimizer::HashBytes(indices.data(), sizeof(unsigned int) * indices.size(), sourceHash);
+
+      /** Mesh names are neither unique nor always valid file names. */
+      auto cachePath = target->GetFolder()
+         + target->GetName()
+         + TEXT("_")
+         + SanitizeFileName(meshName)
+         + TEXT("_")
+         + std::to_wstring(meshIndex)
+         + MESH_CACHE_EXTENSION;
+
+      MeshCacheHeader header;
+      bool bIsCached = LoadMeshCache(cachePath, sourceHash, header, vertices, indices);
+      if (!bIsCached)
+      {
+         header.SourceHash = sourceHash;
+         header.SourceVertexNum = static_cast<UINT32>(vertices.size());
+         header.Before = MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+
+         MeshOptimizer::Optimize(vertices, indices);
+
+         header.VertexNum = static_cast<UINT32>(vertices.size());
+         header.IndexNum = static_cast<UINT32>(indices.size());
+         header.After = MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+         if (!SaveMeshCache(cachePath, header, vertices, indices))
+         {
+            ME_LOG(MileModelLoader, Warning, TEXT("Failed to save optimized mesh cache to ") + cachePath);
+         }
+      }
+
+      ME_LOG(MileModelLoader, Display,
+         TEXT("Mesh optimized%s : %s (Vertices %u -> %u, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, %d bit indices)"),
+         bIsCached ? TEXT(" (cached)") : TEXT(""),
+         meshName.c_str(),
+         header.SourceVertexNum, header.VertexNum,
+         header.Before.ACMR, header.After.ACMR,
+         header.Before.ATVR, header.After.ATVR,
+         MeshOptimizer::CanUse16BitIndices(header.VertexNum) ? 16 : 32);
+   }
 }
\ No newline at end of file
@@ -15,6 +15,7 @@ namespace Mile
    class ResourceManager;
    class Entity;
    class Mesh;
+   struct VertexPosTexNTB;
    class MEAPI ModelLoader
    {
    public:
@@ -25,6 +26,15 @@ namespace Mile
       void ReconstructEntityWithAiNode(const aiScene* scene, aiNode* node, Model* target, Entity* entity);
       void ReconstructMeshWithAiMesh(const aiScene* scene, aiMesh* mesh, Model* target, Entity* entity);
 
+      /**
+      * @brief   Weld and reorder mesh for vertex cache, overdraw and vertex fetch.
+      *          Optimized mesh is cached as '{ModelName}_{MeshName}_{MeshIndex}.meshcache' next to model's meta file
+      *          and it is reused while imported vertices and indices are not changed.
+      *          Characters of mesh name which are not allowed in file name are replaced with '_'.
+      * @param   meshIndex   Index of mesh in imported scene.
+      */
+      void OptimizeMesh(Model* target, size_t meshIndex, const String& meshName, std::vector<VertexPosTexNTB>& vertices, std::vector<unsigned int>& indices);
+
    private:
       ResourceManager* m_resMng;
       RendererDX11* m_renderer;
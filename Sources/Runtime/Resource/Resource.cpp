@@ -1,4 +1,5 @@
 #include "Resource/Resource.h"
+#include "Resource/ResourceManager.h"
 #include "Core/Context.h"
 #include <cwctype>
 
@@ -14,6 +15,21 @@ namespace Mile
       ++ResCount;
    }
 
+   void Resource::SetPath(const String& path)
+   {
+      bool bPathChanged = (m_path != path);
+      m_path = path;
+      m_name = GetFileNameFromPath(path);
+      m_ext = GetFileExtensionFromPath(m_path);
+      std::transform(m_ext.begin(), m_ext.end(), m_ext.begin(), ::towlower);
+      m_folder = GetFolderFromPath(path);
+
+      if (bPathChanged && m_resMng != nullptr)
+      {
+         m_resMng->OnResourcePathChanged(this);
+      }
+   }
+
    String Resource::GetFileNameFromPath(const String& filePath, bool includeExt)
    {
       auto splitPath = std::move(SplitStr(filePath, '/'));
@@ -39,6 +39,15 @@ namespace Mile
          return false;
       }
 
+      /**
+      * Asynchronous loading splits initialization into two steps.
+      * InitAsync runs on a thread pool worker; it must not depend on the thread which owns rendering states.
+      * FinalizeInit runs on the thread which calls ResourceManager::FinalizeAsyncLoads. (Main thread)
+      * By default whole Init runs on the worker.
+      */
+      virtual bool InitAsync(const String& path) { return Init(path); }
+      virtual bool FinalizeInit() { return true; }
+
       virtual bool SaveTo(const String& filePath)
       {
          SetPath(filePath);
@@ -66,14 +75,7 @@ namespace Mile
       void SucceedInit() { m_bIsInitialized = true; }
 
    private:
-      void SetPath(const String& path)
-      {
-         m_path = path;
-         m_name = GetFileNameFromPath(path);
-         m_ext = GetFileExtensionFromPath(m_path);
-         std::transform(m_ext.begin(), m_ext.end(), m_ext.begin(), ::towlower);
-         m_folder = GetFolderFromPath(path);
-      }
+      void SetPath(const String& path);
 
    protected:
       ResourceManager* m_resMng;
@@ -18,104 +18,122 @@ namespace Mile
    {
       if (res != nullptr)
       {
-         std::lock_guard<std::mutex> lock(m_mutex);
-         m_resources.push_back(res);
+         std::unique_lock<std::shared_mutex> lock(m_mutex);
+         IndexedKey key{ res->GetPath(), res->GetName() };
+         if (m_resources.emplace(res, key).second)
+         {
+            AddToIndex(m_pathIndex, key.Path, res);
+            AddToIndex(m_nameIndex, key.Name, res);
+         }
       }
    }
 
    void ResourceCache::Clear()
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto resource : m_resources)
+      std::unique_lock<std::shared_mutex> lock(m_mutex);
+      for (auto& resourcePair : m_resources)
       {
+         Resource* resource = resourcePair.first;
          SafeDelete(resource);
       }
 
-      m_resources.resize(0);
+      m_resources.clear();
+      m_pathIndex.clear();
+      m_nameIndex.clear();
    }
 
    void ResourceCache::Remove(Resource* resPtr)
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto resItr = m_resources.begin(); resItr != m_resources.end(); ++resItr)
+      std::unique_lock<std::shared_mutex> lock(m_mutex);
+      auto foundItr = m_resources.find(resPtr);
+      if (foundItr != m_resources.end())
       {
-         if (resPtr == (*resItr))
-         {
-            m_resources.erase(resItr);
-            SafeDelete(resPtr);
-            return;
-         }
+         RemoveFromIndex(m_pathIndex, foundItr->second.Path, resPtr);
+         RemoveFromIndex(m_nameIndex, foundItr->second.Name, resPtr);
+         m_resources.erase(foundItr);
+         SafeDelete(resPtr);
       }
    }
 
-   Resource* ResourceCache::GetByPath(const String& path) const
+   void ResourceCache::Reindex(Resource* res)
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto res : m_resources)
+      std::unique_lock<std::shared_mutex> lock(m_mutex);
+      auto foundItr = m_resources.find(res);
+      if (foundItr != m_resources.end())
       {
-         if (res->GetPath() == path)
-         {
-            return res;
-         }
+         IndexedKey& key = foundItr->second;
+         RemoveFromIndex(m_pathIndex, key.Path, res);
+         RemoveFromIndex(m_nameIndex, key.Name, res);
+
+         key.Path = res->GetPath();
+         key.Name = res->GetName();
+         AddToIndex(m_pathIndex, key.Path, res);
+         AddToIndex(m_nameIndex, key.Name, res);
       }
+   }
 
-      return nullptr;
+   Resource* ResourceCache::GetByPath(const String& path) const
+   {
+      std::shared_lock<std::shared_mutex> lock(m_mutex);
+      return FindFromIndex(m_pathIndex, path);
    }
 
    Resource* ResourceCache::GetByName(const String& name) const
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto res : m_resources)
-      {
-         if (res->GetName() == name)
-         {
-            return res;
-         }
-      }
+      std::shared_lock<std::shared_mutex> lock(m_mutex);
+      return FindFromIndex(m_nameIndex, name);
+   }
 
-      return nullptr;
+   bool ResourceCache::HasByPath(const String& path) const
+   {
+      return (GetByPath(path) != nullptr);
+   }
+
+   bool ResourceCache::HasByName(const String& name) const
+   {
+      return (GetByName(name) != nullptr);
    }
 
-   bool ResourceCache::HasByPath(const String& name) const
+   bool ResourceCache::IsValid(Resource* target) const
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto res : m_resources)
-      {
-         if (res->GetPath() == name)
-         {
-            return true;
-         }
-      }
+      std::shared_lock<std::shared_mutex> lock(m_mutex);
+      return (m_resources.find(target) != m_resources.end());
+   }
 
-      return false;
+   size_t ResourceCache::GetSize() const
+   {
+      std::shared_lock<std::shared_mutex> lock(m_mutex);
+      return m_resources.size();
    }
 
-   bool ResourceCache::HasByName(const String& name) const
+   void ResourceCache::AddToIndex(ResourceIndex& index, const String& key, Resource* res)
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto res : m_resources)
+      index[key].push_back(res);
+   }
+
+   void ResourceCache::RemoveFromIndex(ResourceIndex& index, const String& key, Resource* res)
+   {
+      auto foundItr = index.find(key);
+      if (foundItr != index.end())
       {
-         if (res->GetName() == name)
+         auto& resources = foundItr->second;
+         resources.erase(std::remove(resources.begin(), resources.end(), res), resources.end());
+         if (resources.empty())
          {
-            return true;
+            index.erase(foundItr);
          }
       }
-
-      return false;
    }
 
-   bool ResourceCache::IsValid(Resource* target) const
+   Resource* ResourceCache::FindFromIndex(const ResourceIndex& index, const String& key) const
    {
-      std::lock_guard<std::mutex> lock(m_mutex);
-      for (auto resource : m_resources)
+      auto foundItr = index.find(key);
+      if (foundItr != index.end() && !foundItr->second.empty())
       {
-         if (resource == target)
-         {
-            return true;
-         }
+         return foundItr->second.front();
       }
 
-      return false;
+      return nullptr;
    }
 
 }
\ No newline at end of file
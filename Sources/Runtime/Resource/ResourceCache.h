@@ -21,10 +21,32 @@ namespace Mile
       bool HasByName(const String& name) const;
       bool IsValid(Resource* target) const;
 
+      /** Update path/name index of resource which has been moved to another path. */
+      void Reindex(Resource* res);
+
+      size_t GetSize() const;
+
+   private:
+      /** Path and name of resource at the moment it was indexed. */
+      struct IndexedKey
+      {
+         String Path;
+         String Name;
+      };
+
+      /** Resources which have same key are sorted by order of addition. */
+      using ResourceIndex = std::unordered_map<String, std::vector<Resource*>>;
+
+      void AddToIndex(ResourceIndex& index, const String& key, Resource* res);
+      void RemoveFromIndex(ResourceIndex& index, const String& key, Resource* res);
+      Resource* FindFromIndex(const ResourceIndex& index, const String& key) const;
+
    private:
       Context* m_context;
-      mutable std::mutex m_mutex;
-      std::vector<Resource*> m_resources;
+      mutable std::shared_mutex m_mutex;
+      std::unordered_map<Resource*, IndexedKey> m_resources;
+      ResourceIndex m_pathIndex;
+      ResourceIndex m_nameIndex;
 
    };
 
@@ -2,6 +2,7 @@
 #include "Resource/ResourceCache.h"
 #include "Resource/ModelLoader.h"
 #include "Core/Context.h"
+#include "MT/ThreadPool.h"
 
 namespace Mile
 {
@@ -28,6 +29,7 @@ namespace Mile
          }
 
          m_modelLoader = new ModelLoader(this);
+         m_finalizeThreadID = std::this_thread::get_id();
 
          ME_LOG(MileResourceManager, ELogVerbosity::Log, TEXT("Resource Manager Initialized!"));
          SubSystem::InitSucceed();
@@ -43,6 +45,24 @@ namespace Mile
    {
       if (IsInitialized())
       {
+         /** Workers may still touching resources which are in flight. */
+         ThreadPool* threadPool = GetContext()->GetSubSystem<ThreadPool>();
+         while (true)
+         {
+            {
+               std::unique_lock<std::mutex> lock(m_asyncLoadMutex);
+               if (m_inFlightLoads.empty())
+               {
+                  break;
+               }
+            }
+
+            if (FinalizeAsyncLoads() == 0 && (threadPool == nullptr || !threadPool->TryExecuteOne()))
+            {
+               std::this_thread::yield();
+            }
+         }
+
          SafeDelete(m_modelLoader);
          ClearCache();
          ME_LOG(MileResourceManager, ELogVerbosity::Log, TEXT("Resource Manager deinitialized."));
@@ -65,4 +85,168 @@ namespace Mile
    {
       return (*m_modelLoader);
    }
+
+   size_t ResourceManager::FinalizeAsyncLoads()
+   {
+      if (!IsFinalizeThread())
+      {
+         ME_LOG(MileResourceManager, Warning, TEXT("Asynchronous loads must be finalized on the thread which initialized Resource Manager."));
+         return 0;
+      }
+
+      std::deque<AsyncLoadRequestPtr> loadedRequests;
+      {
+         std::unique_lock<std::mutex> lock(m_asyncLoadMutex);
+         loadedRequests.swap(m_loadedRequests);
+      }
+
+      for (const auto& request : loadedRequests)
+      {
+         CompleteAsyncLoad(request);
+      }
+
+      return loadedRequests.size();
+   }
+
+   Resource* ResourceManager::WaitAsyncLoad(const std::shared_future<Resource*>& future)
+   {
+      if (!future.valid())
+      {
+         return nullptr;
+      }
+
+      ThreadPool* threadPool = GetContext()->GetSubSystem<ThreadPool>();
+      while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      {
+         bool bProgressed = false;
+         if (IsFinalizeThread())
+         {
+            bProgressed = (FinalizeAsyncLoads() > 0);
+         }
+
+         if (!bProgressed && threadPool != nullptr)
+         {
+            bProgressed = threadPool->TryExecuteOne();
+         }
+
+         if (!bProgressed)
+         {
+            std::this_thread::yield();
+         }
+      }
+
+      return future.get();
+   }
+
+   std::shared_future<Resource*> ResourceManager::RequestAsyncLoad(const String& relativePath, ResourceFactory factory)
+   {
+      if (relativePath.empty())
+      {
+         return std::shared_future<Resource*>();
+      }
+
+      Resource* cachedResource = m_cache->GetByPath(relativePath);
+      if (cachedResource != nullptr)
+      {
+         std::promise<Resource*> cachedPromise;
+         cachedPromise.set_value(cachedResource);
+         return cachedPromise.get_future().share();
+      }
+
+      AsyncLoadRequestPtr request;
+      {
+         std::unique_lock<std::mutex> lock(m_asyncLoadMutex);
+         auto foundItr = m_inFlightLoads.find(relativePath);
+         if (foundItr != m_inFlightLoads.end())
+         {
+            return foundItr->second->Future;
+         }
+
+         request = std::make_shared<AsyncLoadRequest>();
+         request->Path = relativePath;
+         request->Target = factory(this);
+         request->Future = request->Promise.get_future().share();
+         m_inFlightLoads[relativePath] = request;
+      }
+
+      ThreadPool* threadPool = GetContext()->GetSubSystem<ThreadPool>();
+      if (threadPool != nullptr && threadPool->IsInitialized())
+      {
+         threadPool->AddTask([this, request]()
+            {
+               ExecuteAsyncLoad(request);
+            });
+      }
+      else
+      {
+         ExecuteAsyncLoad(request);
+      }
+
+      return request->Future;
+   }
+
+   bool ResourceManager::FindInFlightLoad(const String& relativePath, std::shared_future<Resource*>& out)
+   {
+      std::unique_lock<std::mutex> lock(m_asyncLoadMutex);
+      auto foundItr = m_inFlightLoads.find(relativePath);
+      if (foundItr != m_inFlightLoads.end())
+      {
+         out = foundItr->second->Future;
+         return true;
+      }
+
+      return false;
+   }
+
+   void ResourceManager::ExecuteAsyncLoad(const AsyncLoadRequestPtr& request)
+   {
+      OPTICK_EVENT();
+      request->bLoaded = request->Target->InitAsync(request->Path);
+
+      std::unique_lock<std::mutex> lock(m_asyncLoadMutex);
+      m_loadedRequests.push_back(request);
+   }
+
+   void ResourceManager::CompleteAsyncLoad(const AsyncLoadRequestPtr& request)
+   {
+      Resource* loadedResource = nullptr;
+      Resource* target = request->Target;
+      request->Target = nullptr;
+      if (request->bLoaded && target->FinalizeInit())
+      {
+         /** Same path may loaded synchronously while it was in flight. */
+         Resource* cachedResource = m_cache->GetByPath(request->Path);
+         if (cachedResource != nullptr)
+         {
+            SafeDelete(target);
+            loadedResource = cachedResource;
+         }
+         else
+         {
+            m_cache->Add(target);
+            ME_LOG(MileResourceManager, ELogVerbosity::Log, TEXT("Successfully load resource asynchronously from : %s"), request->Path.c_str());
+            loadedResource = target;
+         }
+      }
+      else
+      {
+         ME_LOG(MileResourceManager, ELogVerbosity::Warning, TEXT("Failed to load resource asynchronously from : %s"), request->Path.c_str());
+         SafeDelete(target);
+      }
+
+      {
+         std::unique_lock<std::mutex> lock(m_asyncLoadMutex);
+         m_inFlightLoads.erase(request->Path);
+      }
+
+      request->Promise.set_value(loadedResource);
+   }
+
+   void ResourceManager::OnResourcePathChanged(Resource* resource)
+   {
+      if (m_cache != nullptr)
+      {
+         m_cache->Reindex(resource);
+      }
+   }
 }
\ No newline at end of file
@@ -8,6 +8,50 @@ namespace Mile
    DECLARE_LOG_CATEGORY_STATIC(MileResourceManager, ELogVerbosity::Log);
 
    class ModelLoader;
+   class ResourceManager;
+
+   /** Asynchronous load request which is shared between every requester of same path. */
+   struct AsyncLoadRequest
+   {
+      String Path;
+      Resource* Target = nullptr;
+      bool bLoaded = false;
+      std::promise<Resource*> Promise;
+      std::shared_future<Resource*> Future;
+   };
+
+   using AsyncLoadRequestPtr = std::shared_ptr<AsyncLoadRequest>;
+
+   template < typename Ty >
+   class ResourceLoadHandle
+   {
+   public:
+      ResourceLoadHandle() :
+         m_resMng(nullptr)
+      {
+      }
+
+      ResourceLoadHandle(ResourceManager* resMng, const std::shared_future<Resource*>& future) :
+         m_resMng(resMng),
+         m_future(future)
+      {
+      }
+
+      bool IsValid() const { return m_future.valid(); }
+      bool IsReady() const
+      {
+         return IsValid() && (m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+      }
+
+      /** Wait until resource has been loaded. @return nullptr if failed to load. */
+      Ty* Get() const;
+
+   private:
+      ResourceManager* m_resMng;
+      std::shared_future<Resource*> m_future;
+
+   };
+
    class MEAPI ResourceManager : public SubSystem
    {
    public:
@@ -23,59 +67,108 @@ namespace Mile
          if (!relativePath.empty())
          {
             Context* context = GetContext();
-            if (m_cache->HasByPath(relativePath))
+            Resource* cachedResource = m_cache->GetByPath(relativePath);
+            if (cachedResource != nullptr)
             {
                if (!bDoNotLeaveCachingLog)
                {
-                  ME_LOG(MileResourceManager, ELogVerbosity::Log, TEXT("Successfully load resource from Cache : ") + relativePath);
+                  ME_LOG(MileResourceManager, ELogVerbosity::Log, TEXT("Successfully load resource from Cache : %s"), relativePath.c_str());
                }
 
-               return GetByPath<Ty>(relativePath);
+               return static_cast<Ty*>(cachedResource);
+            }
+
+            /** Only finalize thread waits for in flight load, workers may be waited by finalize thread. */
+            std::shared_future<Resource*> inFlightLoad;
+            if (IsFinalizeThread() && FindInFlightLoad(relativePath, inFlightLoad))
+            {
+               return static_cast<Ty*>(WaitAsyncLoad(inFlightLoad));
             }
 
             auto newResource = new Ty(this);
             if (newResource->Init(relativePath))
             {
                m_cache->Add(static_cast<ResourcePtr>(newResource));
-               ME_LOG(MileResourceManager, ELogVerbosity::Log, TEXT("Successfully load resource from : ") + relativePath);
+               ME_LOG(MileResourceManager, ELogVerbosity::Log, TEXT("Successfully load resource from : %s"), relativePath.c_str());
                return newResource;
             }
 
-            ME_LOG(MileResourceManager, ELogVerbosity::Warning, TEXT("Failed to load resource from : ") + relativePath);
+            ME_LOG(MileResourceManager, ELogVerbosity::Warning, TEXT("Failed to load resource from : %s"), relativePath.c_str());
             SafeDelete(newResource);
          }
 
          return nullptr;
       }
 
-      void Unload(Resource* ptr)
+      /**
+      * @brief   Load resource on thread pool. Requests for a path which is already in flight share same load.
+      *          Loaded resource becomes available after FinalizeAsyncLoads has been called on the main thread.
+      */
+      template < typename Ty >
+      ResourceLoadHandle<Ty> LoadAsync(const String& relativePath)
       {
-         if (ptr != nullptr)
+         return ResourceLoadHandle<Ty>(this, RequestAsyncLoad(relativePath, &ResourceManager::CreateResource<Ty>));
+      }
+
+      /** Issue every load at once, so that the loads run in parallel. */
+      template < typename Ty >
+      std::vector<ResourceLoadHandle<Ty>> LoadAsync(const std::vector<String>& relativePaths)
+      {
+         std::vector<ResourceLoadHandle<Ty>> handles;
+         handles.reserve(relativePaths.size());
+         for (const String& relativePath : relativePaths)
          {
-            m_cache->Remove(ptr);
+            handles.push_back(LoadAsync<Ty>(relativePath));
          }
+
+         return handles;
       }
 
+      /** Load resources in parallel and wait for all of them. Result has same order with paths. */
       template < typename Ty >
-      Ty* GetByPath(const String& filePath)
+      std::vector<Ty*> LoadBatch(const std::vector<String>& relativePaths)
       {
-         if (m_cache->HasByPath(filePath))
+         std::vector<ResourceLoadHandle<Ty>> handles = LoadAsync<Ty>(relativePaths);
+         std::vector<Ty*> resources;
+         resources.reserve(handles.size());
+         for (const auto& handle : handles)
          {
-            return static_cast<Ty*>(m_cache->GetByPath(filePath));
+            resources.push_back(handle.Get());
          }
 
-         return nullptr;
+         return resources;
       }
 
-      template < typename Ty >
-      Ty* GetByName(const String& name)
+      /**
+      * @brief   Finalize resources which have been loaded on worker threads.
+      *          It must be called from the thread which initialized ResourceManager.
+      * @return  Number of finalized requests.
+      */
+      size_t FinalizeAsyncLoads();
+
+      /** Wait for in flight load. Finalize thread and workers keep processing their jobs while waiting. */
+      Resource* WaitAsyncLoad(const std::shared_future<Resource*>& future);
+
+      bool IsFinalizeThread() const { return std::this_thread::get_id() == m_finalizeThreadID; }
+
+      void Unload(Resource* ptr)
       {
-         if (m_cache->HasByName(name))
+         if (ptr != nullptr)
          {
-            return static_cast<Ty*>(m_cache->GetByName(name));
+            m_cache->Remove(ptr);
          }
+      }
 
-         return nullptr;
+      template < typename Ty >
+      Ty* GetByPath(const String& filePath)
+      {
+         return static_cast<Ty*>(m_cache->GetByPath(filePath));
+      }
+
+      template < typename Ty >
+      Ty* GetByName(const String& name)
+      {
+         return static_cast<Ty*>(m_cache->GetByName(name));
       }
 
       template < typename Ty >
@@ -121,9 +214,44 @@ namespace Mile
 
       ModelLoader& GetModelLoader() const;
 
+   private:
+      /** Keep cache index up to date when resource saved to another path. */
+      void OnResourcePathChanged(Resource* resource);
+
+      using ResourceFactory = Resource*(*)(ResourceManager*);
+      template < typename Ty >
+      static Resource* CreateResource(ResourceManager* resMng)
+      {
+         return static_cast<Resource*>(new Ty(resMng));
+      }
+
+      std::shared_future<Resource*> RequestAsyncLoad(const String& relativePath, ResourceFactory factory);
+      bool FindInFlightLoad(const String& relativePath, std::shared_future<Resource*>& out);
+      void ExecuteAsyncLoad(const AsyncLoadRequestPtr& request);
+      void CompleteAsyncLoad(const AsyncLoadRequestPtr& request);
+
    private:
       ResourceCachePtr    m_cache;
       ModelLoader* m_modelLoader;
 
+      std::mutex m_asyncLoadMutex;
+      std::unordered_map<String, AsyncLoadRequestPtr> m_inFlightLoads;
+      /** Requests which have been loaded on worker and waiting for finalization. */
+      std::deque<AsyncLoadRequestPtr> m_loadedRequests;
+      std::thread::id m_finalizeThreadID;
+
+      friend Resource;
+
    };
+
+   template < typename Ty >
+   Ty* ResourceLoadHandle<Ty>::Get() const
+   {
+      if (!IsValid() || m_resMng == nullptr)
+      {
+         return nullptr;
+      }
+
+      return static_cast<Ty*>(m_resMng->WaitAsyncLoad(m_future));
+   }
 }
\ No newline at end of file
@@ -28,6 +28,11 @@ namespace Mile
    }
 
    bool Texture2D::Init(const String& filePath)
+   {
+      return InitAsync(filePath) && FinalizeInit();
+   }
+
+   bool Texture2D::InitAsync(const String& filePath)
    {
       if (Resource::Init(filePath))
       {
@@ -45,12 +50,6 @@ namespace Mile
             return false;
          }
 
-         if (!InitRawTexture())
-         {
-            return false;
-         }
-
-         SucceedInit();
          return true;
       }
 
@@ -58,6 +57,17 @@ namespace Mile
       return false;
    }
 
+   bool Texture2D::FinalizeInit()
+   {
+      if (m_bIsInitialized || !InitRawTexture())
+      {
+         return false;
+      }
+
+      SucceedInit();
+      return true;
+   }
+
    bool Texture2D::Save(const String& filePath)
    {
       return false;
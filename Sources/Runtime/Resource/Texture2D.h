@@ -14,6 +14,9 @@ namespace Mile
       virtual ~Texture2D();
 
       virtual bool Init(const String& filePath) override;
+      /** Decode texture on worker thread. */
+      virtual bool InitAsync(const String& filePath) override;
+      virtual bool FinalizeInit() override;
       virtual bool Save(const String& filePath);
 
       unsigned char* GetRawData() const { return m_rawData; }
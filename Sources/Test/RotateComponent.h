@@ -15,6 +15,7 @@ public:
    }
 
    virtual void Update() override;
+   virtual bool IsParallelUpdatable() const override { return true; }
 
    virtual json Serialize() const override
    {